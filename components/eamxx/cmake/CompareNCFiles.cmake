@@ -6,9 +6,10 @@
 # Optional keyword arguments
 #  - LABELS: labels to attach to the created tests
 #  - FIXTURES_REQUIRED: list of fixtures required
+#  - EXPECT_DIFF: the test passes only if both files exist and differ
 function(CompareNCFiles)
   # Parse keyword arguments
-  set (options)
+  set (options EXPECT_DIFF)
   set (args1v TEST_NAME SRC_FILE TGT_FILE)
   set (argsMv LABELS FIXTURES_REQUIRED)
 
@@ -29,9 +30,14 @@ function(CompareNCFiles)
     message (FATAL_ERROR "Aborting...")
   endif()
 
+  set (expect_diff)
+  if (PARSE_EXPECT_DIFF)
+    set (expect_diff EXPECT_DIFF)
+  endif()
+
   add_test (
     NAME ${PARSE_TEST_NAME}
-    COMMAND cmake -P ${CMAKE_BINARY_DIR}/bin/CprncTest.cmake ${PARSE_SRC_FILE} ${PARSE_TGT_FILE}
+    COMMAND cmake -P ${CMAKE_BINARY_DIR}/bin/CprncTest.cmake ${PARSE_SRC_FILE} ${PARSE_TGT_FILE} ${expect_diff}
     WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR})
 
   # Set test properties, if needed
@@ -7,10 +7,12 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/grid/ensemble_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_timing.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_fast_restart.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -256,6 +258,22 @@ void AtmosphereDriver::create_grids()
     m_atm_params.sublist("provenance").set("initial_conditions_file",filename);
   }
 
+  // In ensemble runs, the members are stacked along the columns of each grid,
+  // so that each atm process runs all members at once. Only the mesh-free
+  // grids manager (used by standalone physics runs) supports this.
+  if (m_atm_params.isSublist("ensemble")) {
+    m_ensemble_size = m_atm_params.sublist("ensemble").get<int>("number_of_members",1);
+  }
+  if (m_ensemble_size>1) {
+    EKAT_REQUIRE_MSG (gm_type=="Mesh Free",
+        "Error! Ensemble runs are only supported with the 'Mesh Free' grids manager.\n"
+        "  - grids manager type: " + gm_type + "\n");
+    using vos_t = std::vector<std::string>;
+    for (const auto& gname : gm_params.get<vos_t>("grids_names")) {
+      gm_params.sublist(gname).set("number_of_ensemble_members",m_ensemble_size);
+    }
+  }
+
   m_atm_logger->debug("  [EAMxx] Creating grid manager '" + gm_type + "' ...");
   m_grids_manager = GridsManagerFactory::instance().create(gm_type,m_atm_comm,gm_params);
 
@@ -680,6 +698,10 @@ void AtmosphereDriver::initialize_output_managers () {
 
   auto& io_params = m_atm_params.sublist("Scorpio");
 
+  // Let all output managers share diagnostics, so that each diag is computed
+  // at most once per time step, regardless of how many streams request it
+  m_output_diags_cache = std::make_shared<OutputDiagnosticsCache>();
+
   // IMPORTANT: create model restart OutputManager first! This OM will be in charge
   // of creating rpointer.atm, while other OM's will simply append to it.
   // If this assumption is not verified, we must always append to rpointer, which
@@ -694,6 +716,7 @@ void AtmosphereDriver::initialize_output_managers () {
     restart_pl.set<std::string>("Averaging Type","Instant");
     restart_pl.sublist("provenance") = m_atm_params.sublist("provenance");
     auto& om = m_output_managers.emplace_back();
+    om.set_diagnostics_cache(m_output_diags_cache);
     if (fvphyshack) {
       // Don't save CGLL fields from ICs to the restart file.
       std::map<std::string,field_mgr_ptr> fms;
@@ -717,6 +740,14 @@ void AtmosphereDriver::initialize_output_managers () {
     checkpoint_params.set("Frequency",restart_pl.sublist("output_control").get<int>("Frequency"));
   }
 
+  // In ensemble runs, output is split per member, so create the member fields.
+  // We don't know yet which fields the member output managers need, and they
+  // may write output at t0 during setup, so copy all the fields.
+  if (m_ensemble_size>1) {
+    create_ensemble_member_field_mgrs();
+    update_ensemble_member_fields();
+  }
+
   // Build one manager per output yaml file
   using vos_t = std::vector<std::string>;
   const auto& output_yaml_files = io_params.get<vos_t>("output_yaml_files",vos_t{});
@@ -735,10 +766,27 @@ void AtmosphereDriver::initialize_output_managers () {
       om_tally++;
     }
     params.sublist("provenance") = m_atm_params.sublist("provenance");
+    if (m_ensemble_size>1) {
+      // Add one output manager per member, each with its own file. Member grids
+      // share their names, so members cannot share the diagnostics cache either.
+      const auto prefix = params.get<std::string>("filename_prefix");
+      for (int m=0; m<m_ensemble_size; ++m) {
+        auto member_params = params;
+        member_params.set<std::string>("filename_prefix",prefix+".member"+std::to_string(m));
+        auto& om = m_output_managers.emplace_back();
+        om.set_logger(m_atm_logger);
+        om.set_diagnostics_cache(std::make_shared<OutputDiagnosticsCache>());
+        om.setup(m_atm_comm,member_params,m_ensemble_field_mgrs[m],m_ensemble_grids_mgrs[m],
+                 m_run_t0,m_case_t0,false);
+        m_ensemble_outputs.push_back({m,&om,om.get_sim_fields_names()});
+      }
+      continue;
+    }
     // Add a new output manager
     m_output_managers.emplace_back();
     auto& om = m_output_managers.back();
     om.set_logger(m_atm_logger);
+    om.set_diagnostics_cache(m_output_diags_cache);
     om.setup(m_atm_comm,params,m_field_mgrs,m_grids_manager,m_run_t0,m_case_t0,false);
   }
 
@@ -899,10 +947,30 @@ void AtmosphereDriver::restart_model ()
     }
     const auto& restart_group = it.second->get_groups_info().at("RESTART");
     std::vector<std::string> fnames;
+    std::vector<Field> fields;
     for (const auto& fn : restart_group->m_fields_names) {
       fnames.push_back(fn);
+      fields.push_back(it.second->get_field(fn));
+    }
+
+    // If the previous run also dumped per-rank binary restart files, and we are using
+    // the same decomposition, read those, since it's much faster. Otherwise, use PIO.
+    if (read_fast_restart_files(filename,fields,it.second->get_grid(),m_atm_comm)) {
+      m_atm_logger->info("    [EAMxx] Restarted fields on grid '" + it.first + "' from fast restart files.");
+      for (auto& f : fields) {
+        f.get_header().get_tracking().update_time_stamp(m_current_ts);
+      }
+    } else {
+      // With fast restart, the nc file may not store the restart fields
+      EKAT_REQUIRE_MSG (not scorpio::has_attribute(filename,"GLOBAL","has_restart_fields") or
+                        scorpio::get_attribute<int>(filename,"GLOBAL","has_restart_fields")==1,
+          "Error! Cannot use the fast restart files, and the restart file does not store the restart fields.\n"
+          "  Restart from a run with the same decomposition, or from a restart file written with the fields\n"
+          "  (see the 'fast_restart_pio_frequency' option of the model restart output).\n"
+          " - restart file: " + filename + "\n"
+          " - grid name   : " + it.first + "\n");
+      read_fields_from_file (fnames,it.second->get_grid(),filename,m_current_ts);
     }
-    read_fields_from_file (fnames,it.second->get_grid(),filename,m_current_ts);
   }
 
   // Restart the num steps counter in the atm time stamp
@@ -1363,6 +1431,10 @@ void AtmosphereDriver::set_initial_conditions ()
     m_atm_logger->info("    [EAMxx] Adding random perturbation to ICs ... done!");
   }
 
+  if (m_ensemble_size>1) {
+    apply_ensemble_member_overrides();
+  }
+
   m_atm_logger->info("  [EAMxx] set_initial_conditions ... done!");
 }
 
@@ -1396,10 +1468,7 @@ read_fields_from_file (const std::vector<std::string>& field_names_nc,
     fields.push_back(field_mgr->get_field(eamxx_name).alias(nc_name));
   }
 
-  AtmosphereInput ic_reader(file_name,grid,fields);
-  ic_reader.set_logger(m_atm_logger);
-  ic_reader.read_variables();
-  ic_reader.finalize();
+  read_fields(file_name,grid,fields);
 
   for (auto& f : fields) {
     // Set the initial time stamp
@@ -1435,10 +1504,7 @@ read_fields_from_file (const std::vector<std::string>& field_names,
     fields.push_back(field_mgr->get_field(fn));
   }
 
-  AtmosphereInput ic_reader(file_name,grid,fields);
-  ic_reader.set_logger(m_atm_logger);
-  ic_reader.read_variables();
-  ic_reader.finalize();
+  read_fields(file_name,grid,fields);
 
   for (auto& f : fields) {
     // Set the initial time stamp
@@ -1446,6 +1512,213 @@ read_fields_from_file (const std::vector<std::string>& field_names,
   }
 }
 
+void AtmosphereDriver::
+read_fields (const std::string& file_name,
+             const std::shared_ptr<const AbstractGrid>& grid,
+             const std::vector<Field>& fields) const
+{
+  // NOTE: restart files store the whole ensemble, so read them directly
+  if (m_ensemble_size==1 or m_case_t0<m_run_t0) {
+    AtmosphereInput ic_reader(file_name,grid,fields);
+    ic_reader.set_logger(m_atm_logger);
+    ic_reader.read_variables();
+    ic_reader.finalize();
+    return;
+  }
+
+  // The file contains the data of a single member: read it on the member grid,
+  // and replicate it across all members. Fields without a COL dimension are
+  // shared by all members, so we can read them directly.
+  using namespace ShortFieldTagsNames;
+  auto member_grid = create_ensemble_member_grid(grid,m_ensemble_size,0);
+  if (grid->has_special_tag_name(COL)) {
+    member_grid->reset_field_tag_name(COL,grid->get_special_tag_name(COL));
+  }
+
+  std::vector<Field> member_fields;
+  for (const auto& f : fields) {
+    const auto& fid = f.get_header().get_identifier();
+    const auto& fl  = fid.get_layout();
+    if (fl.rank()==0 or fl.tag(0)!=COL) {
+      member_fields.push_back(f);
+      continue;
+    }
+    const auto mfl = fl.clone().reset_dim(0,member_grid->get_num_local_dofs());
+    Field mf (FieldIdentifier(fid.name(),mfl,fid.get_units(),member_grid->name(),fid.data_type()));
+    mf.get_header().get_alloc_properties().request_allocation(f.get_header().get_alloc_properties().get_largest_pack_size());
+    mf.allocate_view();
+    member_fields.push_back(mf);
+  }
+
+  AtmosphereInput ic_reader(file_name,member_grid,member_fields);
+  ic_reader.set_logger(m_atm_logger);
+  ic_reader.read_variables();
+  ic_reader.finalize();
+
+  for (size_t i=0; i<fields.size(); ++i) {
+    if (member_fields[i].get_internal_view_data_unsafe<void>()==fields[i].get_internal_view_data_unsafe<void>()) {
+      continue;
+    }
+    for (int m=0; m<m_ensemble_size; ++m) {
+      copy_to_ensemble(member_fields[i],fields[i],m_ensemble_size,m);
+    }
+  }
+}
+
+void AtmosphereDriver::apply_ensemble_member_overrides ()
+{
+  // Per-member IC overrides are specified as
+  //   ensemble:
+  //     member_overrides:
+  //       member_<i>:
+  //         field_name: value
+  // Process parameters can differ across members too, if the process reads
+  // them from input fields (e.g., SHOC's per_column_runtime_options), since
+  // input fields not computed by any process keep their IC values.
+  auto& ens_pl = m_atm_params.sublist("ensemble");
+  if (not ens_pl.isSublist("member_overrides")) {
+    return;
+  }
+  auto& overrides_pl = ens_pl.sublist("member_overrides");
+
+  m_atm_logger->info("    [EAMxx] Applying ensemble member overrides ...");
+  using namespace ShortFieldTagsNames;
+  for (int m=0; m<m_ensemble_size; ++m) {
+    const auto mname = "member_" + std::to_string(m);
+    if (not overrides_pl.isSublist(mname)) {
+      continue;
+    }
+    auto& member_pl = overrides_pl.sublist(mname);
+    for (auto it=member_pl.params_names_cbegin(); it!=member_pl.params_names_cend(); ++it) {
+      const auto& fname = *it;
+      EKAT_REQUIRE_MSG (member_pl.isType<double>(fname),
+          "Error! Ensemble member overrides must be scalar doubles.\n"
+          "  - member: " + mname + "\n"
+          "  - field : " + fname + "\n");
+      const auto value = member_pl.get<double>(fname);
+      bool found = false;
+      for (const auto& it_fm : m_field_mgrs) {
+        const auto& fm = it_fm.second;
+        if (not fm->has_field(fname)) {
+          continue;
+        }
+        found = true;
+        auto f = fm->get_field(fname);
+        const auto& fid = f.get_header().get_identifier();
+        EKAT_REQUIRE_MSG (fid.get_layout().rank()>0 and fid.get_layout().tag(0)==COL,
+            "Error! Ensemble member overrides require fields with a COL dimension.\n"
+            "  - field: " + fname + "\n");
+
+        const auto mfl = fid.get_layout().clone().reset_dim(0,fid.get_layout().dim(0)/m_ensemble_size);
+        Field mf (FieldIdentifier(fname,mfl,fid.get_units(),fid.get_grid_name(),fid.data_type()));
+        mf.allocate_view();
+        mf.deep_copy(static_cast<Real>(value));
+        copy_to_ensemble(mf,f,m_ensemble_size,m);
+      }
+      EKAT_REQUIRE_MSG (found,
+          "Error! Ensemble member override for a field not in any field manager.\n"
+          "  - member: " + mname + "\n"
+          "  - field : " + fname + "\n");
+    }
+  }
+  m_atm_logger->info("    [EAMxx] Applying ensemble member overrides ... done!");
+}
+
+void AtmosphereDriver::create_ensemble_member_field_mgrs ()
+{
+  // For each member, create field managers on the member grids, holding a
+  // copy of the member columns of the fields with a COL dimension (which must
+  // be Real). Other fields are the same for all members, so they are shared.
+  using namespace ShortFieldTagsNames;
+  m_ensemble_grids_mgrs.resize(m_ensemble_size);
+  m_ensemble_field_mgrs.resize(m_ensemble_size);
+  for (int m=0; m<m_ensemble_size; ++m) {
+    auto member_gm = std::make_shared<EnsembleMemberGridsManager>(m_grids_manager,m_ensemble_size,m);
+    m_ensemble_grids_mgrs[m] = member_gm;
+    for (const auto& it : m_field_mgrs) {
+      const auto& grid = member_gm->get_grid(it.first);
+      auto fm = std::make_shared<FieldManager>(grid);
+      fm->registration_begins();
+      fm->registration_ends();
+      for (const auto& it_f : *it.second) {
+        const auto& f = *it_f.second;
+        const auto& fid = f.get_header().get_identifier();
+        const auto& fl  = fid.get_layout();
+        if (fl.rank()==0 or fl.tag(0)!=COL) {
+          fm->add_field(f);
+          continue;
+        }
+        // copy_from_ensemble only handles Real data
+        EKAT_REQUIRE_MSG (fid.data_type()==DataType::RealType,
+            "Error! Ensemble runs only support Real fields with a COL dimension.\n"
+            "  - field name: " + fid.name() + "\n"
+            "  - grid name : " + it.first + "\n"
+            "  - data type : " + e2str(fid.data_type()) + "\n");
+        const auto mfl = fl.clone().reset_dim(0,grid->get_num_local_dofs());
+        Field mf (FieldIdentifier(fid.name(),mfl,fid.get_units(),grid->name(),fid.data_type()));
+        mf.allocate_view();
+        fm->add_field(mf);
+      }
+      m_ensemble_field_mgrs[m][it.first] = fm;
+    }
+  }
+  m_atm_logger->debug("  [EAMxx] Created field managers for " +
+                      std::to_string(m_ensemble_size) + " ensemble members.");
+}
+
+void AtmosphereDriver::update_ensemble_member_fields () const
+{
+  for (int m=0; m<static_cast<int>(m_ensemble_field_mgrs.size()); ++m) {
+    for (const auto& it : m_ensemble_field_mgrs[m]) {
+      for (const auto& it_f : *it.second) {
+        update_ensemble_member_field(m,it.first,it_f.first);
+      }
+    }
+  }
+}
+
+void AtmosphereDriver::update_ensemble_member_fields (const util::TimeStamp& ts) const
+{
+  if (m_ensemble_outputs.empty()) {
+    return;
+  }
+
+  // Several output managers of a member may read the same field: copy it once
+  std::vector<std::map<std::string,std::set<std::string>>> to_copy(m_ensemble_size);
+  for (const auto& eo : m_ensemble_outputs) {
+    if (not eo.om->is_sampling_step(ts)) {
+      continue;
+    }
+    for (const auto& it : eo.fields_names) {
+      to_copy[eo.member][it.first].insert(it.second.begin(),it.second.end());
+    }
+  }
+  for (int m=0; m<m_ensemble_size; ++m) {
+    for (const auto& it : to_copy[m]) {
+      for (const auto& fname : it.second) {
+        update_ensemble_member_field(m,it.first,fname);
+      }
+    }
+  }
+}
+
+void AtmosphereDriver::
+update_ensemble_member_field (const int member, const std::string& grid_name,
+                              const std::string& field_name) const
+{
+  auto& mf = m_ensemble_field_mgrs[member].at(grid_name)->get_field(field_name);
+  const auto& f = m_field_mgrs.at(grid_name)->get_field(field_name);
+  if (mf.get_internal_view_data_unsafe<void>()==f.get_internal_view_data_unsafe<void>()) {
+    // Fields without a COL dimension are shared by all members
+    return;
+  }
+  copy_from_ensemble(f,mf,m_ensemble_size,member);
+  const auto& ts = f.get_header().get_tracking().get_time_stamp();
+  if (ts.is_valid()) {
+    mf.get_header().get_tracking().update_time_stamp(ts);
+  }
+}
+
 void AtmosphereDriver::
 initialize_constant_field(const FieldIdentifier& fid,
                           const ekat::ParameterList& ic_pl)
@@ -1514,8 +1787,16 @@ void AtmosphereDriver::initialize_atm_procs ()
   // Initialize memory buffer for all atm processes
   m_memory_buffer = std::make_shared<ATMBufferManager>();
   m_memory_buffer->request_bytes(m_atm_process_group->requested_buffer_size_in_bytes());
+  int slot = 0;
+  m_atm_process_group->request_scratch_fields(*m_memory_buffer,slot);
   m_memory_buffer->allocate();
   m_atm_process_group->init_buffers(*m_memory_buffer);
+  m_atm_process_group->init_scratch_fields(*m_memory_buffer);
+  if (m_memory_buffer->blocks_naive_bytes()>0) {
+    m_atm_logger->info("[EAMxx::initialize_atm_procs] scratch fields device memory (this rank):\n"
+                       "  - if allocated separately: " + std::to_string(m_memory_buffer->blocks_naive_bytes()/1e6) + "MB\n"
+                       "  - packed in the atm buffer: " + std::to_string(m_memory_buffer->blocks_packed_bytes()/1e6) + "MB");
+  }
 
   const bool restarted_run = m_case_t0 < m_run_t0;
 
@@ -1609,6 +1890,7 @@ void AtmosphereDriver::run (const int dt) {
   // that quantity at the beginning of the timestep. Or they may need to store
   // the timestamp at the beginning of the timestep, so that we can compute
   // dt at the end.
+  update_ensemble_member_fields(m_current_ts+dt);
   for (auto& it : m_output_managers) {
     it.init_timestep(m_current_ts,dt);
   }
@@ -1635,6 +1917,7 @@ void AtmosphereDriver::run (const int dt) {
 
   // Update output streams
   m_atm_logger->debug("[EAMxx::run] running output managers...");
+  update_ensemble_member_fields(m_current_ts);
   for (auto& out_mgr : m_output_managers) {
     out_mgr.run(m_current_ts);
   }
@@ -1669,6 +1952,10 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     out_mgr.finalize();
   }
   m_output_managers.clear();
+  m_output_diags_cache = nullptr;
+  m_ensemble_outputs.clear();
+  m_ensemble_field_mgrs.clear();
+  m_ensemble_grids_mgrs.clear();
 
   // Finalize, and then destroy all atmosphere processes
   if (m_atm_process_group.get()) {
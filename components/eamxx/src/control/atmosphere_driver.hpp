@@ -191,8 +191,24 @@ protected:
                               const std::shared_ptr<const AbstractGrid>& grid,
                               const std::string& file_name,
                               const util::TimeStamp& t0);
+  // Read the input fields from file. In ensemble runs, the file contains
+  // data for one member, which is replicated across all members.
+  void read_fields (const std::string& file_name,
+                    const std::shared_ptr<const AbstractGrid>& grid,
+                    const std::vector<Field>& fields) const;
   void register_groups ();
 
+  // Ensemble runs utilities
+  void apply_ensemble_member_overrides ();
+  void create_ensemble_member_field_mgrs ();
+  // Copy the member columns of the ensemble fields into the member fields. The
+  // first version copies all fields, while the second one only copies the fields
+  // read by the member output managers that sample at time ts.
+  void update_ensemble_member_fields () const;
+  void update_ensemble_member_fields (const util::TimeStamp& ts) const;
+  void update_ensemble_member_field (const int member, const std::string& grid_name,
+                                     const std::string& field_name) const;
+
   std::map<std::string,field_mgr_ptr>       m_field_mgrs;
 
   std::shared_ptr<AtmosphereProcessGroup>   m_atm_process_group;
@@ -203,12 +219,30 @@ protected:
 
   std::list<OutputManager>                  m_output_managers;
 
+  // Diagnostics requested by the output streams, shared across all output managers
+  std::shared_ptr<OutputDiagnosticsCache>   m_output_diags_cache;
+
   std::shared_ptr<ATMBufferManager>         m_memory_buffer;
   std::shared_ptr<SCDataManager>            m_surface_coupling_import_data_manager;
   std::shared_ptr<SCDataManager>            m_surface_coupling_export_data_manager;
 
   std::shared_ptr<IntensiveObservationPeriod> m_iop;
 
+  // Number of ensemble members stacked along the columns of the physics grids,
+  // and, for each member, the grids/field managers storing a copy of its columns
+  // (used for per-member output)
+  int                                              m_ensemble_size = 1;
+  std::vector<std::shared_ptr<GridsManager>>       m_ensemble_grids_mgrs;
+  std::vector<std::map<std::string,field_mgr_ptr>> m_ensemble_field_mgrs;
+
+  // The output managers of each member, and the fields (on each grid) they read
+  struct EnsembleMemberOutput {
+    int                                          member;
+    const OutputManager*                         om;
+    std::map<std::string,std::set<std::string>> fields_names;
+  };
+  std::vector<EnsembleMemberOutput>                m_ensemble_outputs;
+
   // This is the time stamp at the beginning of the time step.
   util::TimeStamp                           m_current_ts;
 
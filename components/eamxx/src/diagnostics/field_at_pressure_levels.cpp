@@ -0,0 +1,291 @@
+#include "diagnostics/field_at_pressure_levels.hpp"
+#include "share/util/scream_universal_constants.hpp"
+
+#include "ekat/std_meta/ekat_std_utils.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+#include "ekat/util/ekat_upper_bound.hpp"
+#include "ekat/util/ekat_units.hpp"
+
+namespace scream
+{
+
+// =========================================================================================
+FieldAtPressureLevels::
+FieldAtPressureLevels (const ekat::Comm& comm, const ekat::ParameterList& params)
+ : AtmosphereDiagnostic(comm,params)
+{
+  m_field_name = m_params.get<std::string>("field_name");
+
+  // Figure out the pressure values. The expected format is plevs_N1_N2_..._Nkxyz
+  m_location = m_params.get<std::string>("vertical_location");
+  auto tokens = ekat::split(m_location,"_");
+  EKAT_REQUIRE_MSG (tokens.size()>=2 && tokens.front()=="plevs",
+      "Error! Invalid string for pressure values for FieldAtPressureLevels.\n"
+      " - input string   : " + m_location + "\n"
+      " - expected format: plevs_N1_N2_..._Nkxyz, with N1,...,Nk numbers, and xyz='mb', 'hPa', or 'Pa'\n");
+  auto& last = tokens.back();
+  auto chars_start = last.find_first_not_of("0123456789.");
+  EKAT_REQUIRE_MSG (chars_start!=0 && chars_start!=std::string::npos,
+      "Error! Invalid string for pressure values for FieldAtPressureLevels.\n"
+      " - input string   : " + m_location + "\n"
+      " - expected format: plevs_N1_N2_..._Nkxyz, with N1,...,Nk numbers, and xyz='mb', 'hPa', or 'Pa'\n");
+  const auto units = last.substr(chars_start);
+  EKAT_REQUIRE_MSG (units=="mb" or units=="hPa" or units=="Pa",
+      "Error! Invalid string for pressure values for FieldAtPressureLevels.\n"
+      " - input string   : " + m_location + "\n"
+      " - expected format: plevs_N1_N2_..._Nkxyz, with N1,...,Nk numbers, and xyz='mb', 'hPa', or 'Pa'\n");
+  last = last.substr(0,chars_start);
+
+  // Convert pressure levels to Pa, the units of pressure in the simulation
+  const Real fact = (units=="mb" || units=="hPa") ? 100 : 1;
+  for (size_t i=1; i<tokens.size(); ++i) {
+    EKAT_REQUIRE_MSG (tokens[i].size()>0 && tokens[i].find_first_not_of("0123456789.")==std::string::npos,
+        "Error! Invalid string for pressure values for FieldAtPressureLevels.\n"
+        " - input string   : " + m_location + "\n"
+        " - expected format: plevs_N1_N2_..._Nkxyz, with N1,...,Nk numbers, and xyz='mb', 'hPa', or 'Pa'\n");
+    m_pressure_levels.push_back(std::stod(tokens[i])*fact);
+  }
+
+  m_mask_val = m_params.get<double>("mask_value",Real(constants::DefaultFillValue<float>::value));
+
+  m_diag_name = m_field_name + "_at_" + m_location;
+}
+
+FieldAtPressureLevels::~FieldAtPressureLevels ()
+{
+  // The interp data may be shared with diags that outlive this one
+  if (m_interp_data) {
+    m_interp_data->clients.erase(this);
+  }
+}
+
+void FieldAtPressureLevels::
+set_grids (const std::shared_ptr<const GridsManager> grids_manager)
+{
+  const auto& gname = m_params.get<std::string>("grid_name");
+  add_field<Required>(m_field_name,gname);
+
+  // We don't know yet which one we need
+  add_field<Required>("p_mid",gname);
+  add_field<Required>("p_int",gname);
+}
+
+void FieldAtPressureLevels::
+initialize_impl (const RunType /*run_type*/)
+{
+  const auto& f = get_field_in(m_field_name);
+  const auto& fid = f.get_header().get_identifier();
+
+  // Sanity checks
+  using namespace ShortFieldTagsNames;
+  const auto& layout = fid.get_layout();
+  EKAT_REQUIRE_MSG (layout.rank()==2,
+      "Error! FieldAtPressureLevels only supports scalar fields.\n"
+      "  The pressure levels are stored along a CMP dimension, so the output of a\n"
+      "  vector field would have two CMP dimensions. Use FieldAtPressureLevel instead.\n"
+      " - field name: " + fid.name() + "\n"
+      " - field layout: " + layout.to_string() + "\n");
+  const auto tag = layout.tags().back();
+  EKAT_REQUIRE_MSG (tag==LEV || tag==ILEV,
+      "Error! FieldAtPressureLevels diagnostic expects a layout ending with 'LEV'/'ILEV' tag.\n"
+      " - field name  : " + fid.name() + "\n"
+      " - field layout: " + layout.to_string() + "\n");
+
+  // All good, create the diag output. The pressure levels dimension is named
+  // after the location, so that different sets of levels yield different dims
+  const int nplevs = m_pressure_levels.size();
+  auto d_layout = layout.clone().strip_dim(tag).append_dim(CMP,nplevs,m_location);
+  FieldIdentifier d_fid (m_diag_name,d_layout,fid.get_units(),fid.get_grid_name());
+  m_diagnostic_output = Field(d_fid);
+  m_diagnostic_output.allocate_view();
+
+  m_pressure_name = tag==LEV ? "p_mid" : "p_int";
+  auto num_cols = layout.dims().front();
+
+  // Add a field representing the mask as extra data to the diagnostic field.
+  auto nondim = ekat::units::Units::nondimensional();
+  const auto& gname = fid.get_grid_name();
+
+  std::string mask_name = name() + " mask";
+  FieldLayout mask_layout( {COL,CMP}, {num_cols,nplevs}, {e2str(COL),m_location});
+  FieldIdentifier mask_fid (mask_name,mask_layout, nondim, gname);
+  Field diag_mask(mask_fid);
+  diag_mask.allocate_view();
+  m_diagnostic_output.get_header().set_extra_data("mask_data",diag_mask);
+  m_diagnostic_output.get_header().set_extra_data("mask_value",m_mask_val);
+
+  using stratts_t = std::map<std::string,std::string>;
+
+  // Propagate any io string attribute from input field to diag field
+  const auto& src = get_fields_in().front();
+  const auto& src_atts = src.get_header().get_extra_data<stratts_t>("io: string attributes");
+        auto& dst_atts = m_diagnostic_output.get_header().get_extra_data<stratts_t>("io: string attributes");
+  for (const auto& [name, val] : src_atts) {
+    dst_atts[name] = val;
+  }
+
+  // Get the interpolation data from another diag with the same pressure field
+  // and pressure levels, or create it if this is the first such diag. If the
+  // shared data was built for another field with the same name and grid
+  // (e.g., from a different field manager), replace it: the diags using the
+  // old data keep it alive.
+  const auto& p = get_field_in(m_pressure_name);
+  const auto key = "FieldAtPressureLevels@" + p.name() + "@" + gname + "@" + m_location;
+  if (m_shared_data and m_shared_data->count(key)==1) {
+    m_interp_data = std::static_pointer_cast<InterpData>(m_shared_data->at(key));
+  }
+  if (m_interp_data==nullptr or not m_interp_data->p.equivalent(p)) {
+    const auto nlevs = p.get_header().get_identifier().get_layout().dims().back();
+    EKAT_REQUIRE_MSG (nlevs>1,
+        "Error! FieldAtPressureLevels requires at least two vertical levels.\n");
+    m_interp_data = std::make_shared<InterpData>();
+    m_interp_data->p = p;
+    m_interp_data->p_tgt = KT::view_1d<Real>("p_tgt",nplevs);
+    m_interp_data->k = KT::view_2d<int>("k",num_cols,nplevs);
+    m_interp_data->w = KT::view_2d<Real>("w",num_cols,nplevs);
+    auto p_tgt_h = Kokkos::create_mirror_view(m_interp_data->p_tgt);
+    for (int ip=0; ip<nplevs; ++ip) {
+      p_tgt_h(ip) = m_pressure_levels[ip];
+    }
+    Kokkos::deep_copy(m_interp_data->p_tgt,p_tgt_h);
+    if (m_shared_data) {
+      (*m_shared_data)[key] = m_interp_data;
+    }
+  }
+
+  // Register this diag among the users of the interp data
+  auto& clients = m_interp_data->clients;
+  clients[this] = Client{f,m_diagnostic_output,diag_mask,m_mask_val,{},{}};
+  if (m_interp_data->d_clients.extent_int(0)<static_cast<int>(clients.size())) {
+    m_interp_data->d_clients = decltype(m_interp_data->d_clients)("clients",clients.size());
+    m_interp_data->h_clients = Kokkos::create_mirror_view(m_interp_data->d_clients);
+  }
+}
+
+// =========================================================================================
+void FieldAtPressureLevels::compute_interp_data()
+{
+  const Field& p_src = get_field_in(m_pressure_name);
+  const auto p_src_v = p_src.get_view<const Real**>();
+  const auto& pl = p_src.get_header().get_identifier().get_layout();
+  const int ncols = pl.dim(0);
+  const int nlevs = pl.dim(1);
+
+  const auto p_tgt = m_interp_data->p_tgt;
+  const auto k     = m_interp_data->k;
+  const auto w     = m_interp_data->w;
+  const int nplevs = p_tgt.extent(0);
+
+  auto policy = KT::RangePolicy(0,ncols*nplevs);
+  Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+    const int icol = idx / nplevs;
+    const int ip   = idx % nplevs;
+    auto x1 = ekat::subview(p_src_v,icol);
+    auto beg = x1.data();
+    auto end = beg + nlevs;
+    auto last = beg + (nlevs-1);
+    const auto p = p_tgt(ip);
+    if (p<*beg or p>*last) {
+      k(icol,ip) = -1;
+      w(icol,ip) = 0;
+    } else {
+      int k1 = ekat::upper_bound(beg,end,p) - beg;
+      // Corner cases: p==x1(0) or p==x1(nlevs-1)
+      k1 = k1==0 ? 1 : (k1==nlevs ? nlevs-1 : k1);
+      k(icol,ip) = k1;
+      w(icol,ip) = (p-x1(k1-1)) / (x1(k1) - x1(k1-1));
+    }
+  });
+
+  m_interp_data->p_ts = p_src.get_header().get_tracking().get_time_stamp();
+}
+
+void FieldAtPressureLevels::compute_clients(const std::vector<Client*>& out_of_date)
+{
+  auto& data = *m_interp_data;
+  const int nclients = out_of_date.size();
+  for (int i=0; i<nclients; ++i) {
+    auto& c = *out_of_date[i];
+    const auto f_v    = c.f.get_view<const Real**>();
+    const auto diag_v = c.diag.get_view<Real**>();
+    const auto mask_v = c.mask.get_view<Real**>();
+    auto& ptrs = data.h_clients(i);
+    ptrs.f            = f_v.data();
+    ptrs.f_strides[0] = f_v.stride(0);
+    ptrs.f_strides[1] = f_v.stride(1);
+    ptrs.diag         = diag_v.data();
+    ptrs.mask         = mask_v.data();
+    ptrs.d_stride     = diag_v.stride(0);
+    ptrs.mask_val     = c.mask_val;
+
+    c.f_ts = c.f.get_header().get_tracking().get_time_stamp();
+    c.p_ts = data.p_ts;
+  }
+  Kokkos::deep_copy(data.d_clients,data.h_clients);
+
+  const auto k = data.k;
+  const auto w = data.w;
+  const auto clients = data.d_clients;
+  const int ncols  = k.extent(0);
+  const int nplevs = k.extent(1);
+
+  // Each thread loads the bracketing index and weight once, and applies them
+  // to all the fields
+  auto policy = KT::RangePolicy(0,ncols*nplevs);
+  Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+    const int icol = idx / nplevs;
+    const int ip   = idx % nplevs;
+    const int  k1 = k(icol,ip);
+    const Real wi = w(icol,ip);
+    for (int ic=0; ic<nclients; ++ic) {
+      const auto& c = clients(ic);
+      const int id = icol*c.d_stride + ip;
+      if (k1<0) {
+        c.diag[id] = c.mask_val;
+        c.mask[id] = 0;
+      } else {
+        const Real* y = c.f + icol*c.f_strides[0];
+        const Real y0 = y[(k1-1)*c.f_strides[1]];
+        const Real y1 = y[k1*c.f_strides[1]];
+        c.diag[id] = y0 + wi*(y1-y0);
+        c.mask[id] = 1;
+      }
+    }
+  });
+}
+
+void FieldAtPressureLevels::compute_diagnostic_impl()
+{
+  // A valid time stamp tells whether a field changed since the last
+  // computation. Without it, assume it did.
+  auto changed = [](const util::TimeStamp& old_ts, const util::TimeStamp& new_ts) {
+    return not new_ts.is_valid() or new_ts!=old_ts;
+  };
+
+  auto& data = *m_interp_data;
+  const auto& p_ts = get_field_in(m_pressure_name).get_header().get_tracking().get_time_stamp();
+  if (changed(data.p_ts,p_ts)) {
+    compute_interp_data();
+  }
+
+  // If another diag already computed our output for the current input
+  // and pressure, there is nothing to do
+  const auto& me = data.clients.at(this);
+  if (not changed(me.f_ts,me.f.get_header().get_tracking().get_time_stamp()) and
+      not changed(me.p_ts,data.p_ts)) {
+    return;
+  }
+
+  // Compute the output of all the diags that are out of date
+  std::vector<Client*> out_of_date;
+  for (auto& it : data.clients) {
+    auto& c = it.second;
+    if (changed(c.f_ts,c.f.get_header().get_tracking().get_time_stamp()) or
+        changed(c.p_ts,data.p_ts)) {
+      out_of_date.push_back(&c);
+    }
+  }
+  compute_clients(out_of_date);
+}
+
+} //namespace scream
@@ -0,0 +1,112 @@
+#ifndef EAMXX_FIELD_AT_PRESSURE_LEVELS_HPP
+#define EAMXX_FIELD_AT_PRESSURE_LEVELS_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include <map>
+
+namespace scream
+{
+
+/*
+ * This diagnostic will produce slices of a field at a set of pressure levels,
+ * stacked along a new dimension. E.g., T_mid_at_plevs_1000_850_500hPa is a
+ * (COL,plevs) field, with the slices of T_mid at 1000hPa, 850hPa, and 500hPa.
+ * Only scalar fields (COL,LEV) or (COL,ILEV) are supported, since the levels
+ * dimension is a CMP dimension; for vector fields, use FieldAtPressureLevel.
+ *
+ * The interpolation indices and weights only depend on the pressure field and
+ * on the set of pressure levels, so they are computed once for all diags that
+ * share the same pressure field and levels (e.g., T_mid_at_plevs_X and
+ * qv_at_plevs_X), and only recomputed when the time stamp of pressure changes.
+ * The first of these diags to be computed also computes the outputs of all the
+ * others in the same kernel launch. The data is shared only among diags with
+ * the same shared data storage (see AtmosphereDiagnostic::set_shared_data).
+ */
+
+class FieldAtPressureLevels : public AtmosphereDiagnostic
+{
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+
+  // Device-side description of a diag sharing the interp data:
+  //   f(icol,k)     = f[icol*f_strides[0]+k*f_strides[1]]
+  //   diag(icol,ip) = diag[icol*d_stride+ip]  (same for mask)
+  struct ClientPtrs {
+    const Real* f;
+    int         f_strides[2];
+    Real*       diag;
+    Real*       mask;
+    int         d_stride;
+    Real        mask_val;
+  };
+
+  // A diag sharing the interp data, with the time stamps of the input
+  // field and of pressure when its output was last computed
+  struct Client {
+    Field             f;
+    Field             diag;
+    Field             mask;
+    Real              mask_val;
+    util::TimeStamp   f_ts;
+    util::TimeStamp   p_ts;
+  };
+
+  // Interpolation data shared among all diags with same pressure and levels.
+  // Each diag registers itself as a client, and unregisters upon destruction.
+  // For each column and target level, the target pressure is between the
+  // source levels k-1 and k, and the interpolated value is
+  //   y(k-1) + w*(y(k)-y(k-1))
+  // If the target pressure is out of bounds, k<0.
+  struct InterpData {
+    Field               p;
+    KT::view_1d<Real>   p_tgt;
+    KT::view_2d<int>    k;
+    KT::view_2d<Real>   w;
+
+    util::TimeStamp     p_ts;
+
+    std::map<const FieldAtPressureLevels*,Client> clients;
+    KT::view_1d<ClientPtrs>                 d_clients;
+    KT::view_1d<ClientPtrs>::HostMirror     h_clients;
+  };
+
+  // Constructors
+  FieldAtPressureLevels (const ekat::Comm& comm, const ekat::ParameterList& params);
+
+  ~FieldAtPressureLevels ();
+
+  // The name of the diagnostic
+  std::string name () const { return m_diag_name; }
+
+  // Set the grid
+  void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
+
+  // The interpolation data, possibly shared with other diags
+  std::shared_ptr<const InterpData> get_interp_data () const { return m_interp_data; }
+
+protected:
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  void compute_diagnostic_impl ();
+  void compute_interp_data ();
+  void compute_clients (const std::vector<Client*>& out_of_date);
+protected:
+  void initialize_impl (const RunType /*run_type*/);
+
+  std::string         m_pressure_name;
+  std::string         m_field_name;
+  std::string         m_diag_name;
+  std::string         m_location;
+
+  std::vector<Real>   m_pressure_levels;
+  Real                m_mask_val;
+
+  std::shared_ptr<InterpData> m_interp_data;
+}; // class FieldAtPressureLevels
+
+} //namespace scream
+
+#endif // EAMXX_FIELD_AT_PRESSURE_LEVELS_HPP
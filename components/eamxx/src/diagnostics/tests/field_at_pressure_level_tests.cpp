@@ -3,6 +3,7 @@
 #include "ekat/ekat_pack_utils.hpp"
 
 #include "diagnostics/field_at_pressure_level.hpp"
+#include "diagnostics/field_at_pressure_levels.hpp"
 
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/field/field_utils.hpp"
@@ -33,6 +34,17 @@ bool approx(const T a, const T b) {
   return std::abs(a-b)<=eps; 
 }
 
+template<typename T>
+bool approx_rel(const T a, const T b) {
+  // FieldAtPressureLevels computes the interpolation weights separately from
+  // the values, so allow a few ulps of the magnitude of the values
+  const Real tol = 10*std::numeric_limits<Real>::epsilon()*std::max(std::abs(a),std::abs(b));
+  if (std::abs(a-b)>tol) {
+    printf("approx_rel violated with std::abs(%e - %e) = %e > %e\n",a,b,std::abs(a-b),tol);
+  }
+  return std::abs(a-b)<=tol;
+}
+
 struct PressureBnds
 {
   Real p_top  = 10000.0;  //  100mb
@@ -45,6 +57,11 @@ get_test_fm(std::shared_ptr<const AbstractGrid> grid);
 std::shared_ptr<FieldAtPressureLevel>
 get_test_diag(const ekat::Comm& comm, std::shared_ptr<const FieldManager> fm, std::shared_ptr<const GridsManager> gm, const std::string& type, const Real plevel);
 
+std::shared_ptr<FieldAtPressureLevels>
+get_test_plevs_diag(const ekat::Comm& comm, std::shared_ptr<const FieldManager> fm, std::shared_ptr<const GridsManager> gm,
+                    const std::string& fname, const std::vector<Real>& plevels,
+                    const std::shared_ptr<DiagnosticsSharedData>& shared_data);
+
 Real get_test_pres(const int col, const int lev, const int num_lev, const int num_cols);
 Real get_test_data(const Real pres);
 
@@ -138,6 +155,121 @@ TEST_CASE("field_at_pressure_level_p2")
   } 
   
 } // TEST_CASE("field_at_pressure_level")
+
+TEST_CASE("field_at_pressure_levels")
+{
+  // Get an MPI comm group for test
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Create a grids manager w/ a point grid
+  int ncols = 3;
+  int nlevs = 10;
+  auto gm   = create_gm(comm,ncols,nlevs);
+
+  // Create a field manager for testing
+  auto grid = gm->get_grid("Point Grid");
+  auto fm   = get_test_fm(grid);
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Random values to be used in test
+  PressureBnds pressure_bounds;
+  auto engine = scream::setup_random_test(&comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  Real p_mid_bnds_dz = pressure_bounds.p_surf/nlevs;  // Note, p_mid will actually never make it to p_top or p_surf in all columns, so we offset the bounds.
+  RPDF pdf_pmid(pressure_bounds.p_top+p_mid_bnds_dz,pressure_bounds.p_surf-p_mid_bnds_dz);
+
+  // Two random levels inside the domain, and one outside
+  const std::vector<Real> plevels = {std::round(pdf_pmid(engine)),
+                                     std::round(pdf_pmid(engine)),
+                                     pressure_bounds.p_surf*2};
+  const int nplevs = plevels.size();
+
+  // Diags at the same levels of fields defined at midpoints share the interp data.
+  // Diags of fields at interfaces, or at different levels, or with a different
+  // shared data storage, do not.
+  auto shared_data = std::make_shared<DiagnosticsSharedData>();
+  auto diag_v  = get_test_plevs_diag(comm, fm, gm, "V_mid", plevels, shared_data);
+  auto diag_p  = get_test_plevs_diag(comm, fm, gm, "p_mid", plevels, shared_data);
+  auto diag_vi = get_test_plevs_diag(comm, fm, gm, "V_int", plevels, shared_data);
+  auto diag_v1 = get_test_plevs_diag(comm, fm, gm, "V_mid", {plevels[0]}, shared_data);
+  auto diag_vu = get_test_plevs_diag(comm, fm, gm, "V_mid", plevels, nullptr);
+  for (auto diag : {diag_v, diag_p, diag_vi, diag_v1, diag_vu}) {
+    diag->initialize(t0,RunType::Initial);
+  }
+  REQUIRE (diag_v->get_interp_data()==diag_p->get_interp_data());
+  REQUIRE (diag_v->get_interp_data()!=diag_vi->get_interp_data());
+  REQUIRE (diag_v->get_interp_data()!=diag_v1->get_interp_data());
+  REQUIRE (diag_v->get_interp_data()!=diag_vu->get_interp_data());
+  REQUIRE (diag_v->get_interp_data()->clients.size()==2);
+
+  // A diag unregisters from the interp data when destroyed
+  {
+    auto diag_tmp = get_test_plevs_diag(comm, fm, gm, "V_mid", plevels, shared_data);
+    diag_tmp->initialize(t0,RunType::Initial);
+    REQUIRE (diag_v->get_interp_data()->clients.size()==3);
+  }
+  REQUIRE (diag_v->get_interp_data()->clients.size()==2);
+
+  auto diag_v_f = diag_v->get_diagnostic();
+  auto diag_p_f = diag_p->get_diagnostic();
+  REQUIRE (diag_v_f.get_header().get_identifier().get_layout().dims()==std::vector<int>{ncols,nplevs});
+
+  auto check = [&](const Field& diag_f, const Real offset, const bool is_p) {
+    diag_f.sync_to_host();
+    auto diag_h = diag_f.get_view<const Real**, Host>();
+    auto mask_f = diag_f.get_header().get_extra_data<Field>("mask_data");
+    mask_f.sync_to_host();
+    auto mask_h = mask_f.get_view<const Real**, Host>();
+    auto mask_val = diag_f.get_header().get_extra_data<Real>("mask_value");
+    for (int icol=0;icol<ncols;icol++) {
+      for (int ip=0;ip<nplevs-1;ip++) {
+        const Real tgt = is_p ? plevels[ip] : get_test_data(plevels[ip])+offset;
+        REQUIRE(approx_rel(diag_h(icol,ip),tgt));
+        REQUIRE(approx(mask_h(icol,ip),Real(1.0)));
+      }
+      REQUIRE(approx(diag_h(icol,nplevs-1),Real(mask_val)));
+      REQUIRE(approx(mask_h(icol,nplevs-1),Real(0.0)));
+    }
+  };
+
+  // Computing one diag also computes the other diag sharing the interp data
+  diag_v->compute_diagnostic();
+  check(diag_v_f,0,false);
+  check(diag_p_f,0,true);
+  diag_p->compute_diagnostic();
+  check(diag_p_f,0,true);
+
+  // The slices match the single-level diag
+  for (int ip=0;ip<nplevs;ip++) {
+    auto diag = get_test_diag(comm, fm, gm, "mid", plevels[ip]);
+    diag->initialize(t0,RunType::Initial);
+    diag->compute_diagnostic();
+    auto diag_f = diag->get_diagnostic();
+    diag_f.sync_to_host();
+    auto single_h = diag_f.get_view<const Real*, Host>();
+    auto multi_h = diag_v_f.get_view<const Real**, Host>();
+    for (int icol=0;icol<ncols;icol++) {
+      REQUIRE(approx_rel(multi_h(icol,ip),single_h(icol)));
+    }
+  }
+
+  // Update V_mid only: the p_mid diag is still up to date, while the V_mid
+  // diag is recomputed (reusing the interp data)
+  auto v = fm->get_field("V_mid");
+  v.sync_to_host();
+  auto v_h = v.get_view<Real**,Host>();
+  for (int icol=0;icol<ncols;icol++) {
+    for (int k=0;k<nlevs;k++) {
+      v_h(icol,k) += 1;
+    }
+  }
+  v.sync_to_dev();
+  v.get_header().get_tracking().update_time_stamp(t0+60);
+  diag_p->compute_diagnostic();
+  check(diag_p_f,0,true);
+  diag_v->compute_diagnostic();
+  check(diag_v_f,1,false);
+} // TEST_CASE("field_at_pressure_levels")
 /*==========================================================================================================*/
 std::shared_ptr<FieldManager> get_test_fm(std::shared_ptr<const AbstractGrid> grid)
 {
@@ -234,6 +366,31 @@ get_test_diag(const ekat::Comm& comm, std::shared_ptr<const FieldManager> fm, st
     return diag;
 }
 /*===================================================================================================*/
+std::shared_ptr<FieldAtPressureLevels>
+get_test_plevs_diag(const ekat::Comm& comm, std::shared_ptr<const FieldManager> fm, std::shared_ptr<const GridsManager> gm,
+                    const std::string& fname, const std::vector<Real>& plevels,
+                    const std::shared_ptr<DiagnosticsSharedData>& shared_data)
+{
+    std::string location = "plevs";
+    for (auto p : plevels) {
+      location += "_" + std::to_string(static_cast<long long>(p));
+    }
+    location += "Pa";
+
+    ekat::ParameterList params;
+    params.set("field_name",fname);
+    params.set("grid_name",fm->get_grid()->name());
+    params.set("vertical_location",location);
+    auto diag = std::make_shared<FieldAtPressureLevels>(comm,params);
+    diag->set_shared_data(shared_data);
+    diag->set_grids(gm);
+    for (const auto& req : diag->get_required_field_requests()) {
+      auto req_field = fm->get_field(req.fid);
+      diag->set_required_field(req_field);
+    }
+    return diag;
+}
+/*===================================================================================================*/
 Real get_test_pres(const int col, const int lev, const int num_lev, const int num_cols)
 {
   PressureBnds pressure_bounds;
@@ -29,6 +29,28 @@ namespace scream {
         inline void finalize() {
             cosp_c2f_final();
         };
+        // LayoutLeft host views, used to permute the data for the F90 code.
+        // They can be allocated once and reused across calls to main.
+        struct LayoutLeftViews {
+            LayoutLeftViews () = default;
+            LayoutLeftViews (const Int ncol, const Int nlay, const Int ntau, const Int nctp, const Int ncth)
+             : T_mid("T_mid_h", ncol, nlay), p_mid("p_mid_h", ncol, nlay), p_int("p_int_h", ncol, nlay+1)
+             , z_mid("z_mid_h", ncol, nlay), qv("qv_h", ncol, nlay), qc("qc_h", ncol, nlay), qi("qi_h", ncol, nlay)
+             , cldfrac("cldfrac_h", ncol, nlay)
+             , reff_qc("reff_qc_h", ncol, nlay), reff_qi("reff_qi_h", ncol, nlay)
+             , dtau067("dtau_067_h", ncol, nlay), dtau105("dtau105_h", ncol, nlay)
+             , isccp_ctptau("isccp_ctptau_h", ncol, ntau, nctp)
+             , modis_ctptau("modis_ctptau_h", ncol, ntau, nctp)
+             , misr_cthtau("misr_cthtau_h", ncol, ntau, ncth)
+            {}
+
+            lview_host_2d T_mid, p_mid, p_int, z_mid, qv, qc, qi, cldfrac,
+                          reff_qc, reff_qi, dtau067, dtau105;
+            lview_host_3d isccp_ctptau, modis_ctptau, misr_cthtau;
+        };
+
+        // Same as below, but uses the pre-allocated LayoutLeft views in lv, so that
+        // no Kokkos view is allocated (e.g., when called from a non-Kokkos thread)
         inline void main(
                 const Int ncol, const Int nsubcol, const Int nlay, const Int ntau, const Int nctp, const Int ncth, const Real emsfc_lw,
                 view_1d<const Real>& sunlit , view_1d<const Real>& skt,
@@ -37,38 +59,28 @@ namespace scream {
                 view_2d<const Real>& cldfrac,
                 view_2d<const Real>& reff_qc, view_2d<const Real>& reff_qi,
                 view_2d<const Real>& dtau067, view_2d<const Real>& dtau105,
-                view_1d<Real>& isccp_cldtot , view_3d<Real>& isccp_ctptau, view_3d<Real>& modis_ctptau, view_3d<Real>& misr_cthtau) {
-
-            // Make host copies and permute data as needed
-            lview_host_2d
-                  T_mid_h("T_mid_h", ncol, nlay), p_mid_h("p_mid_h", ncol, nlay), p_int_h("p_int_h", ncol, nlay+1),
-                  z_mid_h("z_mid_h", ncol, nlay), qv_h("qv_h", ncol, nlay), qc_h("qc_h", ncol, nlay), qi_h("qi_h", ncol, nlay),
-                  cldfrac_h("cldfrac_h", ncol, nlay),
-                  reff_qc_h("reff_qc_h", ncol, nlay), reff_qi_h("reff_qi_h", ncol, nlay),
-                  dtau067_h("dtau_067_h", ncol, nlay), dtau105_h("dtau105_h", ncol, nlay);
-            lview_host_3d isccp_ctptau_h("isccp_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d modis_ctptau_h("modis_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d misr_cthtau_h("misr_cthtau_h", ncol, ntau, ncth);
+                view_1d<Real>& isccp_cldtot , view_3d<Real>& isccp_ctptau, view_3d<Real>& modis_ctptau, view_3d<Real>& misr_cthtau,
+                const LayoutLeftViews& lv) {
 
             // Copy to layoutLeft host views
             for (int i = 0; i < ncol; i++) {
                 for (int j = 0; j < nlay; j++) {
-                    T_mid_h(i,j) = T_mid(i,j);
-                    p_mid_h(i,j) = p_mid(i,j);
-                    z_mid_h(i,j) = z_mid(i,j);
-                    qv_h(i,j) = qv(i,j);
-                    qc_h(i,j) = qc(i,j);
-                    qi_h(i,j) = qi(i,j);
-                    cldfrac_h(i,j) = cldfrac(i,j);
-                    reff_qc_h(i,j) = reff_qc(i,j);
-                    reff_qi_h(i,j) = reff_qi(i,j);
-                    dtau067_h(i,j) = dtau067(i,j);
-                    dtau105_h(i,j) = dtau105(i,j);
+                    lv.T_mid(i,j) = T_mid(i,j);
+                    lv.p_mid(i,j) = p_mid(i,j);
+                    lv.z_mid(i,j) = z_mid(i,j);
+                    lv.qv(i,j) = qv(i,j);
+                    lv.qc(i,j) = qc(i,j);
+                    lv.qi(i,j) = qi(i,j);
+                    lv.cldfrac(i,j) = cldfrac(i,j);
+                    lv.reff_qc(i,j) = reff_qc(i,j);
+                    lv.reff_qi(i,j) = reff_qi(i,j);
+                    lv.dtau067(i,j) = dtau067(i,j);
+                    lv.dtau105(i,j) = dtau105(i,j);
                 }
             }
             for (int i = 0; i < ncol; i++) {
                 for (int j = 0; j < nlay+1; j++) {
-                    p_int_h(i,j) = p_int(i,j);
+                    lv.p_int(i,j) = p_int(i,j);
                 }
             }
 
@@ -76,24 +88,41 @@ namespace scream {
 
             // Call COSP wrapper
             cosp_c2f_run(ncol, nsubcol, nlay, ntau, nctp, ncth,
-                    emsfc_lw, sunlit.data(), skt.data(), T_mid_h.data(), p_mid_h.data(), p_int_h.data(),
-                    z_mid_h.data(), qv_h.data(), qc_h.data(), qi_h.data(),
-                    cldfrac_h.data(), reff_qc_h.data(), reff_qi_h.data(), dtau067_h.data(), dtau105_h.data(),
-                    isccp_cldtot.data(), isccp_ctptau_h.data(), modis_ctptau_h.data(), misr_cthtau_h.data());
+                    emsfc_lw, sunlit.data(), skt.data(), lv.T_mid.data(), lv.p_mid.data(), lv.p_int.data(),
+                    lv.z_mid.data(), lv.qv.data(), lv.qc.data(), lv.qi.data(),
+                    lv.cldfrac.data(), lv.reff_qc.data(), lv.reff_qi.data(), lv.dtau067.data(), lv.dtau105.data(),
+                    isccp_cldtot.data(), lv.isccp_ctptau.data(), lv.modis_ctptau.data(), lv.misr_cthtau.data());
 
             // Copy outputs back to layoutRight views
             for (int i = 0; i < ncol; i++) {
                 for (int j = 0; j < ntau; j++) {
                     for (int k = 0; k < nctp; k++) {
-                        isccp_ctptau(i,j,k) = isccp_ctptau_h(i,j,k);
-                        modis_ctptau(i,j,k) = modis_ctptau_h(i,j,k);
+                        isccp_ctptau(i,j,k) = lv.isccp_ctptau(i,j,k);
+                        modis_ctptau(i,j,k) = lv.modis_ctptau(i,j,k);
                     }
                     for (int k = 0; k < ncth; k++) {
-                        misr_cthtau(i,j,k) = misr_cthtau_h(i,j,k);
+                        misr_cthtau(i,j,k) = lv.misr_cthtau(i,j,k);
                     }
                 }
             }
         }
+
+        inline void main(
+                const Int ncol, const Int nsubcol, const Int nlay, const Int ntau, const Int nctp, const Int ncth, const Real emsfc_lw,
+                view_1d<const Real>& sunlit , view_1d<const Real>& skt,
+                view_2d<const Real>& T_mid  , view_2d<const Real>& p_mid  , view_2d<const Real>& p_int,
+                view_2d<const Real>& z_mid  , view_2d<const Real>& qv     , view_2d<const Real>& qc     , view_2d<const Real>& qi,
+                view_2d<const Real>& cldfrac,
+                view_2d<const Real>& reff_qc, view_2d<const Real>& reff_qi,
+                view_2d<const Real>& dtau067, view_2d<const Real>& dtau105,
+                view_1d<Real>& isccp_cldtot , view_3d<Real>& isccp_ctptau, view_3d<Real>& modis_ctptau, view_3d<Real>& misr_cthtau) {
+
+            // Make host copies and permute data as needed
+            LayoutLeftViews lv(ncol, nlay, ntau, nctp, ncth);
+            main(ncol, nsubcol, nlay, ntau, nctp, ncth, emsfc_lw, sunlit, skt,
+                 T_mid, p_mid, p_int, z_mid, qv, qc, qi, cldfrac, reff_qc, reff_qi, dtau067, dtau105,
+                 isccp_cldtot, isccp_ctptau, modis_ctptau, misr_cthtau, lv);
+        }
     }
 }
 #endif  /* SCREAM_COSP_FUNCTIONS_HPP */
@@ -25,6 +25,17 @@ Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
 
   // How many subcolumns to use for COSP
   m_num_subcols = m_params.get<Int>("cosp_subcolumns", 10);
+
+  // Whether to run COSP off the critical path
+  m_async = m_params.get<bool>("cosp_async", false);
+
+  // In async mode, a restart must redo the COSP computation that was pending
+  // when the restart file was written (see initialize_impl)
+  if (m_async) {
+    ekat::any has_pending_outputs;
+    has_pending_outputs.reset<int>(0);
+    m_restart_extra_data["cosp_has_pending_outputs"] = has_pending_outputs;
+  }
 }
 
 // =========================================================================================
@@ -93,10 +104,35 @@ void Cosp::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
   add_field<Computed>("modis_ctptau", scalar4d_ctptau, percent, grid_name, 1);
   add_field<Computed>("misr_cthtau", scalar4d_cthtau, percent, grid_name, 1);
   add_field<Computed>("cosp_sunlit", scalar2d, nondim, grid_name);
+
+  // In async mode, COSP runs on a snapshot of the inputs taken at the COSP step.
+  // The snapshot fields are internal fields, so that they are restarted.
+  if (m_async) {
+    auto add_snapshot = [&](const std::string& name, const FieldLayout& layout, const Units& u) {
+      Field f(FieldIdentifier("cosp_snapshot_" + name,layout,u,grid_name));
+      f.allocate_view();
+      add_internal_field(f);
+      m_inputs_snapshot[name] = f;
+    };
+    add_snapshot("surf_radiative_T", scalar2d,     K);
+    add_snapshot("sunlit",           scalar2d,     nondim);
+    add_snapshot("p_mid",            scalar3d_mid, Pa);
+    add_snapshot("p_int",            scalar3d_int, Pa);
+    add_snapshot("T_mid",            scalar3d_mid, K);
+    add_snapshot("z_mid",            scalar3d_mid, m);
+    add_snapshot("qv",               scalar3d_mid, kg/kg);
+    add_snapshot("qc",               scalar3d_mid, kg/kg);
+    add_snapshot("qi",               scalar3d_mid, kg/kg);
+    add_snapshot("cldfrac_rad",      scalar3d_mid, nondim);
+    add_snapshot("dtau067",          scalar3d_mid, nondim);
+    add_snapshot("dtau105",          scalar3d_mid, nondim);
+    add_snapshot("eff_radius_qc",    scalar3d_mid, micron);
+    add_snapshot("eff_radius_qi",    scalar3d_mid, micron);
+  }
 }
 
 // =========================================================================================
-void Cosp::initialize_impl (const RunType /* run_type */)
+void Cosp::initialize_impl (const RunType run_type)
 {
   // Set property checks for fields in this process
   CospFunc::initialize(m_num_cols, m_num_subcols, m_num_levs);
@@ -110,6 +146,34 @@ void Cosp::initialize_impl (const RunType /* run_type */)
       auto& f = get_field_out(field_name);
       auto& atts = f.get_header().get_extra_data<stratts_t>("io: string attributes");
       atts["note"] = "Night values are zero; divide by cosp_sunlit to get daytime mean";
+      if (m_async) {
+        atts["lag"] = "Values are computed from the model state at the previous COSP step";
+      }
+  }
+
+  if (m_async) {
+    get_field_out("cosp_sunlit").get_header().get_extra_data<stratts_t>("io: string attributes")["lag"] =
+      "Values are from the model state at the previous COSP step";
+
+    // The outputs snapshot is only used on host, but Field allows us to reuse the
+    // layouts of the process fields
+    for (const auto field_name : {"isccp_cldtot", "isccp_ctptau", "modis_ctptau", "misr_cthtau"}) {
+      m_outputs_snapshot[field_name] = get_field_out(field_name).clone();
+    }
+    m_dz    = KT::view_2d<Real>("dz",m_num_cols,m_num_levs);
+    m_z_int = KT::view_2d<Real>("z_int",m_num_cols,m_num_levs+1);
+    m_layout_left_views = CospFunc::LayoutLeftViews(m_num_cols,m_num_levs,m_num_tau,m_num_ctp,m_num_cth);
+
+    // The inputs snapshot of the last COSP step was read from the restart file, so
+    // we can redo the computation that was pending when the restart file was written.
+    // Its outputs are published at the next COSP step, as in the original run.
+    if (run_type==RunType::Restart and
+        ekat::any_cast<int>(m_restart_extra_data["cosp_has_pending_outputs"])==1) {
+      for (auto& it : m_inputs_snapshot) {
+        it.second.sync_to_host();
+      }
+      launch_cosp();
+    }
   }
 }
 
@@ -134,6 +198,24 @@ void Cosp::run_impl (const double dt)
   auto ts = timestamp();
   auto update_cosp = cosp_do(cosp_freq_in_steps, ts.get_num_steps());
 
+  if (m_async) {
+    if (update_cosp) {
+      // Publish the outputs of the previous COSP step (if any), then start the
+      // next COSP computation, on a snapshot of the current state
+      publish_outputs();
+      stage_inputs();
+      launch_cosp();
+    } else {
+      // See comment at the end of this function
+      get_field_out("isccp_cldtot").deep_copy(0.0);
+      get_field_out("isccp_ctptau").deep_copy(0.0);
+      get_field_out("modis_ctptau").deep_copy(0.0);
+      get_field_out("misr_cthtau").deep_copy(0.0);
+      get_field_out("cosp_sunlit").deep_copy(0.0);
+    }
+    return;
+  }
+
   // Get fields from field manager; note that we get host views because this
   // interface serves primarily as a wrapper to a c++ to f90 bridge for the COSP
   // all then need to be copied to layoutLeft views to permute the indices for
@@ -254,9 +336,150 @@ void Cosp::run_impl (const double dt)
   get_field_out("cosp_sunlit").sync_to_dev();
 }
 
+// =========================================================================================
+void Cosp::stage_inputs ()
+{
+  using PFD = scream::PhysicsFunctions<DefaultDevice>;
+
+  // Compute heights on device, directly in the device view of the z_mid snapshot
+  const auto ncol = m_num_cols;
+  const auto nlev = m_num_levs;
+  const auto p_mid = get_field_in("p_mid").get_view<const Real**>();
+  const auto T_mid = get_field_in("T_mid").get_view<const Real**>();
+  const auto qv    = get_field_in("qv").get_view<const Real**>();
+  const auto phis  = get_field_in("phis").get_view<const Real*>();
+  const auto pseudo_density = get_field_in("pseudo_density").get_view<const Real**>();
+  const auto z_mid = m_inputs_snapshot.at("z_mid").get_view<Real**>();
+  const auto z_int = m_z_int;
+  const auto dz    = m_dz;
+  const auto scan_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol, nlev);
+  Kokkos::parallel_for(scan_policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+      const int i = team.league_rank();
+      const auto dz_s    = ekat::subview(dz,    i);
+      const auto p_mid_s = ekat::subview(p_mid, i);
+      const auto T_mid_s = ekat::subview(T_mid, i);
+      const auto qv_s = ekat::subview(qv, i);
+      const auto z_int_s = ekat::subview(z_int, i);
+      const auto z_mid_s = ekat::subview(z_mid, i);
+      const Real z_surf  = phis(i) / 9.81;
+      const auto pseudo_density_s = ekat::subview(pseudo_density, i);
+      PFD::calculate_dz(team, pseudo_density_s, p_mid_s, T_mid_s, qv_s, dz_s);
+      team.team_barrier();
+      PFD::calculate_z_int(team,nlev,dz_s,z_surf,z_int_s);
+      team.team_barrier();
+      PFD::calculate_z_mid(team,nlev,z_int_s,z_mid_s);
+      team.team_barrier();
+  });
+
+  // Copy the inputs in the snapshot on device (this also takes care of the tracers,
+  // which are non-contiguous subfields of the tracers group), so that the snapshot
+  // device data can be saved in the restart file. Then, copy the snapshot to host,
+  // for the worker thread. Notice that this is done on the critical path: only the
+  // COSP computation itself overlaps with the model.
+  for (auto& [name,snap] : m_inputs_snapshot) {
+    if (name!="z_mid") {
+      snap.deep_copy(get_field_in(name));
+    }
+  }
+  for (auto& [name,snap] : m_inputs_snapshot) {
+    snap.sync_to_host();
+  }
+}
+
+void Cosp::launch_cosp ()
+{
+  auto sunlit  = m_inputs_snapshot.at("sunlit").get_view<const Real*, Host>();
+  auto skt     = m_inputs_snapshot.at("surf_radiative_T").get_view<const Real*, Host>();
+  auto T_mid   = m_inputs_snapshot.at("T_mid").get_view<const Real**, Host>();
+  auto p_mid   = m_inputs_snapshot.at("p_mid").get_view<const Real**, Host>();
+  auto p_int   = m_inputs_snapshot.at("p_int").get_view<const Real**, Host>();
+  auto z_mid   = m_inputs_snapshot.at("z_mid").get_view<const Real**, Host>();
+  auto qv      = m_inputs_snapshot.at("qv").get_view<const Real**, Host>();
+  auto qc      = m_inputs_snapshot.at("qc").get_view<const Real**, Host>();
+  auto qi      = m_inputs_snapshot.at("qi").get_view<const Real**, Host>();
+  auto cldfrac = m_inputs_snapshot.at("cldfrac_rad").get_view<const Real**, Host>();
+  auto reff_qc = m_inputs_snapshot.at("eff_radius_qc").get_view<const Real**, Host>();
+  auto reff_qi = m_inputs_snapshot.at("eff_radius_qi").get_view<const Real**, Host>();
+  auto dtau067 = m_inputs_snapshot.at("dtau067").get_view<const Real**, Host>();
+  auto dtau105 = m_inputs_snapshot.at("dtau105").get_view<const Real**, Host>();
+  auto isccp_cldtot = m_outputs_snapshot.at("isccp_cldtot").get_view<Real*, Host>();
+  auto isccp_ctptau = m_outputs_snapshot.at("isccp_ctptau").get_view<Real***, Host>();
+  auto modis_ctptau = m_outputs_snapshot.at("modis_ctptau").get_view<Real***, Host>();
+  auto misr_cthtau  = m_outputs_snapshot.at("misr_cthtau").get_view<Real***, Host>();
+
+  const auto ncol = m_num_cols;
+  const auto nsubcol = m_num_subcols;
+  const auto nlev = m_num_levs;
+  const auto ntau = m_num_tau;
+  const auto nctp = m_num_ctp;
+  const auto ncth = m_num_cth;
+
+  // The worker only touches the snapshots and the LayoutLeft views, which are not
+  // accessed by the model until the task is done (see publish_outputs). All views
+  // are allocated (and captured) here on the main thread: the worker runs only plain
+  // host loops and the Fortran call, with no Kokkos allocation or kernel dispatch.
+  const auto& lv = m_layout_left_views;
+  m_cosp_task = std::async(std::launch::async,[=]() mutable {
+    Real emsfc_lw = 0.99;
+    CospFunc::main(
+            ncol, nsubcol, nlev, ntau, nctp, ncth,
+            emsfc_lw, sunlit, skt, T_mid, p_mid, p_int, z_mid, qv, qc, qi,
+            cldfrac, reff_qc, reff_qi, dtau067, dtau105,
+            isccp_cldtot, isccp_ctptau, modis_ctptau, misr_cthtau, lv
+    );
+    // Remask night values to ZERO (see run_impl)
+    for (int i = 0; i < ncol; i++) {
+        if (sunlit(i) == 0) {
+            isccp_cldtot(i) = 0;
+            for (int j = 0; j < ntau; j++) {
+                for (int k = 0; k < nctp; k++) {
+                    isccp_ctptau(i,j,k) = 0;
+                    modis_ctptau(i,j,k) = 0;
+                }
+                for (int k = 0; k < ncth; k++) {
+                    misr_cthtau (i,j,k) = 0;
+                }
+            }
+        }
+    }
+  });
+  m_has_pending_outputs = true;
+  ekat::any_cast<int>(m_restart_extra_data["cosp_has_pending_outputs"]) = 1;
+}
+
+void Cosp::publish_outputs ()
+{
+  if (not m_has_pending_outputs) {
+    // Nothing computed yet, so the outputs are zero, like at night
+    for (const auto field_name : {"isccp_cldtot", "isccp_ctptau", "modis_ctptau", "misr_cthtau", "cosp_sunlit"}) {
+      get_field_out(field_name).deep_copy(0.0);
+    }
+    return;
+  }
+
+  // Wait for the worker (if it's still running). This rethrows any exception thrown in the worker.
+  m_cosp_task.get();
+  m_has_pending_outputs = false;
+
+  for (auto& [name,snap] : m_outputs_snapshot) {
+    snap.sync_to_dev();
+    get_field_out(name).deep_copy(snap);
+  }
+  // The sunlit flag of the COSP step that the outputs refer to
+  auto& sunlit = m_inputs_snapshot.at("sunlit");
+  sunlit.sync_to_dev();
+  get_field_out("cosp_sunlit").deep_copy(sunlit);
+}
+
 // =========================================================================================
 void Cosp::finalize_impl()
 {
+  // Outputs of a pending COSP computation are discarded, but we must wait for it,
+  // since COSP cannot be finalized while running
+  if (m_cosp_task.valid()) {
+    m_cosp_task.wait();
+  }
+
   // Finalize COSP wrappers
   CospFunc::finalize();
 }
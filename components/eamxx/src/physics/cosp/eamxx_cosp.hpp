@@ -3,8 +3,11 @@
 
 #include "share/atm_process/atmosphere_process.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
+#include "cosp_functions.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 
+#include <future>
+#include <map>
 #include <string>
 
 namespace scream
@@ -58,9 +61,16 @@ protected:
 public:
 #endif
   void run_impl        (const double dt);
+
+  // Async mode: copy the inputs (and the heights computed from them) to the snapshot
+  void stage_inputs ();
 protected:
   void finalize_impl   ();
 
+  // Async mode: run COSP on the host snapshot in a worker thread, and publish its outputs
+  void launch_cosp ();
+  void publish_outputs ();
+
   // cosp frequency; positive is interpreted as number of steps, negative as number of hours
   int m_cosp_frequency;
   ekat::CaseInsensitiveString m_cosp_frequency_units;
@@ -75,6 +85,20 @@ protected:
 
   std::shared_ptr<const AbstractGrid> m_grid;
 
+  // If true, COSP runs on a worker thread, on a host snapshot of the inputs taken at
+  // the COSP step. Its outputs are published at the following COSP step, so that
+  // the model does not wait for COSP. The inputs snapshot is made of internal fields,
+  // so that a restarted run can redo the pending computation, and stay BFB.
+  bool m_async;
+  std::future<void>           m_cosp_task;
+  bool                        m_has_pending_outputs = false;
+  std::map<std::string,Field> m_inputs_snapshot;
+  std::map<std::string,Field> m_outputs_snapshot;
+  KT::view_2d<Real>           m_dz;
+  KT::view_2d<Real>           m_z_int;
+  // Allocated on the main thread, since Kokkos views should not be allocated by the worker
+  CospFunc::LayoutLeftViews   m_layout_left_views;
+
 }; // class Cosp
 
 } // namespace scream
@@ -0,0 +1,215 @@
+#include "dense_nn.hpp"
+
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+#include "ekat/ekat_assert.hpp"
+
+namespace scream {
+
+namespace {
+
+KOKKOS_INLINE_FUNCTION
+Real activate (const DenseNN::Activation act, const Real x)
+{
+  using A = DenseNN::Activation;
+  switch (act) {
+    case A::ReLU:     return x>0 ? x : Real(0);
+    case A::Tanh:     return Kokkos::tanh(x);
+    case A::Sigmoid:  return 1 / (1 + Kokkos::exp(-x));
+    default:          return x;
+  }
+}
+
+} // anonymous namespace
+
+DenseNN::
+DenseNN (const std::string& filename)
+{
+  scorpio::register_file(filename,scorpio::FileMode::Read);
+
+  const int num_layers = scorpio::get_attribute<int>(filename,"GLOBAL","num_layers");
+  EKAT_REQUIRE_MSG (num_layers>0,
+      "Error! Invalid number of layers in neural network file.\n"
+      " - file name : " + filename + "\n"
+      " - num_layers: " + std::to_string(num_layers) + "\n");
+
+  m_activation = str2activation(scorpio::get_attribute<std::string>(filename,"GLOBAL","activation"));
+  m_input_names  = ekat::split(scorpio::get_attribute<std::string>(filename,"GLOBAL","input_variables"),",");
+  m_output_names = ekat::split(scorpio::get_attribute<std::string>(filename,"GLOBAL","output_variables"),",");
+
+  // Read a var in a new device view. All vars are small, so each rank reads the whole var
+  auto read_1d = [&](const std::string& name, const std::string& dim) {
+    view_1d<Real> v (name,scorpio::get_dimlen(filename,dim));
+    auto v_h = Kokkos::create_mirror_view(v);
+    scorpio::read_var(filename,name,v_h.data());
+    Kokkos::deep_copy(v,v_h);
+    return v;
+  };
+  m_input_mean  = read_1d("input_mean","n_input");
+  m_input_std   = read_1d("input_std","n_input");
+  m_output_mean = read_1d("output_mean","n_output");
+  m_output_std  = read_1d("output_std","n_output");
+
+  for (int i=1; i<=num_layers; ++i) {
+    const auto prefix = "layer_" + std::to_string(i);
+    const int n_in  = scorpio::get_dimlen(filename,prefix + "_in");
+    const int n_out = scorpio::get_dimlen(filename,prefix + "_out");
+
+    view_2d<Real> w (prefix + "_weights",n_out,n_in);
+    auto w_h = Kokkos::create_mirror_view(w);
+    scorpio::read_var(filename,prefix + "_weights",w_h.data());
+    Kokkos::deep_copy(w,w_h);
+
+    m_layers.push_back({w,read_1d(prefix + "_bias",prefix + "_out")});
+  }
+
+  scorpio::release_file(filename);
+
+  setup();
+}
+
+DenseNN::
+DenseNN (const std::vector<Layer>& layers,
+         const Activation activation,
+         const view_1d<const Real>& input_mean,
+         const view_1d<const Real>& input_std,
+         const view_1d<const Real>& output_mean,
+         const view_1d<const Real>& output_std,
+         const std::vector<std::string>& input_names,
+         const std::vector<std::string>& output_names)
+ : m_layers       (layers)
+ , m_activation   (activation)
+ , m_input_mean   (input_mean)
+ , m_input_std    (input_std)
+ , m_output_mean  (output_mean)
+ , m_output_std   (output_std)
+ , m_input_names  (input_names)
+ , m_output_names (output_names)
+{
+  setup();
+}
+
+void DenseNN::setup ()
+{
+  EKAT_REQUIRE_MSG (m_layers.size()>0,
+      "Error! A neural network needs at least one layer.\n");
+  EKAT_REQUIRE_MSG (m_input_std.extent(0)==m_input_mean.extent(0),
+      "Error! Input mean and std have different sizes.\n");
+  EKAT_REQUIRE_MSG (m_output_std.extent(0)==m_output_mean.extent(0),
+      "Error! Output mean and std have different sizes.\n");
+
+  int n_in = num_inputs();
+  m_max_width = n_in;
+  for (size_t i=0; i<m_layers.size(); ++i) {
+    const auto& l = m_layers[i];
+    EKAT_REQUIRE_MSG (static_cast<int>(l.weights.extent(1))==n_in,
+        "Error! Neural network layer input size does not match the previous layer output size.\n"
+        " - layer index: " + std::to_string(i+1) + "\n"
+        " - layer input size: " + std::to_string(l.weights.extent(1)) + "\n"
+        " - previous layer output size: " + std::to_string(n_in) + "\n");
+    EKAT_REQUIRE_MSG (l.bias.extent(0)==l.weights.extent(0),
+        "Error! Neural network layer bias and weights sizes do not match.\n"
+        " - layer index: " + std::to_string(i+1) + "\n");
+    n_in = l.weights.extent(0);
+    m_max_width = std::max(m_max_width,n_in);
+  }
+  EKAT_REQUIRE_MSG (n_in==num_outputs(),
+      "Error! Neural network last layer output size does not match the number of outputs.\n"
+      " - last layer output size: " + std::to_string(n_in) + "\n"
+      " - number of outputs: " + std::to_string(num_outputs()) + "\n");
+}
+
+void DenseNN::
+predict (const view_2d<const Real>& x, const view_2d<Real>& y) const
+{
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+  using MT  = KT::MemberType;
+
+  const int ncols = x.extent(0);
+  EKAT_REQUIRE_MSG (static_cast<int>(x.extent(1))==num_inputs() and static_cast<int>(y.extent(1))==num_outputs(),
+      "Error! Invalid input/output views extents in DenseNN::predict.\n");
+  EKAT_REQUIRE_MSG (static_cast<int>(y.extent(0))==ncols,
+      "Error! Input and output views have a different number of columns.\n");
+
+  if (static_cast<int>(m_work[0].extent(0))<ncols) {
+    m_work[0] = view_2d<Real>("dense_nn_work0",ncols,m_max_width);
+    m_work[1] = view_2d<Real>("dense_nn_work1",ncols,m_max_width);
+  }
+
+  // Normalize inputs
+  {
+    const int n = num_inputs();
+    const auto mean = m_input_mean;
+    const auto sd   = m_input_std;
+    const auto z    = m_work[0];
+    Kokkos::parallel_for("DenseNN::normalize",KT::RangePolicy(0,ncols*n),
+                         KOKKOS_LAMBDA(const int idx) {
+      const int icol = idx / n;
+      const int k    = idx % n;
+      z(icol,k) = (x(icol,k) - mean(k)) / sd(k);
+    });
+  }
+
+  // Dense layers: z_out = act(W*z_in + b)
+  const int nlayers = m_layers.size();
+  for (int i=0; i<nlayers; ++i) {
+    const auto w    = m_layers[i].weights;
+    const auto b    = m_layers[i].bias;
+    const auto z_in  = m_work[i%2];
+    const auto z_out = m_work[(i+1)%2];
+    const int n_in  = w.extent(1);
+    const int n_out = w.extent(0);
+    const auto act = i<nlayers-1 ? m_activation : Activation::Linear;
+    const auto policy = ESU::get_default_team_policy(ncols,n_out);
+    Kokkos::parallel_for("DenseNN::dense_layer",policy,
+                         KOKKOS_LAMBDA(const MT& team) {
+      const int icol = team.league_rank();
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,n_out),[&](const int j) {
+        Real sum = 0;
+        Kokkos::parallel_reduce(Kokkos::ThreadVectorRange(team,n_in),
+                                [&](const int k, Real& lsum) {
+          lsum += w(j,k)*z_in(icol,k);
+        },sum);
+        Kokkos::single(Kokkos::PerThread(team),[&] {
+          z_out(icol,j) = activate(act,sum+b(j));
+        });
+      });
+    });
+  }
+
+  // De-normalize outputs
+  {
+    const int n = num_outputs();
+    const auto mean = m_output_mean;
+    const auto sd   = m_output_std;
+    const auto z    = m_work[nlayers%2];
+    Kokkos::parallel_for("DenseNN::denormalize",KT::RangePolicy(0,ncols*n),
+                         KOKKOS_LAMBDA(const int idx) {
+      const int icol = idx / n;
+      const int k    = idx % n;
+      y(icol,k) = z(icol,k)*sd(k) + mean(k);
+    });
+  }
+}
+
+DenseNN::Activation
+DenseNN::str2activation (const std::string& s)
+{
+  Activation act = Activation::Linear;
+  if (s=="relu") {
+    act = Activation::ReLU;
+  } else if (s=="tanh") {
+    act = Activation::Tanh;
+  } else if (s=="sigmoid") {
+    act = Activation::Sigmoid;
+  } else {
+    EKAT_REQUIRE_MSG (s=="linear",
+        "Error! Unsupported neural network activation '" + s + "'.\n"
+        " - supported values: linear, relu, tanh, sigmoid\n");
+  }
+  return act;
+}
+
+} // namespace scream
@@ -0,0 +1,108 @@
+#ifndef EAMXX_DENSE_NN_HPP
+#define EAMXX_DENSE_NN_HPP
+
+#include "share/scream_types.hpp"
+
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * A small fully connected neural network, evaluated with Kokkos kernels
+ * over a batch of columns. For each column, the input vector x is mapped
+ * to the output vector y as follows
+ *
+ *   z_0 = (x - input_mean) / input_std
+ *   z_i = act_i (W_i z_{i-1} + b_i),   i=1,...,N
+ *   y   = z_N * output_std + output_mean
+ *
+ * where act_i is the hidden layers activation for i<N, and the identity for i=N.
+ * The input (output) vector is the concatenation of the input (output) variables,
+ * in the order given by input_names() (output_names()). It is up to the user to
+ * know the size of each variable (e.g., 1 for a scalar, nlevs for a profile).
+ *
+ * The network can be loaded from a netCDF file, containing:
+ *  - global attributes:
+ *     - num_layers (int): the number of dense layers N
+ *     - activation (string): the hidden layers activation (linear, relu, tanh, or sigmoid)
+ *     - input_variables (string): comma-separated list of input variables names
+ *     - output_variables (string): comma-separated list of output variables names
+ *  - variables:
+ *     - input_mean, input_std: dimension n_input
+ *     - output_mean, output_std: dimension n_output
+ *     - layer_i_weights: dimensions (layer_i_out, layer_i_in), for i=1,...,N
+ *     - layer_i_bias: dimension layer_i_out, for i=1,...,N
+ * Profiles are stored from model top to surface.
+ */
+
+class DenseNN
+{
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+
+  template<typename T>
+  using view_1d = KT::view_1d<T>;
+  template<typename T>
+  using view_2d = KT::view_2d<T>;
+
+  enum class Activation {
+    Linear,
+    ReLU,
+    Tanh,
+    Sigmoid
+  };
+
+  struct Layer {
+    view_2d<const Real> weights;  // (n_out,n_in)
+    view_1d<const Real> bias;     // (n_out)
+  };
+
+  // Load the network from file (requires the scorpio subsystem to be inited)
+  DenseNN (const std::string& filename);
+
+  DenseNN (const std::vector<Layer>& layers,
+           const Activation activation,
+           const view_1d<const Real>& input_mean,
+           const view_1d<const Real>& input_std,
+           const view_1d<const Real>& output_mean,
+           const view_1d<const Real>& output_std,
+           const std::vector<std::string>& input_names,
+           const std::vector<std::string>& output_names);
+
+  int num_inputs  () const { return m_input_mean.extent(0); }
+  int num_outputs () const { return m_output_mean.extent(0); }
+
+  const std::vector<std::string>& input_names  () const { return m_input_names;  }
+  const std::vector<std::string>& output_names () const { return m_output_names; }
+
+  // Evaluate the network on all columns of x. Dimensions must be
+  //   x: (ncols,num_inputs())
+  //   y: (ncols,num_outputs())
+  void predict (const view_2d<const Real>& x, const view_2d<Real>& y) const;
+
+  static Activation str2activation (const std::string& s);
+
+protected:
+
+  void setup ();
+
+  std::vector<Layer>        m_layers;
+  Activation                m_activation;
+
+  view_1d<const Real>       m_input_mean;
+  view_1d<const Real>       m_input_std;
+  view_1d<const Real>       m_output_mean;
+  view_1d<const Real>       m_output_std;
+
+  std::vector<std::string>  m_input_names;
+  std::vector<std::string>  m_output_names;
+
+  // Work arrays for the layers outputs, (re)allocated if more columns are needed
+  int                       m_max_width;
+  mutable view_2d<Real>     m_work[2];
+};
+
+} // namespace scream
+
+#endif // EAMXX_DENSE_NN_HPP
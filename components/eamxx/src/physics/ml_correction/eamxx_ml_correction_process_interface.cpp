@@ -6,7 +6,110 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 
+#include <set>
+
 namespace scream {
+
+namespace {
+
+using KT = KokkosTypes<DefaultDevice>;
+
+// Cosine of the solar zenith angle at the given time and location (in degrees).
+// We use the same approximate astronomical formulas of the python code
+// (vcm.cos_zenith_angle), so that both backends feed the same inputs to the models.
+Real cos_zenith_angle (const util::TimeStamp& ts, const Real lat, const Real lon)
+{
+  // Days since 2000-01-01 12:00, using the proleptic gregorian calendar (like python)
+  auto days_from_civil = [](int y, const int m, const int d) {
+    y -= m<=2 ? 1 : 0;
+    const int era = (y>=0 ? y : y-399) / 400;
+    const int yoe = y - era*400;
+    const int doy = (153*(m>2 ? m-3 : m+9) + 2)/5 + d-1;
+    const int doe = yoe*365 + yoe/4 - yoe/100 + doy;
+    return era*146097 + doe;
+  };
+  const double secs = ts.get_hours()*3600 + ts.get_minutes()*60 + ts.get_seconds();
+  const double jdays = days_from_civil(ts.get_year(),ts.get_month(),ts.get_day())
+                     - days_from_civil(2000,1,1) - 0.5 + secs/86400;
+
+  constexpr double deg2rad = scream::physics::Constants<double>::Pi/180;
+
+  // Sun right ascension and declination
+  const double mean_anomaly = (357.528 + 0.9856003*jdays)*deg2rad;
+  const double ecliptic_lon = (280.460 + 0.9856474*jdays + 1.915*std::sin(mean_anomaly)
+                              + 0.020*std::sin(2*mean_anomaly))*deg2rad;
+  const double obliquity = (23.439 - 0.0000004*jdays)*deg2rad;
+  const double x = std::cos(ecliptic_lon);
+  const double y = std::cos(obliquity)*std::sin(ecliptic_lon);
+  const double z = std::sin(obliquity)*std::sin(ecliptic_lon);
+  const double r = std::sqrt(1 - z*z);
+  const double declination = std::atan2(z,r);
+  const double right_ascension = 2*std::atan(y/(x+r));
+
+  // Local mean sidereal time
+  const double t0 = jdays / 36525;
+  const double gmst = 280.46061837 + 360.98564736629*jdays + 0.000387933*t0*t0 - t0*t0*t0/38710000;
+  const double lmst = std::fmod(gmst,360.0)*deg2rad + lon*deg2rad;
+
+  const double hour_angle = lmst - right_ascension;
+  const double lat_rad = lat*deg2rad;
+  return std::sin(lat_rad)*std::sin(declination) + std::cos(lat_rad)*std::cos(declination)*std::cos(hour_angle);
+}
+
+// Copy n levels of src, starting at level k0, in x(:,offset:offset+n)
+void pack_inputs (const KT::view_2d<Real>& x, const int offset,
+                  const KT::view_2d<const Real>& src, const int k0, const int n)
+{
+  const int ncols = x.extent(0);
+  Kokkos::parallel_for(KT::RangePolicy(0,ncols*n), KOKKOS_LAMBDA(const int idx) {
+    const int icol = idx / n;
+    const int k    = idx % n;
+    x(icol,offset+k) = src(icol,k0+k);
+  });
+}
+
+void pack_inputs (const KT::view_2d<Real>& x, const int offset,
+                  const KT::view_1d<const Real>& src)
+{
+  const int ncols = x.extent(0);
+  Kokkos::parallel_for(KT::RangePolicy(0,ncols), KOKKOS_LAMBDA(const int icol) {
+    x(icol,offset) = src(icol);
+  });
+}
+
+// Treat y(:,offset:offset+n) as a tendency for the first n levels of dst
+void apply_outputs (const KT::view_2d<Real>& dst, const KT::view_2d<const Real>& y,
+                    const int offset, const int n, const Real dt)
+{
+  const int ncols = y.extent(0);
+  Kokkos::parallel_for(KT::RangePolicy(0,ncols*n), KOKKOS_LAMBDA(const int idx) {
+    const int icol = idx / n;
+    const int k    = idx % n;
+    dst(icol,k) += y(icol,offset+k)*dt;
+  });
+}
+
+// Override dst with y(:,offset)
+void apply_outputs (const KT::view_1d<Real>& dst, const KT::view_2d<const Real>& y,
+                    const int offset)
+{
+  const int ncols = y.extent(0);
+  Kokkos::parallel_for(KT::RangePolicy(0,ncols), KOKKOS_LAMBDA(const int icol) {
+    dst(icol) = y(icol,offset);
+  });
+}
+
+// The variables known to the native backend. Profiles have nlevs entries per column
+const std::set<std::string> nn_profile_inputs  = {"T_mid", "qv", "U", "V"};
+const std::set<std::string> nn_scalar_inputs   = {"cos_zenith_angle", "lat", "surface_geopotential",
+                                                  "surface_diffused_shortwave_albedo",
+                                                  "total_sky_downward_shortwave_flux_at_top_of_atmosphere"};
+const std::set<std::string> nn_profile_outputs = {"dQ1", "dQ2", "dQu", "dQv", "dQxwind", "dQywind"};
+const std::set<std::string> nn_scalar_outputs  = {"net_shortwave_sfc_flux_via_transmissivity",
+                                                  "override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface"};
+
+} // anonymous namespace
+
 // =========================================================================================
 MLCorrection::MLCorrection(const ekat::Comm &comm,
                            const ekat::ParameterList &params)
@@ -16,6 +119,23 @@ MLCorrection::MLCorrection(const ekat::Comm &comm,
   m_ML_model_path_sfc_fluxes = m_params.get<std::string>("ML_model_path_sfc_fluxes");
   m_fields_ml_output_variables = m_params.get<std::vector<std::string>>("ML_output_fields");
   m_ML_correction_unit_test = m_params.get<bool>("ML_correction_unit_test");
+  m_column_chunk_size = m_params.get<int>("ML_column_chunk_size",0);
+
+#ifdef EAMXX_ML_CORRECTION_HAS_PYTHON
+  const std::string default_backend = "python";
+#else
+  const std::string default_backend = "native";
+#endif
+  const auto backend = m_params.get<std::string>("ML_backend",default_backend);
+  EKAT_REQUIRE_MSG (backend=="python" or backend=="native",
+      "Error! Invalid value for ML_backend.\n"
+      " - input value: " + backend + "\n"
+      " - valid values: python, native\n");
+#ifndef EAMXX_ML_CORRECTION_HAS_PYTHON
+  EKAT_REQUIRE_MSG (backend=="native",
+      "Error! The python backend for MLCorrection requires building with python support.\n");
+#endif
+  m_native_backend = backend=="native";
 }
 
 // =========================================================================================
@@ -72,18 +192,65 @@ void MLCorrection::set_grids(
 
 // =========================================================================================
 void MLCorrection::initialize_impl(const RunType /* run_type */) {
-  fpe_mask = ekat::get_enabled_fpes();
-  ekat::disable_all_fpes();  // required for importing numpy  
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_column_chunk_size<=0 or m_column_chunk_size>m_num_cols) {
+    m_column_chunk_size = m_num_cols;
+  }
+
+  if (m_native_backend) {
+    for (const auto& path : {m_ML_model_path_tq,m_ML_model_path_uv,m_ML_model_path_sfc_fluxes}) {
+      if (path=="None" or path=="NONE") {
+        continue;
+      }
+      auto nn = std::make_shared<DenseNN>(path);
+
+      // Check that we know how to feed the model, and what to do with its outputs
+      auto var_size = [&](const std::string& name, const std::set<std::string>& profiles,
+                          const std::set<std::string>& scalars) {
+        EKAT_REQUIRE_MSG (profiles.count(name)==1 or scalars.count(name)==1,
+            "Error! Variable not supported by MLCorrection native backend.\n"
+            " - model file: " + path + "\n"
+            " - variable  : " + name + "\n");
+        return profiles.count(name)==1 ? m_num_levs : 1;
+      };
+      int n_in = 0, n_out = 0;
+      for (const auto& name : nn->input_names()) {
+        n_in += var_size(name,nn_profile_inputs,nn_scalar_inputs);
+      }
+      for (const auto& name : nn->output_names()) {
+        n_out += var_size(name,nn_profile_outputs,nn_scalar_outputs);
+      }
+      EKAT_REQUIRE_MSG (n_in==nn->num_inputs() and n_out==nn->num_outputs(),
+          "Error! The neural network inputs/outputs sizes do not match the model variables.\n"
+          " - model file: " + path + "\n"
+          " - network num inputs/outputs: " + std::to_string(nn->num_inputs()) + "/" + std::to_string(nn->num_outputs()) + "\n"
+          " - variables num inputs/outputs: " + std::to_string(n_in) + "/" + std::to_string(n_out) + "\n");
+
+      m_nns.push_back(nn);
+      m_nn_inputs.push_back(KT::view_2d<Real>("ml_inputs",m_column_chunk_size,n_in));
+      m_nn_outputs.push_back(KT::view_2d<Real>("ml_outputs",m_column_chunk_size,n_out));
+    }
+    m_cos_zenith = KT::view_1d<Real>("cos_zenith",m_num_cols);
+  } else {
+#ifdef EAMXX_ML_CORRECTION_HAS_PYTHON
+    const int fpe_mask = ekat::get_enabled_fpes();
+    ekat::disable_all_fpes();  // required for importing numpy
+    if ( Py_IsInitialized() == 0 ) {
+      pybind11::initialize_interpreter();
+    }
+    pybind11::module sys = pybind11::module::import("sys");
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
+    py_correction = pybind11::module::import("ml_correction");
+    ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
+    ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
+    ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
+    m_update_fields = py_correction.attr("update_fields");
+    ekat::enable_fpes(fpe_mask);
+#endif
+  }
+
+  if (m_ML_model_path_tq != "None") {
+    m_qv_old = get_field_in("qv").clone("qv_old");
   }
-  pybind11::module sys = pybind11::module::import("sys");
-  sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
-  py_correction = pybind11::module::import("ml_correction");
-  ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
-  ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
-  ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
-  ekat::enable_fpes(fpe_mask);
 
   // Enforce bounds on quantities adjusted by ML using Field Property Checks
   using LowerBound = FieldLowerBoundCheck;
@@ -98,71 +265,21 @@ void MLCorrection::initialize_impl(const RunType /* run_type */) {
 
 // =========================================================================================
 void MLCorrection::run_impl(const double dt) {
-  // use model time to infer solar zenith angle for the ML prediction
-  auto current_ts = timestamp();
-  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
-
-  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
-  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();  
-
-  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
-  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
-  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
-  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
-  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
-  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
-  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
-
-  // For precipitation adjustment we need to track the change in column integrated 'qv'
-  // So we clone the original qv before ML changes the state so we can back out a qv_tend
-  // to use with precip adjustment.
-  auto qv_src = get_field_in("qv");
-  auto qv_in = qv_src.clone();
-
-  auto h_lat  = m_lat.get_view<const Real*,Host>();
-  auto h_lon  = m_lon.get_view<const Real*,Host>();
-
-  const auto& tracers = get_group_out("tracers");
-  const auto& tracers_info = tracers.m_info;
-  Int num_tracers = tracers_info->size();
+  // For precipitation adjustment we need to track the change in column integrated 'qv',
+  // so we save qv before ML changes the state.
+  if (m_ML_model_path_tq != "None") {
+    m_qv_old.deep_copy(get_field_in("qv"));
+  }
 
-  ekat::disable_all_fpes();  // required for importing numpy
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_native_backend) {
+    run_native(dt);
+  } else {
+    run_python(dt);
   }
-  // for qv, we need to stride across number of tracers
-  pybind11::object ob1     = py_correction.attr("update_fields")(
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),          
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, u.data(), pybind11::str{}),        
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, v.data(), pybind11::str{}),       
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lat.data(), pybind11::str{}),       
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lon.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, phis.data(), pybind11::str{}),   
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),   
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),                                                                                                   
-      m_num_cols, m_num_levs, num_tracers, dt, 
-      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
-  pybind11::gil_scoped_release no_gil;  
-  ekat::enable_fpes(fpe_mask);   
 
   // Now back out the qv change abd apply it to precipitation, only if Tq ML is turned on
   if (m_ML_model_path_tq != "None") {
     using PC  = scream::physics::Constants<Real>;
-    using KT  = KokkosTypes<DefaultDevice>;
     using MT  = typename KT::MemberType;
     using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
     const auto &pseudo_density       = get_field_in("pseudo_density").get_view<const Real**>();
@@ -172,7 +289,8 @@ void MLCorrection::run_impl(const double dt) {
     const auto num_levs = m_num_levs;
     const auto policy = ESU::get_default_team_policy(m_num_cols, m_num_levs);
     
-    const auto &qv_told = qv_in.get_view<const Real **>();
+    const auto &T_mid   = get_field_in("T_mid").get_view<const Real **>();
+    const auto &qv_told = m_qv_old.get_view<const Real **>();
     const auto &qv_tnew = get_field_in("qv").get_view<const Real **>();
     Kokkos::parallel_for("Compute WVP diff", policy,
                          KOKKOS_LAMBDA(const MT& team) {
@@ -191,7 +309,6 @@ void MLCorrection::run_impl(const double dt) {
       //       	pseudo_density = Pa = kg/m/s2
       //       	gravity = m/s2
       //       d_qv * pseduo_density / gravity = kg/kg * kg/m/s2 * s2/m = kg/m2
-      // Compute WaterVaporPath Difference
       Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team, num_levs),
                               [&] (const int& ilev, Real& lsum) {
         lsum += (qnew_icol(ilev)-qold_icol(ilev)) * rho_icol(ilev) / g;
@@ -227,6 +344,171 @@ void MLCorrection::run_impl(const double dt) {
   }
 }
 
+// =========================================================================================
+void MLCorrection::run_python(const double dt) {
+#ifdef EAMXX_ML_CORRECTION_HAS_PYTHON
+  // The caller may have released the GIL (e.g., pyeamxx's AtmProc.run), so grab it.
+  // If this thread already holds it, this is a no-op.
+  pybind11::gil_scoped_acquire gil;
+
+  // use model time to infer solar zenith angle for the ML prediction
+  auto current_ts = timestamp();
+  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
+
+  // The python code works on host data. If host and device share memory, syncing is a no-op.
+  const auto& f_phis            = get_field_in("phis");
+  const auto& f_sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis");
+  const auto& f_SW_flux_dn      = get_field_out("SW_flux_dn");
+  const auto& f_qv              = get_field_out("qv");
+  const auto& f_T_mid           = get_field_out("T_mid");
+  const auto& f_horiz_winds     = get_field_out("horiz_winds");
+  const auto& f_sfc_flux_sw_net = get_field_out("sfc_flux_sw_net");
+  const auto& f_sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn");
+  for (const auto& f : {f_phis,f_sfc_alb_dif_vis,f_SW_flux_dn,f_qv,f_T_mid,f_horiz_winds,
+                        f_sfc_flux_sw_net,f_sfc_flux_lw_dn}) {
+    f.sync_to_host();
+  }
+
+  const auto &phis            = f_phis.get_view<const Real *, Host>();
+  const auto &sfc_alb_dif_vis = f_sfc_alb_dif_vis.get_view<const Real *, Host>();
+  const auto &qv              = f_qv.get_view<Real **, Host>();
+  const auto &T_mid           = f_T_mid.get_view<Real **, Host>();
+  const auto &SW_flux_dn      = f_SW_flux_dn.get_view<Real **, Host>();
+  const auto &sfc_flux_sw_net = f_sfc_flux_sw_net.get_view<Real *, Host>();
+  const auto &sfc_flux_lw_dn  = f_sfc_flux_lw_dn.get_view<Real *, Host>();
+  const auto &u               = f_horiz_winds.get_component(0).get_view<Real **, Host>();
+  const auto &v               = f_horiz_winds.get_component(1).get_view<Real **, Host>();
+
+  auto h_lat  = m_lat.get_view<const Real*,Host>();
+  auto h_lon  = m_lon.get_view<const Real*,Host>();
+
+  // Pass chunks of columns to python. The arrays are strided views of the field data,
+  // which exclude the padding at the end of each column, and, for qv and the wind
+  // components, the other entries of the parent field.
+  // Numpy requires FP exceptions to be disabled. They usually are (they are only
+  // enabled in debug runs), in which case there is nothing to toggle.
+  const int fpe_mask = ekat::get_enabled_fpes();
+  if (fpe_mask!=0) {
+    ekat::disable_all_fpes();
+  }
+  const auto lev  = Kokkos::make_pair(0,m_num_levs);
+  const auto ilev = Kokkos::make_pair(0,m_num_levs+1);
+  for (int beg=0; beg<m_num_cols; beg+=m_column_chunk_size) {
+    const auto cols = Kokkos::make_pair(beg,std::min(beg+m_column_chunk_size,m_num_cols));
+    m_update_fields(
+        as_numpy_array(Kokkos::subview(T_mid,cols,lev)),
+        as_numpy_array(Kokkos::subview(qv,cols,lev)),
+        as_numpy_array(Kokkos::subview(u,cols,lev)),
+        as_numpy_array(Kokkos::subview(v,cols,lev)),
+        as_numpy_array(Kokkos::subview(h_lat,cols)),
+        as_numpy_array(Kokkos::subview(h_lon,cols)),
+        as_numpy_array(Kokkos::subview(phis,cols)),
+        as_numpy_array(Kokkos::subview(SW_flux_dn,cols,ilev)),
+        as_numpy_array(Kokkos::subview(sfc_alb_dif_vis,cols)),
+        as_numpy_array(Kokkos::subview(sfc_flux_sw_net,cols)),
+        as_numpy_array(Kokkos::subview(sfc_flux_lw_dn,cols)),
+        dt, ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
+  }
+  if (fpe_mask!=0) {
+    ekat::enable_fpes(fpe_mask);
+  }
+
+  for (const auto& f : {f_qv,f_T_mid,f_horiz_winds,f_sfc_flux_sw_net,f_sfc_flux_lw_dn}) {
+    f.sync_to_dev();
+  }
+#else
+  (void) dt;
+  EKAT_ERROR_MSG ("Error! MLCorrection was built without python support.\n");
+#endif
+}
+
+// =========================================================================================
+void MLCorrection::run_native(const double dt) {
+  // Solar zenith angle at the current model time (computed only if needed)
+  bool cos_zenith_computed = false;
+  auto compute_cos_zenith = [&]() {
+    const auto ts = timestamp();
+    const auto h_lat = m_lat.get_view<const Real*,Host>();
+    const auto h_lon = m_lon.get_view<const Real*,Host>();
+    const auto h_cos_zenith = Kokkos::create_mirror_view(m_cos_zenith);
+    for (int icol=0; icol<m_num_cols; ++icol) {
+      h_cos_zenith(icol) = cos_zenith_angle(ts,h_lat(icol),h_lon(icol));
+    }
+    Kokkos::deep_copy(m_cos_zenith,h_cos_zenith);
+    cos_zenith_computed = true;
+  };
+
+  const auto& horiz_winds = get_field_out("horiz_winds");
+  auto get_profile = [&](const std::string& name) -> Field {
+    if (name=="T_mid" or name=="dQ1") {
+      return get_field_out("T_mid");
+    } else if (name=="qv" or name=="dQ2") {
+      return get_field_out("qv");
+    } else if (name=="U" or name=="dQu" or name=="dQxwind") {
+      return horiz_winds.get_component(0);
+    } else {
+      return horiz_winds.get_component(1);
+    }
+  };
+
+  // Columns are processed in chunks, so that the networks inputs/outputs only need
+  // to store one chunk. Within a chunk, each model sees the state updated by the
+  // previous ones, like in python.
+  const int nlevs = m_num_levs;
+  for (int beg=0; beg<m_num_cols; beg+=m_column_chunk_size) {
+    const auto cols = Kokkos::make_pair(beg,std::min(beg+m_column_chunk_size,m_num_cols));
+    const auto chunk = Kokkos::make_pair(0,cols.second-cols.first);
+    auto chunk_1d = [&](const auto& v) { return Kokkos::subview(v,cols); };
+    auto chunk_2d = [&](const auto& v) { return Kokkos::subview(v,cols,Kokkos::ALL); };
+
+    for (size_t imodel=0; imodel<m_nns.size(); ++imodel) {
+      const auto& nn = *m_nns[imodel];
+      const auto  x  = Kokkos::subview(m_nn_inputs[imodel],chunk,Kokkos::ALL);
+      const auto  y  = Kokkos::subview(m_nn_outputs[imodel],chunk,Kokkos::ALL);
+
+      int offset = 0;
+      for (const auto& name : nn.input_names()) {
+        if (nn_profile_inputs.count(name)==1) {
+          pack_inputs(x,offset,chunk_2d(get_profile(name).get_view<const Real**>()),0,nlevs);
+          offset += nlevs;
+          continue;
+        }
+        if (name=="cos_zenith_angle") {
+          if (not cos_zenith_computed) {
+            compute_cos_zenith();
+          }
+          pack_inputs(x,offset,chunk_1d(m_cos_zenith));
+        } else if (name=="lat") {
+          pack_inputs(x,offset,chunk_1d(m_lat.get_view<const Real*>()));
+        } else if (name=="surface_geopotential") {
+          pack_inputs(x,offset,chunk_1d(get_field_in("phis").get_view<const Real*>()));
+        } else if (name=="surface_diffused_shortwave_albedo") {
+          pack_inputs(x,offset,chunk_1d(get_field_in("sfc_alb_dif_vis").get_view<const Real*>()));
+        } else {
+          // TOA downward SW flux
+          pack_inputs(x,offset,chunk_2d(get_field_out("SW_flux_dn").get_view<const Real**>()),0,1);
+        }
+        ++offset;
+      }
+
+      nn.predict(x,y);
+
+      offset = 0;
+      for (const auto& name : nn.output_names()) {
+        if (nn_profile_outputs.count(name)==1) {
+          apply_outputs(chunk_2d(get_profile(name).get_view<Real**>()),y,offset,nlevs,dt);
+          offset += nlevs;
+        } else {
+          const auto& fname = name=="net_shortwave_sfc_flux_via_transmissivity"
+                            ? "sfc_flux_sw_net" : "sfc_flux_lw_dn";
+          apply_outputs(chunk_1d(get_field_out(fname).get_view<Real*>()),y,offset);
+          ++offset;
+        }
+      }
+    }
+  }
+}
+
 // =========================================================================================
 void MLCorrection::finalize_impl() {
   // Do nothing
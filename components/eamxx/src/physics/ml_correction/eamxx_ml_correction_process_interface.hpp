@@ -1,9 +1,11 @@
 #ifndef SCREAM_ML_CORRECTION_HPP
 #define SCREAM_ML_CORRECTION_HPP
 
+#ifdef EAMXX_ML_CORRECTION_HAS_PYTHON
 #include <pybind11/embed.h>
 #include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
+#endif
 #include <array>
 #include <string>
 #include "share/atm_process/atmosphere_process.hpp"
@@ -16,9 +18,26 @@
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/util/scream_time_stamp.hpp"
+#include "physics/ml_correction/dense_nn.hpp"
 
 namespace scream {
 
+#ifdef EAMXX_ML_CORRECTION_HAS_PYTHON
+// Wrap the data of a (possibly strided) host view in a numpy array. Since we
+// pass a base object, pybind11 assumes someone else owns the memory, and does
+// not copy it. Hence, changes made to the array in python are seen by the view.
+template<typename ViewT>
+pybind11::array_t<Real> as_numpy_array (const ViewT& v)
+{
+  std::vector<pybind11::ssize_t> shape, strides;
+  for (int i=0; i<static_cast<int>(ViewT::rank); ++i) {
+    shape.push_back(v.extent(i));
+    strides.push_back(v.stride(i)*sizeof(Real));
+  }
+  return pybind11::array_t<Real>(shape,strides,const_cast<Real*>(v.data()),pybind11::none());
+}
+#endif
+
 /*
  * The class responsible to handle the calculation of the subgrid cloud
  * fractions
@@ -30,6 +49,7 @@ namespace scream {
 class MLCorrection : public AtmosphereProcess {
  public:
   using Pack = ekat::Pack<Real,SCREAM_PACK_SIZE>;
+  using KT   = KokkosTypes<DefaultDevice>;
   // Constructors
   MLCorrection(const ekat::Comm &comm, const ekat::ParameterList &params);
 
@@ -45,7 +65,16 @@ class MLCorrection : public AtmosphereProcess {
  protected:
   // The three main overrides for the subcomponent
   void initialize_impl(const RunType run_type);
+#ifdef KOKKOS_ENABLE_CUDA
+  // Cuda requires methods enclosing __device__ lambda's to be public
+ public:
+#endif
   void run_impl(const double dt);
+
+  // Apply the ML corrections, using the python models or the native C++ ones
+  void run_python (const double dt);
+  void run_native (const double dt);
+ protected:
   void finalize_impl();
   void apply_tendency(Field& base, const Field& next, const int dt);
 
@@ -60,11 +89,29 @@ class MLCorrection : public AtmosphereProcess {
   std::string m_ML_model_path_sfc_fluxes;
   std::vector<std::string> m_fields_ml_output_variables;
   bool m_ML_correction_unit_test;
+  int m_column_chunk_size;
+
+  // If true, the models are dense neural networks loaded from netCDF files, and
+  // evaluated in C++, without the python interpreter. The networks are applied in
+  // the same order as in python (T/q, winds, surface fluxes), on chunks of columns,
+  // with the inputs/outputs of each network stored in m_nn_inputs/m_nn_outputs.
+  bool m_native_backend;
+  std::vector<std::shared_ptr<DenseNN>> m_nns;
+  std::vector<KT::view_2d<Real>>        m_nn_inputs;
+  std::vector<KT::view_2d<Real>>        m_nn_outputs;
+  KT::view_1d<Real>                     m_cos_zenith;
+
+#ifdef EAMXX_ML_CORRECTION_HAS_PYTHON
   pybind11::module py_correction;
   pybind11::object ML_model_tq;
   pybind11::object ML_model_uv;
   pybind11::object ML_model_sfc_fluxes;
-  int fpe_mask;
+  // The python function is looked up once at init, and called on chunks of columns.
+  // Field data is handed to python without copies (see run_python).
+  pybind11::object m_update_fields;
+#endif
+  // Copy of qv before the ML correction, used to adjust precipitation
+  Field m_qv_old;
 };  // class MLCorrection
 
 }  // namespace scream
@@ -139,9 +139,6 @@ def update_fields(
     sfc_alb_dif_vis,
     sfc_flux_sw_net,
     sfc_flux_lw_dn,
-    Ncol,
-    Nlev,
-    num_tracers,
     dt,
     model_tq,
     model_uv,
@@ -149,31 +146,25 @@ def update_fields(
     current_time,
 ):
     """
-    T_mid: temperature
-    qv: specific humidity
-    u: x-component of wind
-    v: y-component of wind
+    All arrays are views of the model data (no copies), on a chunk of columns,
+    so they must be updated in place.
+
+    T_mid: temperature, shape (ncol, nlev)
+    qv: specific humidity, shape (ncol, nlev)
+    u: x-component of wind, shape (ncol, nlev)
+    v: y-component of wind, shape (ncol, nlev)
     lat: latitude
     lon: longitude
     phis: surface geopotential
-    SW_flux_dn_at_model_top: downwelling shortwave flux at the top of the model
+    sw_flux_dn: downwelling shortwave flux, shape (ncol, nlev+1)
     sfc_alb_dif_vis: surface diffuse shortwave albedo
     sfc_flux_sw_net
     sfc_flux_lw_dn
-    Ncol: number of columns
-    Nlev: number of levels
-    num_tracers: number of tracers
     dt: time step (s)
     model_tq: path to the ML model for temperature and specific humidity
     model_uv: path to the ML model for u and v
     current_time: current time in the format "YYYY-MM-DD HH:MM:SS"
     """
-    T_mid = np.reshape(T_mid, (-1, Nlev))
-    u = np.reshape(u, (-1, Nlev))
-    v = np.reshape(v, (-1, Nlev))
-    # qv is a 3D array of shape (Ncol, num_tracers, Nlev)
-    # by default, qv is the frist tracer variable
-    qv = np.reshape(qv, (-1, num_tracers, Nlev))
     current_datetime = datetime.datetime.strptime(current_time, "%Y-%m-%d %H:%M:%S")
     cos_zenith = cos_zenith_angle(
         current_datetime,
@@ -184,26 +175,25 @@ def update_fields(
         correction_tq = get_ML_correction_dQ1_dQ2(
             model_tq, 
             T_mid, 
-            qv[:, 0, :], 
+            qv, 
             cos_zenith,
             lat,
             phis,
             dt
         )
         T_mid[:, :] += correction_tq["dQ1"].values * dt
-        qv[:, 0, :] += correction_tq["dQ2"].values * dt
+        qv[:, :] += correction_tq["dQ2"].values * dt
     if model_uv is not None:
         correction_uv = get_ML_correction_dQu_dQv(
-            model_uv, T_mid, qv[:, 0, :], cos_zenith, lat, phis, u, v, dt
+            model_uv, T_mid, qv, cos_zenith, lat, phis, u, v, dt
         )
         u[:, :] += correction_uv["dQu"].values * dt
         v[:, :] += correction_uv["dQv"].values * dt
     if model_sfc_fluxes is not None:
-        sw_flux_dn = np.reshape(sw_flux_dn, (-1, Nlev+1))
         correction_sfc_fluxes = get_ML_correction_sfc_fluxes(
             model_sfc_fluxes,
             T_mid,
-            qv[:, 0, :],
+            qv,
             cos_zenith,
             lat,
             phis,
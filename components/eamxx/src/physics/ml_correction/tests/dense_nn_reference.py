@@ -0,0 +1,24 @@
+import numpy as np
+import xarray as xr
+
+
+def predict(filename, x):
+    """
+    Evaluate the dense network stored in filename (see dense_nn.hpp for the
+    file format) on the inputs x, of shape (ncol, n_input), using numpy.
+    """
+    activations = {
+        "linear": lambda z: z,
+        "relu": lambda z: np.maximum(z, 0),
+        "tanh": np.tanh,
+        "sigmoid": lambda z: 1 / (1 + np.exp(-z)),
+    }
+    with xr.open_dataset(filename) as ds:
+        act = activations[ds.attrs["activation"]]
+        num_layers = int(ds.attrs["num_layers"])
+        z = (x - ds["input_mean"].values) / ds["input_std"].values
+        for i in range(1, num_layers + 1):
+            z = z @ ds[f"layer_{i}_weights"].values.T + ds[f"layer_{i}_bias"].values
+            if i < num_layers:
+                z = act(z)
+        return z * ds["output_std"].values + ds["output_mean"].values
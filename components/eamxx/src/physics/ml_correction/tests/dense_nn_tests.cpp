@@ -0,0 +1,221 @@
+#include "catch2/catch.hpp"
+
+#include "physics/ml_correction/dense_nn.hpp"
+
+#include "share/io/scream_scorpio_interface.hpp"
+#include "share/util/scream_setup_random_test.hpp"
+
+#ifdef EAMXX_ML_CORRECTION_HAS_PYTHON
+#include <pybind11/embed.h>
+#include <pybind11/numpy.h>
+#endif
+
+#include <cmath>
+#include <limits>
+
+namespace scream {
+
+TEST_CASE("dense_nn") {
+  using KT = DenseNN::KT;
+  using RPDF = std::uniform_real_distribution<Real>;
+
+  auto engine = setup_random_test();
+  RPDF pdf(-1,1);
+
+  // A network with 2 hidden layers, with different widths
+  const int ncols = 7;
+  const std::vector<int> widths = {5, 8, 3, 4};
+  const int nlayers = widths.size()-1;
+  const int n_in  = widths.front();
+  const int n_out = widths.back();
+
+  auto random_view = [&](const std::string& name, const int n0, const int n1) {
+    KT::view_2d<Real> v(name,n0,n1);
+    auto v_h = Kokkos::create_mirror_view(v);
+    for (int i=0; i<n0; ++i) {
+      for (int j=0; j<n1; ++j) {
+        v_h(i,j) = pdf(engine);
+      }
+    }
+    Kokkos::deep_copy(v,v_h);
+    return v;
+  };
+  auto subview_0 = [](const KT::view_2d<Real>& v) {
+    return KT::view_1d<const Real>(Kokkos::subview(v,0,Kokkos::ALL));
+  };
+
+  std::vector<DenseNN::Layer> layers;
+  for (int i=0; i<nlayers; ++i) {
+    auto w = random_view("w",widths[i+1],widths[i]);
+    auto b = random_view("b",1,widths[i+1]);
+    layers.push_back({w,subview_0(b)});
+  }
+  auto in_mean  = random_view("in_mean",1,n_in);
+  auto out_mean = random_view("out_mean",1,n_out);
+  auto in_std   = KT::view_1d<Real>("in_std",n_in);
+  auto out_std  = KT::view_1d<Real>("out_std",n_out);
+  Kokkos::deep_copy(in_std,2);
+  Kokkos::deep_copy(out_std,0.5);
+
+  const Real tol = 100*std::numeric_limits<Real>::epsilon();
+
+  auto x = random_view("x",ncols,n_in);
+  KT::view_2d<Real> y("y",ncols,n_out);
+
+  for (auto act : {DenseNN::Activation::Linear, DenseNN::Activation::ReLU,
+                   DenseNN::Activation::Tanh, DenseNN::Activation::Sigmoid}) {
+    DenseNN nn (layers,act,subview_0(in_mean),in_std,subview_0(out_mean),out_std,
+                {"x"},{"y"});
+    REQUIRE (nn.num_inputs()==n_in);
+    REQUIRE (nn.num_outputs()==n_out);
+
+    nn.predict(x,y);
+
+    // Compute the expected result on host
+    auto activate = [&](const Real v) {
+      switch (act) {
+        case DenseNN::Activation::ReLU:    return std::max(v,Real(0));
+        case DenseNN::Activation::Tanh:    return std::tanh(v);
+        case DenseNN::Activation::Sigmoid: return 1/(1+std::exp(-v));
+        default:                           return v;
+      }
+    };
+    auto x_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),x);
+    auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),y);
+    auto in_mean_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),in_mean);
+    auto out_mean_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),out_mean);
+    for (int icol=0; icol<ncols; ++icol) {
+      std::vector<Real> z(n_in);
+      for (int k=0; k<n_in; ++k) {
+        z[k] = (x_h(icol,k)-in_mean_h(0,k))/2;
+      }
+      for (int i=0; i<nlayers; ++i) {
+        auto w_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),layers[i].weights);
+        auto b_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),layers[i].bias);
+        std::vector<Real> z_out(widths[i+1]);
+        for (int j=0; j<widths[i+1]; ++j) {
+          Real sum = b_h(j);
+          for (int k=0; k<widths[i]; ++k) {
+            sum += w_h(j,k)*z[k];
+          }
+          z_out[j] = i<nlayers-1 ? activate(sum) : sum;
+        }
+        z = z_out;
+      }
+      for (int k=0; k<n_out; ++k) {
+        const Real expected = z[k]*0.5 + out_mean_h(0,k);
+        REQUIRE (std::abs(y_h(icol,k)-expected) <= tol*std::max(Real(1),std::abs(expected)));
+      }
+    }
+  }
+
+  // Layers sizes must be consistent
+  std::vector<DenseNN::Layer> bad_layers = {layers[0],layers[2]};
+  REQUIRE_THROWS (DenseNN(bad_layers,DenseNN::Activation::ReLU,subview_0(in_mean),in_std,
+                          subview_0(out_mean),out_std,{"x"},{"y"}));
+}
+
+#ifdef EAMXX_ML_CORRECTION_HAS_PYTHON
+TEST_CASE("dense_nn_vs_python") {
+  namespace py = pybind11;
+  using KT = DenseNN::KT;
+  using RPDF = std::uniform_real_distribution<Real>;
+
+  auto engine = setup_random_test();
+  RPDF pdf(-1,1);
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  // Write a network with random weights to file, so that both the native
+  // and the python code can load the same weights
+  const int ncols = 11;
+  const std::vector<int> widths = {6, 9, 9, 2};
+  const int nlayers = widths.size()-1;
+  const int n_in  = widths.front();
+  const int n_out = widths.back();
+  auto random_vals = [&](const int n, const Real shift) {
+    std::vector<Real> v(n);
+    for (auto& val : v) {
+      val = pdf(engine) + shift;
+    }
+    return v;
+  };
+
+  for (std::string act : {"linear", "relu", "tanh", "sigmoid"}) {
+    const std::string filename = "dense_nn_" + act + "_np" + std::to_string(comm.size()) + ".nc";
+    scorpio::register_file(filename,scorpio::FileMode::Write);
+    scorpio::define_dim(filename,"n_input",n_in);
+    scorpio::define_dim(filename,"n_output",n_out);
+    for (const auto& name : {"input_mean","input_std"}) {
+      scorpio::define_var(filename,name,{"n_input"},"real");
+    }
+    for (const auto& name : {"output_mean","output_std"}) {
+      scorpio::define_var(filename,name,{"n_output"},"real");
+    }
+    for (int i=1; i<=nlayers; ++i) {
+      const auto prefix = "layer_" + std::to_string(i);
+      scorpio::define_dim(filename,prefix+"_in",widths[i-1]);
+      scorpio::define_dim(filename,prefix+"_out",widths[i]);
+      scorpio::define_var(filename,prefix+"_weights",{prefix+"_out",prefix+"_in"},"real");
+      scorpio::define_var(filename,prefix+"_bias",{prefix+"_out"},"real");
+    }
+    scorpio::set_attribute(filename,"GLOBAL","num_layers",nlayers);
+    scorpio::set_attribute(filename,"GLOBAL","activation",act);
+    scorpio::set_attribute(filename,"GLOBAL","input_variables","x");
+    scorpio::set_attribute(filename,"GLOBAL","output_variables","y");
+    scorpio::enddef(filename);
+    scorpio::write_var(filename,"input_mean",random_vals(n_in,0).data());
+    scorpio::write_var(filename,"input_std",random_vals(n_in,2).data());
+    scorpio::write_var(filename,"output_mean",random_vals(n_out,0).data());
+    scorpio::write_var(filename,"output_std",random_vals(n_out,2).data());
+    for (int i=1; i<=nlayers; ++i) {
+      const auto prefix = "layer_" + std::to_string(i);
+      scorpio::write_var(filename,prefix+"_weights",random_vals(widths[i]*widths[i-1],0).data());
+      scorpio::write_var(filename,prefix+"_bias",random_vals(widths[i],0).data());
+    }
+    scorpio::release_file(filename);
+
+    DenseNN nn(filename);
+    KT::view_2d<Real> x("x",ncols,n_in);
+    KT::view_2d<Real> y("y",ncols,n_out);
+    auto x_h = Kokkos::create_mirror_view(x);
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int k=0; k<n_in; ++k) {
+        x_h(icol,k) = 4*pdf(engine);
+      }
+    }
+    Kokkos::deep_copy(x,x_h);
+    nn.predict(x,y);
+    auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),y);
+
+    // Evaluate the same network with numpy
+    const int fpe_mask = ekat::get_enabled_fpes();
+    ekat::disable_all_fpes();  // required for numpy
+    if (Py_IsInitialized() == 0) {
+      py::initialize_interpreter();
+    }
+    py::module sys = py::module::import("sys");
+    sys.attr("path").attr("insert")(1, DENSE_NN_TESTS_PATH);
+    auto ref = py::module::import("dense_nn_reference");
+    py::array_t<Real> x_np({ncols,n_in},x_h.data());
+    auto y_np = ref.attr("predict")(filename,x_np).cast<py::array_t<Real,py::array::c_style|py::array::forcecast>>();
+    REQUIRE (y_np.ndim()==2);
+    REQUIRE (y_np.shape(0)==ncols);
+    REQUIRE (y_np.shape(1)==n_out);
+    auto y_ref = y_np.unchecked<2>();
+    ekat::enable_fpes(fpe_mask);
+
+    const Real tol = 1000*std::numeric_limits<Real>::epsilon();
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int k=0; k<n_out; ++k) {
+        REQUIRE (std::abs(y_h(icol,k)-y_ref(icol,k)) <= tol*std::max(Real(1),std::abs(y_ref(icol,k))));
+      }
+    }
+  }
+
+  scorpio::finalize_subsystem();
+}
+#endif
+
+} // namespace scream
@@ -38,11 +38,18 @@ void P3Microphysics::set_grids(const std::shared_ptr<const GridsManager> grids_m
   m_num_cols = m_grid->get_num_local_dofs(); // Number of columns on this rank
   m_num_levs = m_grid->get_num_vertical_levels();  // Number of levels per column
 
+  // Figure out column chunks stats. A non-positive chunk size means "all columns"
+  m_col_chunks = make_column_chunks(m_num_cols,m_params.get("column_chunk_size", m_num_cols));
+  this->log(LogLevel::debug,
+            "[P3Microphysics::set_grids] Col chunking stats:\n"
+            "  - Chunk size: " + std::to_string(m_col_chunks.size) + "\n"
+            "  - Number of chunks: " + std::to_string(m_col_chunks.num) + "\n");
+
   // --Infrastructure
   // dt is passed as an argument to run_impl
   infrastructure.it  = 0;
   infrastructure.its = 0;
-  infrastructure.ite = m_num_cols-1;
+  infrastructure.ite = m_col_chunks.size-1;
   infrastructure.kts = 0;
   infrastructure.kte = m_num_levs-1;
   infrastructure.predictNc = m_params.get<bool>("do_predict_nc",true);
@@ -125,18 +132,19 @@ size_t P3Microphysics::requested_buffer_size_in_bytes() const
   const Int nk_pack    = ekat::npack<Spack>(m_num_levs);
   const Int nk_pack_p1 = ekat::npack<Spack>(m_num_levs+1);
 
-  // Number of Reals needed by local views in the interface
+  // Number of Reals needed by local views in the interface. Local views
+  // (and the workspace) only need to store one column chunk at a time.
   const size_t interface_request =
       // 1d view scalar, size (ncol)
-      Buffer::num_1d_scalar*m_num_cols*sizeof(Real) +
+      Buffer::num_1d_scalar*m_col_chunks.size*sizeof(Real) +
       // 2d view packed, size (ncol, nlev_packs)
-      Buffer::num_2d_vector*m_num_cols*nk_pack*sizeof(Spack) +
-      Buffer::num_2dp1_vector*m_num_cols*nk_pack_p1*sizeof(Spack) +
+      Buffer::num_2d_vector*m_col_chunks.size*nk_pack*sizeof(Spack) +
+      Buffer::num_2dp1_vector*m_col_chunks.size*nk_pack_p1*sizeof(Spack) +
       // 2d view scalar, size (ncol, 3)
-      m_num_cols*3*sizeof(Real);
+      m_col_chunks.size*3*sizeof(Real);
 
   // Number of Reals needed by the WorkspaceManager passed to p3_main
-  const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
+  const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_col_chunks.size, nk_pack);
   const size_t wsm_request   = WSM::get_total_bytes_needed(nk_pack_p1, 52, policy);
 
   return interface_request + wsm_request;
@@ -150,13 +158,13 @@ void P3Microphysics::init_buffers(const ATMBufferManager &buffer_manager)
   Real* mem = reinterpret_cast<Real*>(buffer_manager.get_memory());
 
   // 1d scalar views
-  m_buffer.precip_liq_surf_flux = decltype(m_buffer.precip_liq_surf_flux)(mem, m_num_cols);
+  m_buffer.precip_liq_surf_flux = decltype(m_buffer.precip_liq_surf_flux)(mem, m_col_chunks.size);
   mem += m_buffer.precip_liq_surf_flux.size();
-  m_buffer.precip_ice_surf_flux = decltype(m_buffer.precip_ice_surf_flux)(mem, m_num_cols);
+  m_buffer.precip_ice_surf_flux = decltype(m_buffer.precip_ice_surf_flux)(mem, m_col_chunks.size);
   mem += m_buffer.precip_ice_surf_flux.size();
 
   // 2d scalar views
-  m_buffer.col_location = decltype(m_buffer.col_location)(mem, m_num_cols, 3);
+  m_buffer.col_location = decltype(m_buffer.col_location)(mem, m_col_chunks.size, 3);
   mem += m_buffer.col_location.size();
 
   Spack* s_mem = reinterpret_cast<Spack*>(mem);
@@ -165,25 +173,25 @@ void P3Microphysics::init_buffers(const ATMBufferManager &buffer_manager)
   const Int nk_pack    = ekat::npack<Spack>(m_num_levs);
   const Int nk_pack_p1 = ekat::npack<Spack>(m_num_levs+1);
 
-  m_buffer.inv_exner = decltype(m_buffer.inv_exner)(s_mem, m_num_cols, nk_pack);
+  m_buffer.inv_exner = decltype(m_buffer.inv_exner)(s_mem, m_col_chunks.size, nk_pack);
   s_mem += m_buffer.inv_exner.size();
-  m_buffer.th_atm = decltype(m_buffer.th_atm)(s_mem, m_num_cols, nk_pack);
+  m_buffer.th_atm = decltype(m_buffer.th_atm)(s_mem, m_col_chunks.size, nk_pack);
   s_mem += m_buffer.th_atm.size();
-  m_buffer.cld_frac_l = decltype(m_buffer.cld_frac_l)(s_mem, m_num_cols, nk_pack);
+  m_buffer.cld_frac_l = decltype(m_buffer.cld_frac_l)(s_mem, m_col_chunks.size, nk_pack);
   s_mem += m_buffer.cld_frac_l.size();
-  m_buffer.cld_frac_i = decltype(m_buffer.cld_frac_i)(s_mem, m_num_cols, nk_pack);
+  m_buffer.cld_frac_i = decltype(m_buffer.cld_frac_i)(s_mem, m_col_chunks.size, nk_pack);
   s_mem += m_buffer.cld_frac_i.size();
-  m_buffer.dz = decltype(m_buffer.dz)(s_mem, m_num_cols, nk_pack);
+  m_buffer.dz = decltype(m_buffer.dz)(s_mem, m_col_chunks.size, nk_pack);
   s_mem += m_buffer.dz.size();
-  m_buffer.qv2qi_depos_tend = decltype(m_buffer.qv2qi_depos_tend)(s_mem, m_num_cols, nk_pack);
+  m_buffer.qv2qi_depos_tend = decltype(m_buffer.qv2qi_depos_tend)(s_mem, m_col_chunks.size, nk_pack);
   s_mem += m_buffer.qv2qi_depos_tend.size();
-  m_buffer.rho_qi = decltype(m_buffer.rho_qi)(s_mem, m_num_cols, nk_pack);
+  m_buffer.rho_qi = decltype(m_buffer.rho_qi)(s_mem, m_col_chunks.size, nk_pack);
   s_mem += m_buffer.rho_qi.size();
-  m_buffer.precip_liq_flux = decltype(m_buffer.precip_liq_flux)(s_mem, m_num_cols, nk_pack_p1);
+  m_buffer.precip_liq_flux = decltype(m_buffer.precip_liq_flux)(s_mem, m_col_chunks.size, nk_pack_p1);
   s_mem += m_buffer.precip_liq_flux.size();
-  m_buffer.precip_ice_flux = decltype(m_buffer.precip_ice_flux)(s_mem, m_num_cols, nk_pack_p1);
+  m_buffer.precip_ice_flux = decltype(m_buffer.precip_ice_flux)(s_mem, m_col_chunks.size, nk_pack_p1);
   s_mem += m_buffer.precip_ice_flux.size();
-  m_buffer.unused = decltype(m_buffer.unused)(s_mem, m_num_cols, nk_pack);
+  m_buffer.unused = decltype(m_buffer.unused)(s_mem, m_col_chunks.size, nk_pack);
   s_mem += m_buffer.unused.size();
 
   // WSM data
@@ -191,7 +199,7 @@ void P3Microphysics::init_buffers(const ATMBufferManager &buffer_manager)
 
   // Compute workspace manager size to check used memory
   // vs. requested memory
-  const auto policy  = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
+  const auto policy  = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_col_chunks.size, nk_pack);
   const int wsm_size = WSM::get_total_bytes_needed(nk_pack_p1, 52, policy)/sizeof(Spack);
   s_mem += wsm_size;
 
@@ -234,40 +242,68 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   p3::p3_init(/* write_tables = */ false,
               this->get_comm().am_i_root());
 
+  // Initialize all of the structures that are passed to p3_main in run_impl.
+  // If running in column chunks, run_impl resets them for each chunk.
+  if (m_col_chunks.num>0) {
+    set_column_chunk(0);
+  }
+
+  // Load tables
+  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
+  P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
+                          lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
+                          lookup_tables.dnu_table_vals);
+
+  // Setup WSM for internal local variables. The WSM is sized for one column chunk,
+  // and reset before running each chunk.
+  const Int nk_pack = ekat::npack<Spack>(m_num_levs);
+  const Int nk_pack_p1 = ekat::npack<Spack>(m_num_levs+1);
+  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_col_chunks.size, nk_pack);
+  workspace_mgr.setup(m_buffer.wsm_data, nk_pack_p1, 52, policy);
+}
+
+// =========================================================================================
+void P3Microphysics::set_column_chunk (const int ichunk)
+{
   // Initialize all of the structures that are passed to p3_main in run_impl.
   // Note: Some variables in the structures are not stored in the field manager.  For these
   //       variables a local view is constructed.
+  // Note: field views are restricted to the chunk columns, while buffer views,
+  //       which only store one chunk, are restricted to the first ncol entries.
   const Int nk_pack = ekat::npack<Spack>(m_num_levs);
-  const Int nk_pack_p1 = ekat::npack<Spack>(m_num_levs+1);
-  const  auto& pmid           = get_field_in("p_mid").get_view<const Pack**>();
-  const  auto& pmid_dry       = get_field_in("p_dry_mid").get_view<const Pack**>();
-  const  auto& pseudo_density = get_field_in("pseudo_density").get_view<const Pack**>();
-  const  auto& pseudo_density_dry = get_field_in("pseudo_density_dry").get_view<const Pack**>();
-  const  auto& T_atm          = get_field_out("T_mid").get_view<Pack**>();
-  const  auto& cld_frac_t     = get_field_in("cldfrac_tot").get_view<const Pack**>();
-  const  auto& qv             = get_field_out("qv").get_view<Pack**>();
-  const  auto& qc             = get_field_out("qc").get_view<Pack**>();
-  const  auto& nc             = get_field_out("nc").get_view<Pack**>();
-  const  auto& qr             = get_field_out("qr").get_view<Pack**>();
-  const  auto& nr             = get_field_out("nr").get_view<Pack**>();
-  const  auto& qi             = get_field_out("qi").get_view<Pack**>();
-  const  auto& qm             = get_field_out("qm").get_view<Pack**>();
-  const  auto& ni             = get_field_out("ni").get_view<Pack**>();
-  const  auto& bm             = get_field_out("bm").get_view<Pack**>();
-  auto qv_prev                = get_field_out("qv_prev_micro_step").get_view<Pack**>();
-  const auto& precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real*>();
-  const auto& precip_ice_surf_mass = get_field_out("precip_ice_surf_mass").get_view<Real*>();
-  auto cld_frac_r             = get_field_out("rainfrac").get_view<Pack**>();
+  const int beg  = m_col_chunks.beg[ichunk];
+  const int ncol = m_col_chunks.ncols(ichunk);
+  const auto cols = std::make_pair(beg,beg+ncol);
+  const auto bcols = std::make_pair(0,ncol);
+  const  auto& pmid           = chunk(get_field_in("p_mid").get_view<const Pack**>(),cols);
+  const  auto& pmid_dry       = chunk(get_field_in("p_dry_mid").get_view<const Pack**>(),cols);
+  const  auto& pseudo_density = chunk(get_field_in("pseudo_density").get_view<const Pack**>(),cols);
+  const  auto& pseudo_density_dry = chunk(get_field_in("pseudo_density_dry").get_view<const Pack**>(),cols);
+  const  auto& T_atm          = chunk(get_field_out("T_mid").get_view<Pack**>(),cols);
+  const  auto& cld_frac_t     = chunk(get_field_in("cldfrac_tot").get_view<const Pack**>(),cols);
+  const  auto& qv             = chunk(get_field_out("qv").get_view<Pack**>(),cols);
+  const  auto& qc             = chunk(get_field_out("qc").get_view<Pack**>(),cols);
+  const  auto& nc             = chunk(get_field_out("nc").get_view<Pack**>(),cols);
+  const  auto& qr             = chunk(get_field_out("qr").get_view<Pack**>(),cols);
+  const  auto& nr             = chunk(get_field_out("nr").get_view<Pack**>(),cols);
+  const  auto& qi             = chunk(get_field_out("qi").get_view<Pack**>(),cols);
+  const  auto& qm             = chunk(get_field_out("qm").get_view<Pack**>(),cols);
+  const  auto& ni             = chunk(get_field_out("ni").get_view<Pack**>(),cols);
+  const  auto& bm             = chunk(get_field_out("bm").get_view<Pack**>(),cols);
+  auto qv_prev                = chunk(get_field_out("qv_prev_micro_step").get_view<Pack**>(),cols);
+  const auto& precip_liq_surf_mass = chunk(get_field_out("precip_liq_surf_mass").get_view<Real*>(),cols);
+  const auto& precip_ice_surf_mass = chunk(get_field_out("precip_ice_surf_mass").get_view<Real*>(),cols);
+  auto cld_frac_r             = chunk(get_field_out("rainfrac").get_view<Pack**>(),cols);
 
   // Alias local variables from temporary buffer
-  auto inv_exner  = m_buffer.inv_exner;
-  auto th_atm     = m_buffer.th_atm;
-  auto cld_frac_l = m_buffer.cld_frac_l;
-  auto cld_frac_i = m_buffer.cld_frac_i;
-  auto dz         = m_buffer.dz;
+  auto inv_exner  = chunk(m_buffer.inv_exner,bcols);
+  auto th_atm     = chunk(m_buffer.th_atm,bcols);
+  auto cld_frac_l = chunk(m_buffer.cld_frac_l,bcols);
+  auto cld_frac_i = chunk(m_buffer.cld_frac_i,bcols);
+  auto dz         = chunk(m_buffer.dz,bcols);
 
   // -- Set values for the pre-amble structure
-  p3_preproc.set_variables(m_num_cols,nk_pack,pmid,pmid_dry,pseudo_density,pseudo_density_dry,
+  p3_preproc.set_variables(ncol,nk_pack,pmid,pmid_dry,pseudo_density,pseudo_density_dry,
                         T_atm,cld_frac_t,
                         qv, qc, nc, qr, nr, qi, qm, ni, bm, qv_prev,
                         inv_exner, th_atm, cld_frac_l, cld_frac_i, cld_frac_r, dz);
@@ -283,20 +319,20 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   prog_state.th     = p3_preproc.th_atm;
   prog_state.qv     = p3_preproc.qv;
   // --Diagnostic Input Variables:
-  diag_inputs.nc_nuceat_tend  = get_field_in("nc_nuceat_tend").get_view<const Pack**>();
+  diag_inputs.nc_nuceat_tend  = chunk(get_field_in("nc_nuceat_tend").get_view<const Pack**>(),cols);
   if (infrastructure.prescribedCCN) {
-    diag_inputs.nccn          = get_field_in("nccn").get_view<const Pack**>();
+    diag_inputs.nccn          = chunk(get_field_in("nccn").get_view<const Pack**>(),cols);
   } else {
-    diag_inputs.nccn          = m_buffer.unused; //TODO set value of unused to something like 0.0 or nan as a layer of protection that it isn't being used.
+    diag_inputs.nccn          = chunk(m_buffer.unused,bcols); //TODO set value of unused to something like 0.0 or nan as a layer of protection that it isn't being used.
   }
-  diag_inputs.ni_activated    = get_field_in("ni_activated").get_view<const Pack**>();
-  diag_inputs.inv_qc_relvar   = get_field_in("inv_qc_relvar").get_view<const Pack**>();
+  diag_inputs.ni_activated    = chunk(get_field_in("ni_activated").get_view<const Pack**>(),cols);
+  diag_inputs.inv_qc_relvar   = chunk(get_field_in("inv_qc_relvar").get_view<const Pack**>(),cols);
 
   // P3 will use dry pressure for dry qv_sat
-  diag_inputs.pres            = get_field_in("p_dry_mid").get_view<const Pack**>();
+  diag_inputs.pres            = chunk(get_field_in("p_dry_mid").get_view<const Pack**>(),cols);
   diag_inputs.dpres           = p3_preproc.pseudo_density_dry; //give dry density as input
   diag_inputs.qv_prev         = p3_preproc.qv_prev;
-  auto t_prev                 = get_field_out("T_prev_micro_step").get_view<Pack**>();
+  auto t_prev                 = chunk(get_field_out("T_prev_micro_step").get_view<Pack**>(),cols);
   diag_inputs.t_prev          = t_prev;
   diag_inputs.cld_frac_l      = p3_preproc.cld_frac_l;
   diag_inputs.cld_frac_i      = p3_preproc.cld_frac_i;
@@ -304,24 +340,25 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   diag_inputs.dz              = p3_preproc.dz;
   diag_inputs.inv_exner       = p3_preproc.inv_exner;
   // --Diagnostic Outputs
-  diag_outputs.diag_eff_radius_qc = get_field_out("eff_radius_qc").get_view<Pack**>();
-  diag_outputs.diag_eff_radius_qi = get_field_out("eff_radius_qi").get_view<Pack**>();
-  diag_outputs.diag_eff_radius_qr = get_field_out("eff_radius_qr").get_view<Pack**>();
-
-  diag_outputs.precip_liq_surf  = m_buffer.precip_liq_surf_flux;
-  diag_outputs.precip_ice_surf  = m_buffer.precip_ice_surf_flux;
-  diag_outputs.qv2qi_depos_tend = m_buffer.qv2qi_depos_tend;
-  diag_outputs.rho_qi           = m_buffer.rho_qi;
-  diag_outputs.precip_liq_flux  = m_buffer.precip_liq_flux;
-  diag_outputs.precip_ice_flux  = m_buffer.precip_ice_flux;
+  diag_outputs.diag_eff_radius_qc = chunk(get_field_out("eff_radius_qc").get_view<Pack**>(),cols);
+  diag_outputs.diag_eff_radius_qi = chunk(get_field_out("eff_radius_qi").get_view<Pack**>(),cols);
+  diag_outputs.diag_eff_radius_qr = chunk(get_field_out("eff_radius_qr").get_view<Pack**>(),cols);
+
+  diag_outputs.precip_liq_surf  = chunk(m_buffer.precip_liq_surf_flux,bcols);
+  diag_outputs.precip_ice_surf  = chunk(m_buffer.precip_ice_surf_flux,bcols);
+  diag_outputs.qv2qi_depos_tend = chunk(m_buffer.qv2qi_depos_tend,bcols);
+  diag_outputs.rho_qi           = chunk(m_buffer.rho_qi,bcols);
+  diag_outputs.precip_liq_flux  = chunk(m_buffer.precip_liq_flux,bcols);
+  diag_outputs.precip_ice_flux  = chunk(m_buffer.precip_ice_flux,bcols);
   // -- Infrastructure, what is left to assign
-  infrastructure.col_location = m_buffer.col_location; // TODO: Initialize this here and now when P3 has access to lat/lon for each column.
+  infrastructure.ite = ncol-1;
+  infrastructure.col_location = chunk(m_buffer.col_location,bcols); // TODO: Initialize this here and now when P3 has access to lat/lon for each column.
   // --History Only
-  history_only.liq_ice_exchange = get_field_out("micro_liq_ice_exchange").get_view<Pack**>();
-  history_only.vap_liq_exchange = get_field_out("micro_vap_liq_exchange").get_view<Pack**>();
-  history_only.vap_ice_exchange = get_field_out("micro_vap_ice_exchange").get_view<Pack**>();
+  history_only.liq_ice_exchange = chunk(get_field_out("micro_liq_ice_exchange").get_view<Pack**>(),cols);
+  history_only.vap_liq_exchange = chunk(get_field_out("micro_vap_liq_exchange").get_view<Pack**>(),cols);
+  history_only.vap_ice_exchange = chunk(get_field_out("micro_vap_ice_exchange").get_view<Pack**>(),cols);
   // -- Set values for the post-amble structure
-  p3_postproc.set_variables(m_num_cols,nk_pack,
+  p3_postproc.set_variables(ncol,nk_pack,
                             prog_state.th,pmid,pmid_dry,T_atm,t_prev,
                             pseudo_density,pseudo_density_dry,
                             prog_state.qv, prog_state.qc, prog_state.nc, prog_state.qr,prog_state.nr,
@@ -332,22 +369,12 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
                             precip_liq_surf_mass,precip_ice_surf_mass);
 
   if (has_column_conservation_check()) {
-    const auto& vapor_flux = get_field_out("vapor_flux").get_view<Real*>();
-    const auto& water_flux = get_field_out("water_flux").get_view<Real*>();
-    const auto& ice_flux   = get_field_out("ice_flux").get_view<Real*>();
-    const auto& heat_flux  = get_field_out("heat_flux").get_view<Real*>();
+    const auto& vapor_flux = chunk(get_field_out("vapor_flux").get_view<Real*>(),cols);
+    const auto& water_flux = chunk(get_field_out("water_flux").get_view<Real*>(),cols);
+    const auto& ice_flux   = chunk(get_field_out("ice_flux").get_view<Real*>(),cols);
+    const auto& heat_flux  = chunk(get_field_out("heat_flux").get_view<Real*>(),cols);
     p3_postproc.set_mass_and_energy_fluxes(vapor_flux, water_flux, ice_flux, heat_flux);
   }
-
-  // Load tables
-  P3F::init_kokkos_ice_lookup_tables(lookup_tables.ice_table_vals, lookup_tables.collect_table_vals);
-  P3F::init_kokkos_tables(lookup_tables.vn_table_vals, lookup_tables.vm_table_vals,
-                          lookup_tables.revap_table_vals, lookup_tables.mu_r_table_vals,
-                          lookup_tables.dnu_table_vals);
-
-  // Setup WSM for internal local variables
-  const auto policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
-  workspace_mgr.setup(m_buffer.wsm_data, nk_pack_p1, 52, policy);
 }
 
 // =========================================================================================
@@ -2,6 +2,7 @@
 #define SCREAM_P3_MICROPHYSICS_HPP
 
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/util/eamxx_column_chunks.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "physics/p3/p3_functions.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
@@ -396,11 +397,18 @@ protected:
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager &buffer_manager);
 
+  // Point the p3_main structures to the fields/buffers of the given column chunk
+  void set_column_chunk (const int ichunk);
+
   // Keep track of field dimensions and the iteration count
   Int m_num_cols;
   Int m_num_levs;
   Int m_nk_pack;
 
+  // P3 can run on chunks of columns, so that local views and workspace
+  // are sized by the chunk size, rather than by the number of local columns
+  ColumnChunks m_col_chunks;
+
   // Struct which contains local variables
   Buffer m_buffer;
 
@@ -152,13 +152,17 @@ void Functions<S,D>
       TableIce table_ice;
       lookup_ice(qi_incld, ni_incld, qm_incld, rhop, table_ice, qi_gt_small);
 
-      table_val_qi_fallspd.set(qi_gt_small, apply_table_ice(1,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_eff_radius.set(qi_gt_small, apply_table_ice(5,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ni_lammax.set(qi_gt_small, apply_table_ice(6,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ni_lammin.set(qi_gt_small, apply_table_ice(7,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_reflectivity.set(qi_gt_small, apply_table_ice(8,  ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_mean_diam.set(qi_gt_small, apply_table_ice(10, ice_table_vals, table_ice, qi_gt_small));
-      table_val_ice_bulk_dens.set(qi_gt_small, apply_table_ice(11, ice_table_vals, table_ice, qi_gt_small));
+      constexpr int nice = 7;
+      const int ice_idx[nice] = {1, 5, 6, 7, 8, 10, 11};
+      Spack ice_vals[nice];
+      apply_table_ice(ice_idx, nice, ice_table_vals, table_ice, ice_vals, qi_gt_small);
+      table_val_qi_fallspd.set(qi_gt_small, ice_vals[0]);
+      table_val_ice_eff_radius.set(qi_gt_small, ice_vals[1]);
+      table_val_ni_lammax.set(qi_gt_small, ice_vals[2]);
+      table_val_ni_lammin.set(qi_gt_small, ice_vals[3]);
+      table_val_ice_reflectivity.set(qi_gt_small, ice_vals[4]);
+      table_val_ice_mean_diam.set(qi_gt_small, ice_vals[5]);
+      table_val_ice_bulk_dens.set(qi_gt_small, ice_vals[6]);
 
       // impose mean ice size bounds (i.e. apply lambda limiters)
       // note that the Nmax and Nmin are normalized and thus need to be multiplied by existing N
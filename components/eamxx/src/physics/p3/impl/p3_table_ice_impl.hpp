@@ -296,6 +296,107 @@ typename Functions<S,D>::Spack Functions<S,D>
   return proc;
 }
 
+template <typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::apply_table_ice(const int* index, const int& nidx, const view_ice_table& ice_table_vals,
+                  const TableIce& tab, Spack* proc, const Smask& context)
+{
+  // Lanes outside of context are not computed, so make sure they are zero
+  for (int q = 0; q < nidx; ++q) {
+    proc[q] = 0;
+  }
+
+  if (!context.any()) return;
+
+  const auto& t = ice_table_vals;
+  for (int s = 0; s < Spack::n; ++s) {
+    if (!context[s]) continue;
+
+    const int i  = tab.dumi[s];
+    const int ii = tab.dumii[s];
+    const int jj = tab.dumjj[s];
+
+    // Same weights (and order of operations) as the single-quantity version
+    const Scalar wi  = tab.dum1[s] - Scalar(i) - 1;
+    const Scalar wii = tab.dum4[s] - Scalar(ii) - 1;
+    const Scalar wjj = tab.dum5[s] - Scalar(jj) - 1;
+
+    // The quantity index is the fastest in the table, so for each q we read
+    // the same 8 nodes, which stay in cache across the loop.
+    for (int q = 0; q < nidx; ++q) {
+      const int idx = index[q];
+
+      // current density index
+      auto iproc1 = t(jj,ii,i,idx) + wi * (t(jj,ii,i+1,idx) - t(jj,ii,i,idx));
+      auto gproc1 = t(jj,ii+1,i,idx) + wi * (t(jj,ii+1,i+1,idx) - t(jj,ii+1,i,idx));
+      const auto tmp1 = iproc1 + wii * (gproc1-iproc1);
+
+      // density index + 1
+      iproc1 = t(jj+1,ii,i,idx) + wi * (t(jj+1,ii,i+1,idx) - t(jj+1,ii,i,idx));
+      gproc1 = t(jj+1,ii+1,i,idx) + wi * (t(jj+1,ii+1,i+1,idx) - t(jj+1,ii+1,i,idx));
+      const auto tmp2 = iproc1 + wii * (gproc1-iproc1);
+
+      proc[q][s] = tmp1 + wjj * (tmp2-tmp1);
+    }
+  }
+}
+
+template <typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>
+::apply_table_coll(const int* index, const int& nidx, const view_collect_table& collect_table_vals,
+                   const TableIce& ti, const TableRain& tr, Spack* proc, const Smask& context)
+{
+  // Lanes outside of context are not computed, so make sure they are zero
+  for (int q = 0; q < nidx; ++q) {
+    proc[q] = 0;
+  }
+
+  if (!context.any()) return;
+
+  const auto& t = collect_table_vals;
+  for (int s = 0; s < Spack::n; ++s) {
+    if (!context[s]) continue;
+
+    const int i  = ti.dumi[s];
+    const int ii = ti.dumii[s];
+    const int jj = ti.dumjj[s];
+    const int j  = tr.dumj[s];
+
+    // Same weights (and order of operations) as the single-quantity version
+    const Scalar wi  = ti.dum1[s] - Scalar(i) - 1;
+    const Scalar wii = ti.dum4[s] - Scalar(ii) - 1;
+    const Scalar wjj = ti.dum5[s] - Scalar(jj) - 1;
+    const Scalar wj  = tr.dum3[s] - Scalar(j) - 1;
+
+    // Interpolate along the ice size index, then along the rain size index
+    auto interp_ij = [&](const int djj, const int dii, const int idx) {
+      const auto dproc1 = t(jj+djj,ii+dii,i,j,idx) +
+        wi * (t(jj+djj,ii+dii,i+1,j,idx) - t(jj+djj,ii+dii,i,j,idx));
+      const auto dproc2 = t(jj+djj,ii+dii,i,j+1,idx) +
+        wi * (t(jj+djj,ii+dii,i+1,j+1,idx) - t(jj+djj,ii+dii,i,j+1,idx));
+      return dproc1 + wj * (dproc2-dproc1);
+    };
+
+    for (int q = 0; q < nidx; ++q) {
+      const int idx = index[q];
+
+      // current density index
+      auto iproc1 = interp_ij(0,0,idx);
+      auto gproc1 = interp_ij(0,1,idx);
+      const auto tmp1 = iproc1 + wii * (gproc1-iproc1);
+
+      // density index + 1
+      iproc1 = interp_ij(1,0,idx);
+      gproc1 = interp_ij(1,1,idx);
+      const auto tmp2 = iproc1 + wii * (gproc1-iproc1);
+
+      proc[q][s] = tmp1 + wjj * (tmp2-tmp1);
+    }
+  }
+}
+
 } // namespace p3
 } // namespace scream
 
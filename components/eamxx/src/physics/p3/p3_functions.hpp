@@ -327,6 +327,21 @@ struct Functions
                                 const TableIce& ti, const TableRain& tr,
                                 const Smask& context = Smask(true) );
 
+  // Multi-quantity versions of the above: interpolate the nidx quantities
+  // index[0],...,index[nidx-1] and store them in proc[0],...,proc[nidx-1].
+  // The table indices and weights are computed once per pack entry, and all
+  // quantities are read together at each table node, where they are contiguous.
+  // Results match the single-quantity versions; entries not in context are set to zero.
+  KOKKOS_FUNCTION
+  static void apply_table_ice(const int* index, const int& nidx, const view_ice_table& ice_table_vals,
+                              const TableIce& tab, Spack* proc,
+                              const Smask& context = Smask(true) );
+
+  KOKKOS_FUNCTION
+  static void apply_table_coll(const int* index, const int& nidx, const view_collect_table& collect_table_vals,
+                               const TableIce& ti, const TableRain& tr, Spack* proc,
+                               const Smask& context = Smask(true) );
+
   // -- Sedimentation time step
 
   // Calculate the first-order upwind step in the region [k_bot,
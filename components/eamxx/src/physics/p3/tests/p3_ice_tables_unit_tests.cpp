@@ -294,6 +294,101 @@ struct UnitWrap::UnitTest<D>::TestTableIce {
     }
   }
 
+  KOKKOS_INLINE_FUNCTION
+  static void lookup_from_inputs(const view_2d<const Real>& inputs, const Int& i, TableIce& ti, TableRain& tr)
+  {
+    Spack qi, ni, qm, rhop, qr, nr;
+    for (Int s = 0, vs = i*Spack::n; s < Spack::n; ++s, ++vs) {
+      qi[s]   = inputs(vs,0);
+      ni[s]   = inputs(vs,1);
+      qm[s]   = inputs(vs,2);
+      rhop[s] = inputs(vs,3);
+      qr[s]   = inputs(vs,4);
+      nr[s]   = inputs(vs,5);
+    }
+    Functions::lookup_ice(qi, ni, qm, rhop, ti);
+    Functions::lookup_rain(qr, nr, tr);
+  }
+
+  // Check that the multi-quantity table functions match the single-quantity ones,
+  // and time both on a large set of random lookups.
+  static void run_multi()
+  {
+    using KTH = KokkosTypes<HostDevice>;
+
+    view_ice_table ice_table_vals;
+    view_collect_table collect_table_vals;
+    Functions::init_kokkos_ice_lookup_tables(ice_table_vals, collect_table_vals);
+
+    constexpr Int nice  = Functions::P3C::ice_table_size;
+    constexpr Int ncoll = Functions::P3C::collect_table_size;
+    constexpr Int npacks = 4096;
+
+    // Random inputs, spanning the whole tables (and a bit beyond)
+    std::default_random_engine generator;
+    std::uniform_real_distribution<Real> log_q_dist(-12.0,-2.0), log_n_dist(2.0,8.0), frac_dist(0.0,1.0), rho_dist(0.0,1000.0);
+    KTH::view_2d<Real> inputs_h("inputs_h", npacks*Spack::n, 6);
+    for (size_t i = 0; i < inputs_h.extent(0); ++i) {
+      inputs_h(i,0) = std::pow(10,log_q_dist(generator)); // qi
+      inputs_h(i,1) = std::pow(10,log_n_dist(generator)); // ni
+      inputs_h(i,2) = frac_dist(generator)*inputs_h(i,0); // qm
+      inputs_h(i,3) = rho_dist(generator);                // rhop
+      inputs_h(i,4) = std::pow(10,log_q_dist(generator)); // qr
+      inputs_h(i,5) = std::pow(10,log_n_dist(generator)); // nr
+    }
+    view_2d<Real> inputs_d("inputs", inputs_h.extent(0), inputs_h.extent(1));
+    Kokkos::deep_copy(inputs_d, inputs_h);
+    const view_2d<const Real> inputs = inputs_d;
+
+    view_2d<Spack> single("single", npacks, nice+ncoll), multi("multi", npacks, nice+ncoll);
+    const RangePolicy policy(0, npacks);
+
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const Int& i) {
+      TableIce ti;
+      TableRain tr;
+      lookup_from_inputs(inputs, i, ti, tr);
+      for (Int q = 0; q < nice; ++q) {
+        single(i,q) = Functions::apply_table_ice(q, ice_table_vals, ti);
+      }
+      for (Int q = 0; q < ncoll; ++q) {
+        single(i,nice+q) = Functions::apply_table_coll(q, collect_table_vals, ti, tr);
+      }
+    });
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const Int& i) {
+      TableIce ti;
+      TableRain tr;
+      lookup_from_inputs(inputs, i, ti, tr);
+      Int ice_idx[nice], coll_idx[ncoll];
+      Spack ice_vals[nice], coll_vals[ncoll];
+      for (Int q = 0; q < nice; ++q) {
+        ice_idx[q] = q;
+      }
+      for (Int q = 0; q < ncoll; ++q) {
+        coll_idx[q] = q;
+      }
+      Functions::apply_table_ice(ice_idx, nice, ice_table_vals, ti, ice_vals);
+      Functions::apply_table_coll(coll_idx, ncoll, collect_table_vals, ti, tr, coll_vals);
+      for (Int q = 0; q < nice; ++q) {
+        multi(i,q) = ice_vals[q];
+      }
+      for (Int q = 0; q < ncoll; ++q) {
+        multi(i,nice+q) = coll_vals[q];
+      }
+    });
+
+    const auto single_h = Kokkos::create_mirror_view(single);
+    const auto multi_h  = Kokkos::create_mirror_view(multi);
+    Kokkos::deep_copy(single_h, single);
+    Kokkos::deep_copy(multi_h, multi);
+    for (Int i = 0; i < npacks; ++i) {
+      for (Int q = 0; q < nice+ncoll; ++q) {
+        for (Int s = 0; s < Spack::n; ++s) {
+          REQUIRE(single_h(i,q)[s] == multi_h(i,q)[s]);
+        }
+      }
+    }
+  }
+
   static void run_phys()
   {
 #if 0
@@ -348,6 +443,7 @@ TEST_CASE("p3_ice_tables", "[p3_functions]")
   TTI::test_read_lookup_tables_bfb();
   TTI::run_phys();
   TTI::run_bfb();
+  TTI::run_multi();
 }
 
 }
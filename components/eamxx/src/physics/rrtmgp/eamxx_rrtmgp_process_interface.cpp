@@ -5,6 +5,8 @@
 #include "physics/share/scream_trcmix.hpp"
 
 #include "share/io/scream_scorpio_interface.hpp"
+#include "share/grid/remap/coarsening_remapper.hpp"
+#include "share/grid/remap/refining_remapper_p2p.hpp"
 #include "share/util/eamxx_fv_phys_rrtmgp_active_gases_workaround.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
@@ -12,6 +14,8 @@
 
 #include "ekat/ekat_assert.hpp"
 
+#include <set>
+
 #include "cpp/rrtmgp/mo_gas_concentrations.h"
 #ifdef RRTMGP_ENABLE_YAKL
 #include "YAKL.h"
@@ -40,6 +44,16 @@ RRTMGPRadiation (const ekat::Comm& comm, const ekat::ParameterList& params)
   }
 
   m_ngas = m_gas_names.size();
+
+  // If we interpolate the heating in between rad steps, the number of stored rad
+  // states and the step of the last rad call are needed for a BFB restart
+  if (m_params.get<bool>("interpolate_rad_heating",false) and m_params.get<Int>("rad_frequency",1)>1) {
+    ekat::any num_rad_states, last_rad_step;
+    num_rad_states.reset<int>(0);
+    last_rad_step.reset<int>(-1);
+    m_restart_extra_data["rrtmgp_num_rad_states"] = num_rad_states;
+    m_restart_extra_data["rrtmgp_last_rad_step"]  = last_rad_step;
+  }
 }
 
 void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_manager) {
@@ -70,17 +84,73 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
     m_lon = m_grid->get_geometry_data("lon");
   }
 
+  // If requested, run radiation on a coarser grid. The fields are still requested
+  // on the physics grid, and remapped to/from the rad grid in run_impl.
+  m_ncol_phys = m_ncol;
+  m_rad_grid = m_grid;
+  if (m_params.isParameter("coarse_grid_coarsening_mapfile")) {
+    EKAT_REQUIRE_MSG (m_params.isParameter("coarse_grid_refining_mapfile"),
+        "Error! Running radiation on a coarse grid requires both the coarsening and refining map files.\n"
+        " - missing parameter: coarse_grid_refining_mapfile\n");
+    EKAT_REQUIRE_MSG (not m_iop,
+        "Error! Running radiation on a coarse grid is not supported in IOP runs.\n");
+    const auto& coarsening_mapfile = m_params.get<std::string>("coarse_grid_coarsening_mapfile");
+    const auto& refining_mapfile   = m_params.get<std::string>("coarse_grid_refining_mapfile");
+    m_coarsener = std::make_shared<CoarseningRemapper>(m_grid,coarsening_mapfile);
+    m_refiner   = std::make_shared<RefiningRemapperP2P>(m_grid,refining_mapfile);
+    m_rad_grid  = m_coarsener->get_tgt_grid();
+
+    const auto& refiner_grid = m_refiner->get_src_grid();
+    EKAT_REQUIRE_MSG (refiner_grid->get_num_global_dofs()==m_rad_grid->get_num_global_dofs(),
+        "Error! The coarsening and refining map files use different coarse grids.\n"
+        " - coarsening map file: " + coarsening_mapfile + "\n"
+        " - refining map file  : " + refining_mapfile + "\n"
+        " - coarse grid num global cols (coarsening): " + std::to_string(m_rad_grid->get_num_global_dofs()) + "\n"
+        " - coarse grid num global cols (refining)  : " + std::to_string(refiner_grid->get_num_global_dofs()) + "\n");
+
+    // The two remappers may partition the coarse grid differently. If so, we need
+    // to move the rad outputs to the refiner coarse grid before refining them.
+    using gid_type = AbstractGrid::gid_type;
+    auto rad_gids = m_rad_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+    auto ref_gids = refiner_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+    int same_gids = rad_gids.size()==ref_gids.size() and
+                    std::equal(rad_gids.data(),rad_gids.data()+rad_gids.size(),ref_gids.data());
+    m_comm.all_reduce(&same_gids,1,MPI_MIN);
+    if (not same_gids) {
+      m_rad_grid_imp_exp = std::make_shared<GridImportExport>(m_rad_grid,refiner_grid);
+    }
+
+    m_ncol = m_rad_grid->get_num_local_dofs();
+    m_lat = m_rad_grid->get_geometry_data("lat");
+    m_lon = m_rad_grid->get_geometry_data("lon");
+    this->log(LogLevel::info,
+              "[RRTMGP::set_grids] Running radiation on a coarse grid:\n"
+              "  - num global physics cols: " + std::to_string(m_grid->get_num_global_dofs()) + "\n"
+              "  - num global rad cols    : " + std::to_string(m_rad_grid->get_num_global_dofs()) + "\n");
+  }
+
   // Figure out radiation column chunks stats
-  m_col_chunk_size = std::min(m_params.get("column_chunk_size", m_ncol),m_ncol);
-  m_num_col_chunks = (m_ncol+m_col_chunk_size-1) / m_col_chunk_size;
-  m_col_chunk_beg.resize(m_num_col_chunks+1,0);
-  for (int i=0; i<m_num_col_chunks; ++i) {
-    m_col_chunk_beg[i+1] = std::min(m_ncol,m_col_chunk_beg[i] + m_col_chunk_size);
+  m_col_chunks = make_column_chunks(m_ncol,m_params.get("column_chunk_size", m_ncol));
+
+  // If requested, balance the daytime columns of SW across ranks. The exchange
+  // happens once per chunk, so all ranks must have the same number of chunks.
+  // Ranks with fewer columns than chunks get some empty chunks, during which
+  // they only compute columns received from other ranks.
+  m_balance_sw_columns = m_params.get<bool>("balance_sw_columns",false);
+#ifndef RRTMGP_ENABLE_YAKL
+  EKAT_REQUIRE_MSG (not m_balance_sw_columns,
+      "Error! The option 'balance_sw_columns' is only implemented for the YAKL version of RRTMGP.\n"
+      "  Either disable it, or build with RRTMGP_ENABLE_YAKL.\n");
+#endif
+  if (m_balance_sw_columns) {
+    int num_col_chunks;
+    m_comm.all_reduce(&m_col_chunks.num,&num_col_chunks,1,MPI_MAX);
+    m_col_chunks = make_column_chunks_by_number(m_ncol,num_col_chunks);
   }
   this->log(LogLevel::debug,
             "[RRTMGP::set_grids] Col chunking stats:\n"
-            "  - Chunk size: " + std::to_string(m_col_chunk_size) + "\n"
-            "  - Number of chunks: " + std::to_string(m_num_col_chunks) + "\n");
+            "  - Chunk size: " + std::to_string(m_col_chunks.size) + "\n"
+            "  - Number of chunks: " + std::to_string(m_col_chunks.num) + "\n");
 
   // Set up dimension layouts
   m_nswgpts = m_params.get<int>("nswgpts",112);
@@ -203,6 +273,30 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
     add_field<Computed>("heat_flux",  scalar2d, W/m2,    grid_name);
   }
 
+  // If requested, interpolate the heating in between rad steps (only makes sense if rad_frequency>1).
+  // The rad states used for the interpolation are internal fields, so that they are restarted.
+  m_rad_freq_in_steps = m_params.get<Int>("rad_frequency", 1);
+  m_interp_rad_heating = m_params.get<bool>("interpolate_rad_heating",false) and m_rad_freq_in_steps>1;
+  if (m_interp_rad_heating) {
+    EKAT_REQUIRE_MSG (not m_coarsener,
+        "Error! Interpolating rad heating is not supported when running radiation on a coarse grid.\n");
+    // The boundary heat flux is computed from the fluxes of the last rad step, which
+    // are not consistent with the interpolated heating applied in between rad steps.
+    EKAT_REQUIRE_MSG (not has_column_conservation_check(),
+        "Error! Interpolating rad heating is not supported with column conservation checks.\n"
+        "  The boundary heat flux would not match the interpolated heating.\n");
+    auto create_internal_field = [&](const std::string& name, const FieldLayout& layout, const Units& u) {
+      Field f(FieldIdentifier(name,layout,u,grid_name));
+      f.allocate_view();
+      add_internal_field(f);
+      return f;
+    };
+    m_mu0_rad         = create_internal_field("rrtmgp_mu0_rad",        scalar2d,    nondim).get_view<Real*>();
+    m_sw_heating_rad  = create_internal_field("rrtmgp_sw_heating_rad", scalar3d_mid,K/s).get_view<Real**>();
+    m_lw_heating_rad  = create_internal_field("rrtmgp_lw_heating_rad", scalar3d_mid,K/s).get_view<Real**>();
+    m_lw_heating_prev = create_internal_field("rrtmgp_lw_heating_prev",scalar3d_mid,K/s).get_view<Real**>();
+  }
+
   // Load bands bounds from coefficients files and compute the band centerpoint.
   // Store both in the grid (if not already present)
   const auto cm = centi*m;
@@ -246,16 +340,16 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
 size_t RRTMGPRadiation::requested_buffer_size_in_bytes() const
 {
   const size_t interface_request =
-    Buffer::num_1d_ncol*m_col_chunk_size +
-    Buffer::num_2d_nlay*m_col_chunk_size*m_nlay +
-    Buffer::num_2d_nlay_p1*m_col_chunk_size*(m_nlay+1) +
-    Buffer::num_2d_nswbands*m_col_chunk_size*m_nswbands +
-    Buffer::num_3d_nlev_nswbands*m_col_chunk_size*(m_nlay+1)*m_nswbands +
-    Buffer::num_3d_nlev_nlwbands*m_col_chunk_size*(m_nlay+1)*m_nlwbands +
-    Buffer::num_3d_nlay_nswbands*m_col_chunk_size*(m_nlay)*m_nswbands +
-    Buffer::num_3d_nlay_nlwbands*m_col_chunk_size*(m_nlay)*m_nlwbands +
-    Buffer::num_3d_nlay_nswgpts*m_col_chunk_size*(m_nlay)*m_nswgpts +
-    Buffer::num_3d_nlay_nlwgpts*m_col_chunk_size*(m_nlay)*m_nlwgpts;
+    Buffer::num_1d_ncol*m_col_chunks.size +
+    Buffer::num_2d_nlay*m_col_chunks.size*m_nlay +
+    Buffer::num_2d_nlay_p1*m_col_chunks.size*(m_nlay+1) +
+    Buffer::num_2d_nswbands*m_col_chunks.size*m_nswbands +
+    Buffer::num_3d_nlev_nswbands*m_col_chunks.size*(m_nlay+1)*m_nswbands +
+    Buffer::num_3d_nlev_nlwbands*m_col_chunks.size*(m_nlay+1)*m_nlwbands +
+    Buffer::num_3d_nlay_nswbands*m_col_chunks.size*(m_nlay)*m_nswbands +
+    Buffer::num_3d_nlay_nlwbands*m_col_chunks.size*(m_nlay)*m_nlwbands +
+    Buffer::num_3d_nlay_nswgpts*m_col_chunks.size*(m_nlay)*m_nswgpts +
+    Buffer::num_3d_nlay_nlwgpts*m_col_chunks.size*(m_nlay)*m_nlwgpts;
 
   return interface_request * sizeof(Real);
 } // RRTMGPRadiation::requested_buffer_size
@@ -269,143 +363,143 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
 
 #ifdef RRTMGP_ENABLE_YAKL
   // 1d arrays
-  m_buffer.mu0 = decltype(m_buffer.mu0)("mu0", mem, m_col_chunk_size);
+  m_buffer.mu0 = decltype(m_buffer.mu0)("mu0", mem, m_col_chunks.size);
   mem += m_buffer.mu0.totElems();
-  m_buffer.sfc_alb_dir_vis = decltype(m_buffer.sfc_alb_dir_vis)("sfc_alb_dir_vis", mem, m_col_chunk_size);
+  m_buffer.sfc_alb_dir_vis = decltype(m_buffer.sfc_alb_dir_vis)("sfc_alb_dir_vis", mem, m_col_chunks.size);
   mem += m_buffer.sfc_alb_dir_vis.totElems();
-  m_buffer.sfc_alb_dir_nir = decltype(m_buffer.sfc_alb_dir_nir)("sfc_alb_dir_nir", mem, m_col_chunk_size);
+  m_buffer.sfc_alb_dir_nir = decltype(m_buffer.sfc_alb_dir_nir)("sfc_alb_dir_nir", mem, m_col_chunks.size);
   mem += m_buffer.sfc_alb_dir_nir.totElems();
-  m_buffer.sfc_alb_dif_vis = decltype(m_buffer.sfc_alb_dif_vis)("sfc_alb_dif_vis", mem, m_col_chunk_size);
+  m_buffer.sfc_alb_dif_vis = decltype(m_buffer.sfc_alb_dif_vis)("sfc_alb_dif_vis", mem, m_col_chunks.size);
   mem += m_buffer.sfc_alb_dif_vis.totElems();
-  m_buffer.sfc_alb_dif_nir = decltype(m_buffer.sfc_alb_dif_nir)("sfc_alb_dif_nir", mem, m_col_chunk_size);
+  m_buffer.sfc_alb_dif_nir = decltype(m_buffer.sfc_alb_dif_nir)("sfc_alb_dif_nir", mem, m_col_chunks.size);
   mem += m_buffer.sfc_alb_dif_nir.totElems();
-  m_buffer.sfc_flux_dir_vis = decltype(m_buffer.sfc_flux_dir_vis)("sfc_flux_dir_vis", mem, m_col_chunk_size);
+  m_buffer.sfc_flux_dir_vis = decltype(m_buffer.sfc_flux_dir_vis)("sfc_flux_dir_vis", mem, m_col_chunks.size);
   mem += m_buffer.sfc_flux_dir_vis.totElems();
-  m_buffer.sfc_flux_dir_nir = decltype(m_buffer.sfc_flux_dir_nir)("sfc_flux_dir_nir", mem, m_col_chunk_size);
+  m_buffer.sfc_flux_dir_nir = decltype(m_buffer.sfc_flux_dir_nir)("sfc_flux_dir_nir", mem, m_col_chunks.size);
   mem += m_buffer.sfc_flux_dir_nir.totElems();
-  m_buffer.sfc_flux_dif_vis = decltype(m_buffer.sfc_flux_dif_vis)("sfc_flux_dif_vis", mem, m_col_chunk_size);
+  m_buffer.sfc_flux_dif_vis = decltype(m_buffer.sfc_flux_dif_vis)("sfc_flux_dif_vis", mem, m_col_chunks.size);
   mem += m_buffer.sfc_flux_dif_vis.totElems();
-  m_buffer.sfc_flux_dif_nir = decltype(m_buffer.sfc_flux_dif_nir)("sfc_flux_dif_nir", mem, m_col_chunk_size);
+  m_buffer.sfc_flux_dif_nir = decltype(m_buffer.sfc_flux_dif_nir)("sfc_flux_dif_nir", mem, m_col_chunks.size);
   mem += m_buffer.sfc_flux_dif_nir.totElems();
-  m_buffer.cosine_zenith = decltype(m_buffer.cosine_zenith)(mem, m_col_chunk_size);
+  m_buffer.cosine_zenith = decltype(m_buffer.cosine_zenith)(mem, m_col_chunks.size);
   mem += m_buffer.cosine_zenith.size();
 
   // 2d arrays
-  m_buffer.p_lay = decltype(m_buffer.p_lay)("p_lay", mem, m_col_chunk_size, m_nlay);
+  m_buffer.p_lay = decltype(m_buffer.p_lay)("p_lay", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.p_lay.totElems();
-  m_buffer.t_lay = decltype(m_buffer.t_lay)("t_lay", mem, m_col_chunk_size, m_nlay);
+  m_buffer.t_lay = decltype(m_buffer.t_lay)("t_lay", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.t_lay.totElems();
-  m_buffer.z_del = decltype(m_buffer.z_del)("z_del", mem, m_col_chunk_size, m_nlay);
+  m_buffer.z_del = decltype(m_buffer.z_del)("z_del", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.z_del.totElems();
-  m_buffer.p_del = decltype(m_buffer.p_del)("p_del", mem, m_col_chunk_size, m_nlay);
+  m_buffer.p_del = decltype(m_buffer.p_del)("p_del", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.p_del.totElems();
-  m_buffer.qc = decltype(m_buffer.qc)("qc", mem, m_col_chunk_size, m_nlay);
+  m_buffer.qc = decltype(m_buffer.qc)("qc", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.qc.totElems();
-  m_buffer.nc = decltype(m_buffer.nc)("nc", mem, m_col_chunk_size, m_nlay);
+  m_buffer.nc = decltype(m_buffer.nc)("nc", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.nc.totElems();
-  m_buffer.qi = decltype(m_buffer.qi)("qi", mem, m_col_chunk_size, m_nlay);
+  m_buffer.qi = decltype(m_buffer.qi)("qi", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.qi.totElems();
-  m_buffer.cldfrac_tot = decltype(m_buffer.cldfrac_tot)("cldfrac_tot", mem, m_col_chunk_size, m_nlay);
+  m_buffer.cldfrac_tot = decltype(m_buffer.cldfrac_tot)("cldfrac_tot", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.cldfrac_tot.totElems();
-  m_buffer.eff_radius_qc = decltype(m_buffer.eff_radius_qc)("eff_radius_qc", mem, m_col_chunk_size, m_nlay);
+  m_buffer.eff_radius_qc = decltype(m_buffer.eff_radius_qc)("eff_radius_qc", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.eff_radius_qc.totElems();
-  m_buffer.eff_radius_qi = decltype(m_buffer.eff_radius_qi)("eff_radius_qi", mem, m_col_chunk_size, m_nlay);
+  m_buffer.eff_radius_qi = decltype(m_buffer.eff_radius_qi)("eff_radius_qi", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.eff_radius_qi.totElems();
-  m_buffer.tmp2d = decltype(m_buffer.tmp2d)("tmp2d", mem, m_col_chunk_size, m_nlay);
+  m_buffer.tmp2d = decltype(m_buffer.tmp2d)("tmp2d", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.tmp2d.totElems();
-  m_buffer.lwp = decltype(m_buffer.lwp)("lwp", mem, m_col_chunk_size, m_nlay);
+  m_buffer.lwp = decltype(m_buffer.lwp)("lwp", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.lwp.totElems();
-  m_buffer.iwp = decltype(m_buffer.iwp)("iwp", mem, m_col_chunk_size, m_nlay);
+  m_buffer.iwp = decltype(m_buffer.iwp)("iwp", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.iwp.totElems();
-  m_buffer.sw_heating = decltype(m_buffer.sw_heating)("sw_heating", mem, m_col_chunk_size, m_nlay);
+  m_buffer.sw_heating = decltype(m_buffer.sw_heating)("sw_heating", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.sw_heating.totElems();
-  m_buffer.lw_heating = decltype(m_buffer.lw_heating)("lw_heating", mem, m_col_chunk_size, m_nlay);
+  m_buffer.lw_heating = decltype(m_buffer.lw_heating)("lw_heating", mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.lw_heating.totElems();
-  m_buffer.p_lev = decltype(m_buffer.p_lev)("p_lev", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.p_lev = decltype(m_buffer.p_lev)("p_lev", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.p_lev.totElems();
-  m_buffer.t_lev = decltype(m_buffer.t_lev)("t_lev", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.t_lev = decltype(m_buffer.t_lev)("t_lev", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.t_lev.totElems();
-  m_buffer.d_tint = decltype(m_buffer.d_tint)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.d_tint = decltype(m_buffer.d_tint)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.d_tint.size();
-  m_buffer.d_dz  = decltype(m_buffer.d_dz )(mem, m_col_chunk_size, m_nlay);
+  m_buffer.d_dz  = decltype(m_buffer.d_dz )(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.d_dz.size();
   // 3d arrays
-  m_buffer.sw_flux_up = decltype(m_buffer.sw_flux_up)("sw_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_flux_up = decltype(m_buffer.sw_flux_up)("sw_flux_up", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_flux_up.totElems();
-  m_buffer.sw_flux_dn = decltype(m_buffer.sw_flux_dn)("sw_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_flux_dn = decltype(m_buffer.sw_flux_dn)("sw_flux_dn", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_flux_dn.totElems();
-  m_buffer.sw_flux_dn_dir = decltype(m_buffer.sw_flux_dn_dir)("sw_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_flux_dn_dir = decltype(m_buffer.sw_flux_dn_dir)("sw_flux_dn_dir", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_flux_dn_dir.totElems();
-  m_buffer.lw_flux_up = decltype(m_buffer.lw_flux_up)("lw_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_flux_up = decltype(m_buffer.lw_flux_up)("lw_flux_up", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_flux_up.totElems();
-  m_buffer.lw_flux_dn = decltype(m_buffer.lw_flux_dn)("lw_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_flux_dn = decltype(m_buffer.lw_flux_dn)("lw_flux_dn", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_flux_dn.totElems();
-  m_buffer.sw_clnclrsky_flux_up = decltype(m_buffer.sw_clnclrsky_flux_up)("sw_clnclrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnclrsky_flux_up = decltype(m_buffer.sw_clnclrsky_flux_up)("sw_clnclrsky_flux_up", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnclrsky_flux_up.totElems();
-  m_buffer.sw_clnclrsky_flux_dn = decltype(m_buffer.sw_clnclrsky_flux_dn)("sw_clnclrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnclrsky_flux_dn = decltype(m_buffer.sw_clnclrsky_flux_dn)("sw_clnclrsky_flux_dn", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnclrsky_flux_dn.totElems();
-  m_buffer.sw_clnclrsky_flux_dn_dir = decltype(m_buffer.sw_clnclrsky_flux_dn_dir)("sw_clnclrsky_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnclrsky_flux_dn_dir = decltype(m_buffer.sw_clnclrsky_flux_dn_dir)("sw_clnclrsky_flux_dn_dir", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnclrsky_flux_dn_dir.totElems();
-  m_buffer.sw_clrsky_flux_up = decltype(m_buffer.sw_clrsky_flux_up)("sw_clrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clrsky_flux_up = decltype(m_buffer.sw_clrsky_flux_up)("sw_clrsky_flux_up", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clrsky_flux_up.totElems();
-  m_buffer.sw_clrsky_flux_dn = decltype(m_buffer.sw_clrsky_flux_dn)("sw_clrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clrsky_flux_dn = decltype(m_buffer.sw_clrsky_flux_dn)("sw_clrsky_flux_dn", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clrsky_flux_dn.totElems();
-  m_buffer.sw_clrsky_flux_dn_dir = decltype(m_buffer.sw_clrsky_flux_dn_dir)("sw_clrsky_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clrsky_flux_dn_dir = decltype(m_buffer.sw_clrsky_flux_dn_dir)("sw_clrsky_flux_dn_dir", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clrsky_flux_dn_dir.totElems();
-  m_buffer.sw_clnsky_flux_up = decltype(m_buffer.sw_clnsky_flux_up)("sw_clnsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnsky_flux_up = decltype(m_buffer.sw_clnsky_flux_up)("sw_clnsky_flux_up", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnsky_flux_up.totElems();
-  m_buffer.sw_clnsky_flux_dn = decltype(m_buffer.sw_clnsky_flux_dn)("sw_clnsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnsky_flux_dn = decltype(m_buffer.sw_clnsky_flux_dn)("sw_clnsky_flux_dn", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnsky_flux_dn.totElems();
-  m_buffer.sw_clnsky_flux_dn_dir = decltype(m_buffer.sw_clnsky_flux_dn_dir)("sw_clnsky_flux_dn_dir", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnsky_flux_dn_dir = decltype(m_buffer.sw_clnsky_flux_dn_dir)("sw_clnsky_flux_dn_dir", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnsky_flux_dn_dir.totElems();
-  m_buffer.lw_clnclrsky_flux_up = decltype(m_buffer.lw_clnclrsky_flux_up)("lw_clnclrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clnclrsky_flux_up = decltype(m_buffer.lw_clnclrsky_flux_up)("lw_clnclrsky_flux_up", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clnclrsky_flux_up.totElems();
-  m_buffer.lw_clnclrsky_flux_dn = decltype(m_buffer.lw_clnclrsky_flux_dn)("lw_clnclrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clnclrsky_flux_dn = decltype(m_buffer.lw_clnclrsky_flux_dn)("lw_clnclrsky_flux_dn", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clnclrsky_flux_dn.totElems();
-  m_buffer.lw_clrsky_flux_up = decltype(m_buffer.lw_clrsky_flux_up)("lw_clrsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clrsky_flux_up = decltype(m_buffer.lw_clrsky_flux_up)("lw_clrsky_flux_up", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clrsky_flux_up.totElems();
-  m_buffer.lw_clrsky_flux_dn = decltype(m_buffer.lw_clrsky_flux_dn)("lw_clrsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clrsky_flux_dn = decltype(m_buffer.lw_clrsky_flux_dn)("lw_clrsky_flux_dn", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clrsky_flux_dn.totElems();
-  m_buffer.lw_clnsky_flux_up = decltype(m_buffer.lw_clnsky_flux_up)("lw_clnsky_flux_up", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clnsky_flux_up = decltype(m_buffer.lw_clnsky_flux_up)("lw_clnsky_flux_up", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clnsky_flux_up.totElems();
-  m_buffer.lw_clnsky_flux_dn = decltype(m_buffer.lw_clnsky_flux_dn)("lw_clnsky_flux_dn", mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clnsky_flux_dn = decltype(m_buffer.lw_clnsky_flux_dn)("lw_clnsky_flux_dn", mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clnsky_flux_dn.totElems();
   // 3d arrays with nswbands dimension (shortwave fluxes by band)
-  m_buffer.sw_bnd_flux_up = decltype(m_buffer.sw_bnd_flux_up)("sw_bnd_flux_up", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  m_buffer.sw_bnd_flux_up = decltype(m_buffer.sw_bnd_flux_up)("sw_bnd_flux_up", mem, m_col_chunks.size, m_nlay+1, m_nswbands);
   mem += m_buffer.sw_bnd_flux_up.totElems();
-  m_buffer.sw_bnd_flux_dn = decltype(m_buffer.sw_bnd_flux_dn)("sw_bnd_flux_dn", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  m_buffer.sw_bnd_flux_dn = decltype(m_buffer.sw_bnd_flux_dn)("sw_bnd_flux_dn", mem, m_col_chunks.size, m_nlay+1, m_nswbands);
   mem += m_buffer.sw_bnd_flux_dn.totElems();
-  m_buffer.sw_bnd_flux_dir = decltype(m_buffer.sw_bnd_flux_dir)("sw_bnd_flux_dir", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  m_buffer.sw_bnd_flux_dir = decltype(m_buffer.sw_bnd_flux_dir)("sw_bnd_flux_dir", mem, m_col_chunks.size, m_nlay+1, m_nswbands);
   mem += m_buffer.sw_bnd_flux_dir.totElems();
-  m_buffer.sw_bnd_flux_dif = decltype(m_buffer.sw_bnd_flux_dif)("sw_bnd_flux_dif", mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  m_buffer.sw_bnd_flux_dif = decltype(m_buffer.sw_bnd_flux_dif)("sw_bnd_flux_dif", mem, m_col_chunks.size, m_nlay+1, m_nswbands);
   mem += m_buffer.sw_bnd_flux_dif.totElems();
   // 3d arrays with nlwbands dimension (longwave fluxes by band)
-  m_buffer.lw_bnd_flux_up = decltype(m_buffer.lw_bnd_flux_up)("lw_bnd_flux_up", mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
+  m_buffer.lw_bnd_flux_up = decltype(m_buffer.lw_bnd_flux_up)("lw_bnd_flux_up", mem, m_col_chunks.size, m_nlay+1, m_nlwbands);
   mem += m_buffer.lw_bnd_flux_up.totElems();
-  m_buffer.lw_bnd_flux_dn = decltype(m_buffer.lw_bnd_flux_dn)("lw_bnd_flux_dn", mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
+  m_buffer.lw_bnd_flux_dn = decltype(m_buffer.lw_bnd_flux_dn)("lw_bnd_flux_dn", mem, m_col_chunks.size, m_nlay+1, m_nlwbands);
   mem += m_buffer.lw_bnd_flux_dn.totElems();
   // 2d arrays with extra nswbands dimension (surface albedos by band)
-  m_buffer.sfc_alb_dir = decltype(m_buffer.sfc_alb_dir)("sfc_alb_dir", mem, m_col_chunk_size, m_nswbands);
+  m_buffer.sfc_alb_dir = decltype(m_buffer.sfc_alb_dir)("sfc_alb_dir", mem, m_col_chunks.size, m_nswbands);
   mem += m_buffer.sfc_alb_dir.totElems();
-  m_buffer.sfc_alb_dif = decltype(m_buffer.sfc_alb_dif)("sfc_alb_dif", mem, m_col_chunk_size, m_nswbands);
+  m_buffer.sfc_alb_dif = decltype(m_buffer.sfc_alb_dif)("sfc_alb_dif", mem, m_col_chunks.size, m_nswbands);
   mem += m_buffer.sfc_alb_dif.totElems();
   // 3d arrays with extra band dimension (aerosol optics by band)
-  m_buffer.aero_tau_sw = decltype(m_buffer.aero_tau_sw)("aero_tau_sw", mem, m_col_chunk_size, m_nlay, m_nswbands);
+  m_buffer.aero_tau_sw = decltype(m_buffer.aero_tau_sw)("aero_tau_sw", mem, m_col_chunks.size, m_nlay, m_nswbands);
   mem += m_buffer.aero_tau_sw.totElems();
-  m_buffer.aero_ssa_sw = decltype(m_buffer.aero_ssa_sw)("aero_ssa_sw", mem, m_col_chunk_size, m_nlay, m_nswbands);
+  m_buffer.aero_ssa_sw = decltype(m_buffer.aero_ssa_sw)("aero_ssa_sw", mem, m_col_chunks.size, m_nlay, m_nswbands);
   mem += m_buffer.aero_ssa_sw.totElems();
-  m_buffer.aero_g_sw   = decltype(m_buffer.aero_g_sw  )("aero_g_sw"  , mem, m_col_chunk_size, m_nlay, m_nswbands);
+  m_buffer.aero_g_sw   = decltype(m_buffer.aero_g_sw  )("aero_g_sw"  , mem, m_col_chunks.size, m_nlay, m_nswbands);
   mem += m_buffer.aero_g_sw.totElems();
-  m_buffer.aero_tau_lw = decltype(m_buffer.aero_tau_lw)("aero_tau_lw", mem, m_col_chunk_size, m_nlay, m_nlwbands);
+  m_buffer.aero_tau_lw = decltype(m_buffer.aero_tau_lw)("aero_tau_lw", mem, m_col_chunks.size, m_nlay, m_nlwbands);
   mem += m_buffer.aero_tau_lw.totElems();
   // 3d arrays with extra ngpt dimension (cloud optics by gpoint; primarily for debugging)
-  m_buffer.cld_tau_sw_gpt = decltype(m_buffer.cld_tau_sw_gpt)("cld_tau_sw_gpt", mem, m_col_chunk_size, m_nlay, m_nswgpts);
+  m_buffer.cld_tau_sw_gpt = decltype(m_buffer.cld_tau_sw_gpt)("cld_tau_sw_gpt", mem, m_col_chunks.size, m_nlay, m_nswgpts);
   mem += m_buffer.cld_tau_sw_gpt.totElems();
-  m_buffer.cld_tau_lw_gpt = decltype(m_buffer.cld_tau_lw_gpt)("cld_tau_lw_gpt", mem, m_col_chunk_size, m_nlay, m_nlwgpts);
+  m_buffer.cld_tau_lw_gpt = decltype(m_buffer.cld_tau_lw_gpt)("cld_tau_lw_gpt", mem, m_col_chunks.size, m_nlay, m_nlwgpts);
   mem += m_buffer.cld_tau_lw_gpt.totElems();
-  m_buffer.cld_tau_sw_bnd = decltype(m_buffer.cld_tau_sw_bnd)("cld_tau_sw_bnd", mem, m_col_chunk_size, m_nlay, m_nswbands);
+  m_buffer.cld_tau_sw_bnd = decltype(m_buffer.cld_tau_sw_bnd)("cld_tau_sw_bnd", mem, m_col_chunks.size, m_nlay, m_nswbands);
   mem += m_buffer.cld_tau_sw_bnd.totElems();
-  m_buffer.cld_tau_lw_bnd = decltype(m_buffer.cld_tau_lw_bnd)("cld_tau_lw_bnd", mem, m_col_chunk_size, m_nlay, m_nlwbands);
+  m_buffer.cld_tau_lw_bnd = decltype(m_buffer.cld_tau_lw_bnd)("cld_tau_lw_bnd", mem, m_col_chunks.size, m_nlay, m_nlwbands);
   mem += m_buffer.cld_tau_lw_bnd.totElems();
 #endif
 
@@ -417,143 +511,143 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   mem = reinterpret_cast<Real*>(buffer_manager.get_memory());
 
   // 1d arrays
-  m_buffer.mu0_k = decltype(m_buffer.mu0_k)(mem, m_col_chunk_size);
+  m_buffer.mu0_k = decltype(m_buffer.mu0_k)(mem, m_col_chunks.size);
   mem += m_buffer.mu0_k.size();
-  m_buffer.sfc_alb_dir_vis_k = decltype(m_buffer.sfc_alb_dir_vis_k)(mem, m_col_chunk_size);
+  m_buffer.sfc_alb_dir_vis_k = decltype(m_buffer.sfc_alb_dir_vis_k)(mem, m_col_chunks.size);
   mem += m_buffer.sfc_alb_dir_vis_k.size();
-  m_buffer.sfc_alb_dir_nir_k = decltype(m_buffer.sfc_alb_dir_nir_k)(mem, m_col_chunk_size);
+  m_buffer.sfc_alb_dir_nir_k = decltype(m_buffer.sfc_alb_dir_nir_k)(mem, m_col_chunks.size);
   mem += m_buffer.sfc_alb_dir_nir_k.size();
-  m_buffer.sfc_alb_dif_vis_k = decltype(m_buffer.sfc_alb_dif_vis_k)(mem, m_col_chunk_size);
+  m_buffer.sfc_alb_dif_vis_k = decltype(m_buffer.sfc_alb_dif_vis_k)(mem, m_col_chunks.size);
   mem += m_buffer.sfc_alb_dif_vis_k.size();
-  m_buffer.sfc_alb_dif_nir_k = decltype(m_buffer.sfc_alb_dif_nir_k)(mem, m_col_chunk_size);
+  m_buffer.sfc_alb_dif_nir_k = decltype(m_buffer.sfc_alb_dif_nir_k)(mem, m_col_chunks.size);
   mem += m_buffer.sfc_alb_dif_nir_k.size();
-  m_buffer.sfc_flux_dir_vis_k = decltype(m_buffer.sfc_flux_dir_vis_k)(mem, m_col_chunk_size);
+  m_buffer.sfc_flux_dir_vis_k = decltype(m_buffer.sfc_flux_dir_vis_k)(mem, m_col_chunks.size);
   mem += m_buffer.sfc_flux_dir_vis_k.size();
-  m_buffer.sfc_flux_dir_nir_k = decltype(m_buffer.sfc_flux_dir_nir_k)(mem, m_col_chunk_size);
+  m_buffer.sfc_flux_dir_nir_k = decltype(m_buffer.sfc_flux_dir_nir_k)(mem, m_col_chunks.size);
   mem += m_buffer.sfc_flux_dir_nir_k.size();
-  m_buffer.sfc_flux_dif_vis_k = decltype(m_buffer.sfc_flux_dif_vis_k)(mem, m_col_chunk_size);
+  m_buffer.sfc_flux_dif_vis_k = decltype(m_buffer.sfc_flux_dif_vis_k)(mem, m_col_chunks.size);
   mem += m_buffer.sfc_flux_dif_vis_k.size();
-  m_buffer.sfc_flux_dif_nir_k = decltype(m_buffer.sfc_flux_dif_nir_k)(mem, m_col_chunk_size);
+  m_buffer.sfc_flux_dif_nir_k = decltype(m_buffer.sfc_flux_dif_nir_k)(mem, m_col_chunks.size);
   mem += m_buffer.sfc_flux_dif_nir_k.size();
-  m_buffer.cosine_zenith = decltype(m_buffer.cosine_zenith)(mem, m_col_chunk_size);
+  m_buffer.cosine_zenith = decltype(m_buffer.cosine_zenith)(mem, m_col_chunks.size);
   mem += m_buffer.cosine_zenith.size();
 
   // 2d arrays
-  m_buffer.p_lay_k = decltype(m_buffer.p_lay_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.p_lay_k = decltype(m_buffer.p_lay_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.p_lay_k.size();
-  m_buffer.t_lay_k = decltype(m_buffer.t_lay_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.t_lay_k = decltype(m_buffer.t_lay_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.t_lay_k.size();
-  m_buffer.z_del_k = decltype(m_buffer.z_del_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.z_del_k = decltype(m_buffer.z_del_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.z_del_k.size();
-  m_buffer.p_del_k = decltype(m_buffer.p_del_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.p_del_k = decltype(m_buffer.p_del_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.p_del_k.size();
-  m_buffer.qc_k = decltype(m_buffer.qc_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.qc_k = decltype(m_buffer.qc_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.qc_k.size();
-  m_buffer.nc_k = decltype(m_buffer.nc_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.nc_k = decltype(m_buffer.nc_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.nc_k.size();
-  m_buffer.qi_k = decltype(m_buffer.qi_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.qi_k = decltype(m_buffer.qi_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.qi_k.size();
-  m_buffer.cldfrac_tot_k = decltype(m_buffer.cldfrac_tot_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.cldfrac_tot_k = decltype(m_buffer.cldfrac_tot_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.cldfrac_tot_k.size();
-  m_buffer.eff_radius_qc_k = decltype(m_buffer.eff_radius_qc_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.eff_radius_qc_k = decltype(m_buffer.eff_radius_qc_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.eff_radius_qc_k.size();
-  m_buffer.eff_radius_qi_k = decltype(m_buffer.eff_radius_qi_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.eff_radius_qi_k = decltype(m_buffer.eff_radius_qi_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.eff_radius_qi_k.size();
-  m_buffer.tmp2d_k = decltype(m_buffer.tmp2d_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.tmp2d_k = decltype(m_buffer.tmp2d_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.tmp2d_k.size();
-  m_buffer.lwp_k = decltype(m_buffer.lwp_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.lwp_k = decltype(m_buffer.lwp_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.lwp_k.size();
-  m_buffer.iwp_k = decltype(m_buffer.iwp_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.iwp_k = decltype(m_buffer.iwp_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.iwp_k.size();
-  m_buffer.sw_heating_k = decltype(m_buffer.sw_heating_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.sw_heating_k = decltype(m_buffer.sw_heating_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.sw_heating_k.size();
-  m_buffer.lw_heating_k = decltype(m_buffer.lw_heating_k)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.lw_heating_k = decltype(m_buffer.lw_heating_k)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.lw_heating_k.size();
-  m_buffer.p_lev_k = decltype(m_buffer.p_lev_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.p_lev_k = decltype(m_buffer.p_lev_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.p_lev_k.size();
-  m_buffer.t_lev_k = decltype(m_buffer.t_lev_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.t_lev_k = decltype(m_buffer.t_lev_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.t_lev_k.size();
-  m_buffer.d_tint = decltype(m_buffer.d_tint)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.d_tint = decltype(m_buffer.d_tint)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.d_tint.size();
-  m_buffer.d_dz  = decltype(m_buffer.d_dz)(mem, m_col_chunk_size, m_nlay);
+  m_buffer.d_dz  = decltype(m_buffer.d_dz)(mem, m_col_chunks.size, m_nlay);
   mem += m_buffer.d_dz.size();
   // 3d arrays
-  m_buffer.sw_flux_up_k = decltype(m_buffer.sw_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_flux_up_k = decltype(m_buffer.sw_flux_up_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_flux_up_k.size();
-  m_buffer.sw_flux_dn_k = decltype(m_buffer.sw_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_flux_dn_k = decltype(m_buffer.sw_flux_dn_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_flux_dn_k.size();
-  m_buffer.sw_flux_dn_dir_k = decltype(m_buffer.sw_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_flux_dn_dir_k = decltype(m_buffer.sw_flux_dn_dir_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_flux_dn_dir_k.size();
-  m_buffer.lw_flux_up_k = decltype(m_buffer.lw_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_flux_up_k = decltype(m_buffer.lw_flux_up_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_flux_up_k.size();
-  m_buffer.lw_flux_dn_k = decltype(m_buffer.lw_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_flux_dn_k = decltype(m_buffer.lw_flux_dn_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_flux_dn_k.size();
-  m_buffer.sw_clnclrsky_flux_up_k = decltype(m_buffer.sw_clnclrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnclrsky_flux_up_k = decltype(m_buffer.sw_clnclrsky_flux_up_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnclrsky_flux_up_k.size();
-  m_buffer.sw_clnclrsky_flux_dn_k = decltype(m_buffer.sw_clnclrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnclrsky_flux_dn_k = decltype(m_buffer.sw_clnclrsky_flux_dn_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnclrsky_flux_dn_k.size();
-  m_buffer.sw_clnclrsky_flux_dn_dir_k = decltype(m_buffer.sw_clnclrsky_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnclrsky_flux_dn_dir_k = decltype(m_buffer.sw_clnclrsky_flux_dn_dir_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnclrsky_flux_dn_dir_k.size();
-  m_buffer.sw_clrsky_flux_up_k = decltype(m_buffer.sw_clrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clrsky_flux_up_k = decltype(m_buffer.sw_clrsky_flux_up_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clrsky_flux_up_k.size();
-  m_buffer.sw_clrsky_flux_dn_k = decltype(m_buffer.sw_clrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clrsky_flux_dn_k = decltype(m_buffer.sw_clrsky_flux_dn_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clrsky_flux_dn_k.size();
-  m_buffer.sw_clrsky_flux_dn_dir_k = decltype(m_buffer.sw_clrsky_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clrsky_flux_dn_dir_k = decltype(m_buffer.sw_clrsky_flux_dn_dir_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clrsky_flux_dn_dir_k.size();
-  m_buffer.sw_clnsky_flux_up_k = decltype(m_buffer.sw_clnsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnsky_flux_up_k = decltype(m_buffer.sw_clnsky_flux_up_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnsky_flux_up_k.size();
-  m_buffer.sw_clnsky_flux_dn_k = decltype(m_buffer.sw_clnsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnsky_flux_dn_k = decltype(m_buffer.sw_clnsky_flux_dn_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnsky_flux_dn_k.size();
-  m_buffer.sw_clnsky_flux_dn_dir_k = decltype(m_buffer.sw_clnsky_flux_dn_dir_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.sw_clnsky_flux_dn_dir_k = decltype(m_buffer.sw_clnsky_flux_dn_dir_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.sw_clnsky_flux_dn_dir_k.size();
-  m_buffer.lw_clnclrsky_flux_up_k = decltype(m_buffer.lw_clnclrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clnclrsky_flux_up_k = decltype(m_buffer.lw_clnclrsky_flux_up_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clnclrsky_flux_up_k.size();
-  m_buffer.lw_clnclrsky_flux_dn_k = decltype(m_buffer.lw_clnclrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clnclrsky_flux_dn_k = decltype(m_buffer.lw_clnclrsky_flux_dn_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clnclrsky_flux_dn_k.size();
-  m_buffer.lw_clrsky_flux_up_k = decltype(m_buffer.lw_clrsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clrsky_flux_up_k = decltype(m_buffer.lw_clrsky_flux_up_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clrsky_flux_up_k.size();
-  m_buffer.lw_clrsky_flux_dn_k = decltype(m_buffer.lw_clrsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clrsky_flux_dn_k = decltype(m_buffer.lw_clrsky_flux_dn_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clrsky_flux_dn_k.size();
-  m_buffer.lw_clnsky_flux_up_k = decltype(m_buffer.lw_clnsky_flux_up_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clnsky_flux_up_k = decltype(m_buffer.lw_clnsky_flux_up_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clnsky_flux_up_k.size();
-  m_buffer.lw_clnsky_flux_dn_k = decltype(m_buffer.lw_clnsky_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1);
+  m_buffer.lw_clnsky_flux_dn_k = decltype(m_buffer.lw_clnsky_flux_dn_k)(mem, m_col_chunks.size, m_nlay+1);
   mem += m_buffer.lw_clnsky_flux_dn_k.size();
   // 3d arrays with nswbands dimension (shortwave fluxes by band)
-  m_buffer.sw_bnd_flux_up_k = decltype(m_buffer.sw_bnd_flux_up_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  m_buffer.sw_bnd_flux_up_k = decltype(m_buffer.sw_bnd_flux_up_k)(mem, m_col_chunks.size, m_nlay+1, m_nswbands);
   mem += m_buffer.sw_bnd_flux_up_k.size();
-  m_buffer.sw_bnd_flux_dn_k = decltype(m_buffer.sw_bnd_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  m_buffer.sw_bnd_flux_dn_k = decltype(m_buffer.sw_bnd_flux_dn_k)(mem, m_col_chunks.size, m_nlay+1, m_nswbands);
   mem += m_buffer.sw_bnd_flux_dn_k.size();
-  m_buffer.sw_bnd_flux_dir_k = decltype(m_buffer.sw_bnd_flux_dir_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  m_buffer.sw_bnd_flux_dir_k = decltype(m_buffer.sw_bnd_flux_dir_k)(mem, m_col_chunks.size, m_nlay+1, m_nswbands);
   mem += m_buffer.sw_bnd_flux_dir_k.size();
-  m_buffer.sw_bnd_flux_dif_k = decltype(m_buffer.sw_bnd_flux_dif_k)(mem, m_col_chunk_size, m_nlay+1, m_nswbands);
+  m_buffer.sw_bnd_flux_dif_k = decltype(m_buffer.sw_bnd_flux_dif_k)(mem, m_col_chunks.size, m_nlay+1, m_nswbands);
   mem += m_buffer.sw_bnd_flux_dif_k.size();
   // 3d arrays with nlwbands dimension (longwave fluxes by band)
-  m_buffer.lw_bnd_flux_up_k = decltype(m_buffer.lw_bnd_flux_up_k)(mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
+  m_buffer.lw_bnd_flux_up_k = decltype(m_buffer.lw_bnd_flux_up_k)(mem, m_col_chunks.size, m_nlay+1, m_nlwbands);
   mem += m_buffer.lw_bnd_flux_up_k.size();
-  m_buffer.lw_bnd_flux_dn_k = decltype(m_buffer.lw_bnd_flux_dn_k)(mem, m_col_chunk_size, m_nlay+1, m_nlwbands);
+  m_buffer.lw_bnd_flux_dn_k = decltype(m_buffer.lw_bnd_flux_dn_k)(mem, m_col_chunks.size, m_nlay+1, m_nlwbands);
   mem += m_buffer.lw_bnd_flux_dn_k.size();
   // 2d arrays with extra nswbands dimension (surface albedos by band)
-  m_buffer.sfc_alb_dir_k = decltype(m_buffer.sfc_alb_dir_k)(mem, m_col_chunk_size, m_nswbands);
+  m_buffer.sfc_alb_dir_k = decltype(m_buffer.sfc_alb_dir_k)(mem, m_col_chunks.size, m_nswbands);
   mem += m_buffer.sfc_alb_dir_k.size();
-  m_buffer.sfc_alb_dif_k = decltype(m_buffer.sfc_alb_dif_k)(mem, m_col_chunk_size, m_nswbands);
+  m_buffer.sfc_alb_dif_k = decltype(m_buffer.sfc_alb_dif_k)(mem, m_col_chunks.size, m_nswbands);
   mem += m_buffer.sfc_alb_dif_k.size();
   // 3d arrays with extra band dimension (aerosol optics by band)
-  m_buffer.aero_tau_sw_k = decltype(m_buffer.aero_tau_sw_k)(mem, m_col_chunk_size, m_nlay, m_nswbands);
+  m_buffer.aero_tau_sw_k = decltype(m_buffer.aero_tau_sw_k)(mem, m_col_chunks.size, m_nlay, m_nswbands);
   mem += m_buffer.aero_tau_sw_k.size();
-  m_buffer.aero_ssa_sw_k = decltype(m_buffer.aero_ssa_sw_k)(mem, m_col_chunk_size, m_nlay, m_nswbands);
+  m_buffer.aero_ssa_sw_k = decltype(m_buffer.aero_ssa_sw_k)(mem, m_col_chunks.size, m_nlay, m_nswbands);
   mem += m_buffer.aero_ssa_sw_k.size();
-  m_buffer.aero_g_sw_k   = decltype(m_buffer.aero_g_sw_k  )(mem, m_col_chunk_size, m_nlay, m_nswbands);
+  m_buffer.aero_g_sw_k   = decltype(m_buffer.aero_g_sw_k  )(mem, m_col_chunks.size, m_nlay, m_nswbands);
   mem += m_buffer.aero_g_sw_k.size();
-  m_buffer.aero_tau_lw_k = decltype(m_buffer.aero_tau_lw_k)(mem, m_col_chunk_size, m_nlay, m_nlwbands);
+  m_buffer.aero_tau_lw_k = decltype(m_buffer.aero_tau_lw_k)(mem, m_col_chunks.size, m_nlay, m_nlwbands);
   mem += m_buffer.aero_tau_lw_k.size();
   // 3d arrays with extra ngpt dimension (cloud optics by gpoint; primarily for debugging)
-  m_buffer.cld_tau_sw_gpt_k = decltype(m_buffer.cld_tau_sw_gpt_k)(mem, m_col_chunk_size, m_nlay, m_nswgpts);
+  m_buffer.cld_tau_sw_gpt_k = decltype(m_buffer.cld_tau_sw_gpt_k)(mem, m_col_chunks.size, m_nlay, m_nswgpts);
   mem += m_buffer.cld_tau_sw_gpt_k.size();
-  m_buffer.cld_tau_lw_gpt_k = decltype(m_buffer.cld_tau_lw_gpt_k)(mem, m_col_chunk_size, m_nlay, m_nlwgpts);
+  m_buffer.cld_tau_lw_gpt_k = decltype(m_buffer.cld_tau_lw_gpt_k)(mem, m_col_chunks.size, m_nlay, m_nlwgpts);
   mem += m_buffer.cld_tau_lw_gpt_k.size();
-  m_buffer.cld_tau_sw_bnd_k = decltype(m_buffer.cld_tau_sw_bnd_k)(mem, m_col_chunk_size, m_nlay, m_nswbands);
+  m_buffer.cld_tau_sw_bnd_k = decltype(m_buffer.cld_tau_sw_bnd_k)(mem, m_col_chunks.size, m_nlay, m_nswbands);
   mem += m_buffer.cld_tau_sw_bnd_k.size();
-  m_buffer.cld_tau_lw_bnd_k = decltype(m_buffer.cld_tau_lw_bnd_k)(mem, m_col_chunk_size, m_nlay, m_nlwbands);
+  m_buffer.cld_tau_lw_bnd_k = decltype(m_buffer.cld_tau_lw_bnd_k)(mem, m_col_chunks.size, m_nlay, m_nlwbands);
   mem += m_buffer.cld_tau_lw_bnd_k.size();
 #endif
 
@@ -561,11 +655,17 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for RRTMGPRadiation.");
 } // RRTMGPRadiation::init_buffers
 
-void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
+void RRTMGPRadiation::initialize_impl(const RunType run_type) {
   using PC = scream::physics::Constants<Real>;
 
-  // Determine rad timestep, specified as number of atm steps
-  m_rad_freq_in_steps = m_params.get<Int>("rad_frequency", 1);
+  if (m_interp_rad_heating) {
+    m_mu0 = view_1d_real("mu0",m_ncol);
+    if (run_type==RunType::Restart) {
+      // The rad states were read from the restart file, along with their counters
+      m_num_rad_states = ekat::any_cast<int>(m_restart_extra_data["rrtmgp_num_rad_states"]);
+      m_last_rad_step  = ekat::any_cast<int>(m_restart_extra_data["rrtmgp_last_rad_step"]);
+    }
+  }
 
   // Determine orbital year. If orbital_year is negative, use current year
   // from timestamp for orbital year; if positive, use provided orbital year
@@ -614,7 +714,7 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
   std::string cloud_optics_file_sw = m_params.get<std::string>("rrtmgp_cloud_optics_file_sw");
   std::string cloud_optics_file_lw = m_params.get<std::string>("rrtmgp_cloud_optics_file_lw");
 #ifdef RRTMGP_ENABLE_YAKL
-  m_gas_concs.init(gas_names_yakl_offset,m_col_chunk_size,m_nlay);
+  m_gas_concs.init(gas_names_yakl_offset,m_col_chunks.size,m_nlay);
   rrtmgp::rrtmgp_initialize(
           m_gas_concs,
           coefficients_file_sw, coefficients_file_lw,
@@ -623,7 +723,7 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
   );
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
-  m_gas_concs_k.init(gas_names_yakl_offset,m_col_chunk_size,m_nlay);
+  m_gas_concs_k.init(gas_names_yakl_offset,m_col_chunks.size,m_nlay);
   rrtmgp::rrtmgp_initialize(
           m_gas_concs_k,
           coefficients_file_sw, coefficients_file_lw,
@@ -649,6 +749,49 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
     auto co_vmr = get_field_out("co_volume_mix_ratio").get_view<Real**>();
     Kokkos::deep_copy(co_vmr, m_params.get<double>("covmr", 1.0e-7));
   }
+
+  if (m_coarsener) {
+    // Create the coarse copies of all fields. Inputs are coarsened before each rad step,
+    // while outputs are refined after it. T_mid is updated on the physics grid (using
+    // the refined heating), and conservation fluxes are computed on the physics grid.
+    const std::set<std::string> phys_only = {"T_mid","vapor_flux","water_flux","ice_flux","heat_flux"};
+    auto create_rad_field = [&](const Field& f) {
+      const auto& fid = f.get_header().get_identifier();
+      auto& f_rad = m_rad_fields[fid.name()];
+      if (not f_rad.is_allocated()) {
+        f_rad = Field(m_coarsener->create_tgt_fid(fid));
+        f_rad.allocate_view();
+      }
+      return f_rad;
+    };
+    m_coarsener->registration_begins();
+    for (const auto& f : get_fields_in()) {
+      m_coarsener->register_field(f,create_rad_field(f));
+    }
+    m_coarsener->registration_ends();
+
+    m_refiner->registration_begins();
+    for (const auto& f : get_fields_out()) {
+      const auto& name = f.name();
+      if (phys_only.count(name)==1) {
+        continue;
+      }
+      auto f_rad = create_rad_field(f);
+      if (m_rad_grid_imp_exp) {
+        Field f_src(m_refiner->create_src_fid(f.get_header().get_identifier()));
+        f_src.allocate_view();
+        m_rad_to_refiner_fields.emplace_back(f_rad,f_src);
+        m_refiner->register_field(f_src,f);
+      } else {
+        m_refiner->register_field(f_rad,f);
+      }
+    }
+    m_refiner->registration_ends();
+
+    if (m_rad_grid_imp_exp) {
+      setup_rad_to_refiner_exchange();
+    }
+  }
 }
 
 // =========================================================================================
@@ -663,24 +806,24 @@ void RRTMGPRadiation::run_impl (const double dt) {
   auto h_lon  = m_lon.get_view<const Real*,Host>();
 
   // Get data from the FieldManager
-  auto d_pmid = get_field_in("p_mid").get_view<const Real**>();
-  auto d_pint = get_field_in("p_int").get_view<const Real**>();
-  auto d_pdel = get_field_in("pseudo_density").get_view<const Real**>();
-  auto d_sfc_alb_dir_vis = get_field_in("sfc_alb_dir_vis").get_view<const Real*>();
-  auto d_sfc_alb_dir_nir = get_field_in("sfc_alb_dir_nir").get_view<const Real*>();
-  auto d_sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
-  auto d_sfc_alb_dif_nir = get_field_in("sfc_alb_dif_nir").get_view<const Real*>();
-  auto d_qv = get_field_in("qv").get_view<const Real**>();
-  auto d_qc = get_field_in("qc").get_view<const Real**>();
-  auto d_nc = get_field_in("nc").get_view<const Real**>();
-  auto d_qi = get_field_in("qi").get_view<const Real**>();
-  auto d_cldfrac_tot = get_field_in("cldfrac_tot").get_view<const Real**>();
-  auto d_rel = get_field_in("eff_radius_qc").get_view<const Real**>();
-  auto d_rei = get_field_in("eff_radius_qi").get_view<const Real**>();
-  auto d_surf_lw_flux_up = get_field_in("surf_lw_flux_up").get_view<const Real*>();
+  auto d_pmid = get_rad_field_in("p_mid").get_view<const Real**>();
+  auto d_pint = get_rad_field_in("p_int").get_view<const Real**>();
+  auto d_pdel = get_rad_field_in("pseudo_density").get_view<const Real**>();
+  auto d_sfc_alb_dir_vis = get_rad_field_in("sfc_alb_dir_vis").get_view<const Real*>();
+  auto d_sfc_alb_dir_nir = get_rad_field_in("sfc_alb_dir_nir").get_view<const Real*>();
+  auto d_sfc_alb_dif_vis = get_rad_field_in("sfc_alb_dif_vis").get_view<const Real*>();
+  auto d_sfc_alb_dif_nir = get_rad_field_in("sfc_alb_dif_nir").get_view<const Real*>();
+  auto d_qv = get_rad_field_in("qv").get_view<const Real**>();
+  auto d_qc = get_rad_field_in("qc").get_view<const Real**>();
+  auto d_nc = get_rad_field_in("nc").get_view<const Real**>();
+  auto d_qi = get_rad_field_in("qi").get_view<const Real**>();
+  auto d_cldfrac_tot = get_rad_field_in("cldfrac_tot").get_view<const Real**>();
+  auto d_rel = get_rad_field_in("eff_radius_qc").get_view<const Real**>();
+  auto d_rei = get_rad_field_in("eff_radius_qi").get_view<const Real**>();
+  auto d_surf_lw_flux_up = get_rad_field_in("surf_lw_flux_up").get_view<const Real*>();
   // Output fields
-  auto d_tmid = get_field_out("T_mid").get_view<Real**>();
-  auto d_cldfrac_rad = get_field_out("cldfrac_rad").get_view<Real**>();
+  auto d_tmid = get_rad_field_out("T_mid").get_view<Real**>();
+  auto d_cldfrac_rad = get_rad_field_out("cldfrac_rad").get_view<Real**>();
 
   // Aerosol optics only exist if m_do_aerosol_rad is true, so declare views and copy from FM if so
   using view_3d = Field::view_dev_t<const Real***>;
@@ -689,63 +832,68 @@ void RRTMGPRadiation::run_impl (const double dt) {
   view_3d d_aero_g_sw;
   view_3d d_aero_tau_lw;
   if (m_do_aerosol_rad) {
-    d_aero_tau_sw = get_field_in("aero_tau_sw").get_view<const Real***>();
-    d_aero_ssa_sw = get_field_in("aero_ssa_sw").get_view<const Real***>();
-    d_aero_g_sw   = get_field_in("aero_g_sw"  ).get_view<const Real***>();
-    d_aero_tau_lw = get_field_in("aero_tau_lw").get_view<const Real***>();
+    d_aero_tau_sw = get_rad_field_in("aero_tau_sw").get_view<const Real***>();
+    d_aero_ssa_sw = get_rad_field_in("aero_ssa_sw").get_view<const Real***>();
+    d_aero_g_sw   = get_rad_field_in("aero_g_sw"  ).get_view<const Real***>();
+    d_aero_tau_lw = get_rad_field_in("aero_tau_lw").get_view<const Real***>();
   }
-  auto d_sw_flux_up = get_field_out("SW_flux_up").get_view<Real**>();
-  auto d_sw_flux_dn = get_field_out("SW_flux_dn").get_view<Real**>();
-  auto d_sw_flux_dn_dir = get_field_out("SW_flux_dn_dir").get_view<Real**>();
-  auto d_lw_flux_up = get_field_out("LW_flux_up").get_view<Real**>();
-  auto d_lw_flux_dn = get_field_out("LW_flux_dn").get_view<Real**>();
-  auto d_sw_clnclrsky_flux_up = get_field_out("SW_clnclrsky_flux_up").get_view<Real**>();
-  auto d_sw_clnclrsky_flux_dn = get_field_out("SW_clnclrsky_flux_dn").get_view<Real**>();
-  auto d_sw_clnclrsky_flux_dn_dir = get_field_out("SW_clnclrsky_flux_dn_dir").get_view<Real**>();
-  auto d_sw_clrsky_flux_up = get_field_out("SW_clrsky_flux_up").get_view<Real**>();
-  auto d_sw_clrsky_flux_dn = get_field_out("SW_clrsky_flux_dn").get_view<Real**>();
-  auto d_sw_clrsky_flux_dn_dir = get_field_out("SW_clrsky_flux_dn_dir").get_view<Real**>();
-  auto d_sw_clnsky_flux_up = get_field_out("SW_clnsky_flux_up").get_view<Real**>();
-  auto d_sw_clnsky_flux_dn = get_field_out("SW_clnsky_flux_dn").get_view<Real**>();
-  auto d_sw_clnsky_flux_dn_dir = get_field_out("SW_clnsky_flux_dn_dir").get_view<Real**>();
-  auto d_lw_clnclrsky_flux_up = get_field_out("LW_clnclrsky_flux_up").get_view<Real**>();
-  auto d_lw_clnclrsky_flux_dn = get_field_out("LW_clnclrsky_flux_dn").get_view<Real**>();
-  auto d_lw_clrsky_flux_up = get_field_out("LW_clrsky_flux_up").get_view<Real**>();
-  auto d_lw_clrsky_flux_dn = get_field_out("LW_clrsky_flux_dn").get_view<Real**>();
-  auto d_lw_clnsky_flux_up = get_field_out("LW_clnsky_flux_up").get_view<Real**>();
-  auto d_lw_clnsky_flux_dn = get_field_out("LW_clnsky_flux_dn").get_view<Real**>();
-  auto d_rad_heating_pdel = get_field_out("rad_heating_pdel").get_view<Real**>();
-  auto d_sfc_flux_dir_vis = get_field_out("sfc_flux_dir_vis").get_view<Real*>();
-  auto d_sfc_flux_dir_nir = get_field_out("sfc_flux_dir_nir").get_view<Real*>();
-  auto d_sfc_flux_dif_vis = get_field_out("sfc_flux_dif_vis").get_view<Real*>();
-  auto d_sfc_flux_dif_nir = get_field_out("sfc_flux_dif_nir").get_view<Real*>();
-  auto d_sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real*>();
-  auto d_sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real*>();
-  auto d_cldlow = get_field_out("cldlow").get_view<Real*>();
-  auto d_cldmed = get_field_out("cldmed").get_view<Real*>();
-  auto d_cldhgh = get_field_out("cldhgh").get_view<Real*>();
-  auto d_cldtot = get_field_out("cldtot").get_view<Real*>();
+  auto d_sw_flux_up = get_rad_field_out("SW_flux_up").get_view<Real**>();
+  auto d_sw_flux_dn = get_rad_field_out("SW_flux_dn").get_view<Real**>();
+  auto d_sw_flux_dn_dir = get_rad_field_out("SW_flux_dn_dir").get_view<Real**>();
+  auto d_lw_flux_up = get_rad_field_out("LW_flux_up").get_view<Real**>();
+  auto d_lw_flux_dn = get_rad_field_out("LW_flux_dn").get_view<Real**>();
+  auto d_sw_clnclrsky_flux_up = get_rad_field_out("SW_clnclrsky_flux_up").get_view<Real**>();
+  auto d_sw_clnclrsky_flux_dn = get_rad_field_out("SW_clnclrsky_flux_dn").get_view<Real**>();
+  auto d_sw_clnclrsky_flux_dn_dir = get_rad_field_out("SW_clnclrsky_flux_dn_dir").get_view<Real**>();
+  auto d_sw_clrsky_flux_up = get_rad_field_out("SW_clrsky_flux_up").get_view<Real**>();
+  auto d_sw_clrsky_flux_dn = get_rad_field_out("SW_clrsky_flux_dn").get_view<Real**>();
+  auto d_sw_clrsky_flux_dn_dir = get_rad_field_out("SW_clrsky_flux_dn_dir").get_view<Real**>();
+  auto d_sw_clnsky_flux_up = get_rad_field_out("SW_clnsky_flux_up").get_view<Real**>();
+  auto d_sw_clnsky_flux_dn = get_rad_field_out("SW_clnsky_flux_dn").get_view<Real**>();
+  auto d_sw_clnsky_flux_dn_dir = get_rad_field_out("SW_clnsky_flux_dn_dir").get_view<Real**>();
+  auto d_lw_clnclrsky_flux_up = get_rad_field_out("LW_clnclrsky_flux_up").get_view<Real**>();
+  auto d_lw_clnclrsky_flux_dn = get_rad_field_out("LW_clnclrsky_flux_dn").get_view<Real**>();
+  auto d_lw_clrsky_flux_up = get_rad_field_out("LW_clrsky_flux_up").get_view<Real**>();
+  auto d_lw_clrsky_flux_dn = get_rad_field_out("LW_clrsky_flux_dn").get_view<Real**>();
+  auto d_lw_clnsky_flux_up = get_rad_field_out("LW_clnsky_flux_up").get_view<Real**>();
+  auto d_lw_clnsky_flux_dn = get_rad_field_out("LW_clnsky_flux_dn").get_view<Real**>();
+  auto d_rad_heating_pdel = get_rad_field_out("rad_heating_pdel").get_view<Real**>();
+  auto d_sfc_flux_dir_vis = get_rad_field_out("sfc_flux_dir_vis").get_view<Real*>();
+  auto d_sfc_flux_dir_nir = get_rad_field_out("sfc_flux_dir_nir").get_view<Real*>();
+  auto d_sfc_flux_dif_vis = get_rad_field_out("sfc_flux_dif_vis").get_view<Real*>();
+  auto d_sfc_flux_dif_nir = get_rad_field_out("sfc_flux_dif_nir").get_view<Real*>();
+  auto d_sfc_flux_sw_net = get_rad_field_out("sfc_flux_sw_net").get_view<Real*>();
+  auto d_sfc_flux_lw_dn  = get_rad_field_out("sfc_flux_lw_dn").get_view<Real*>();
+  auto d_cldlow = get_rad_field_out("cldlow").get_view<Real*>();
+  auto d_cldmed = get_rad_field_out("cldmed").get_view<Real*>();
+  auto d_cldhgh = get_rad_field_out("cldhgh").get_view<Real*>();
+  auto d_cldtot = get_rad_field_out("cldtot").get_view<Real*>();
   // Outputs for COSP
-  auto d_dtau067 = get_field_out("dtau067").get_view<Real**>();
-  auto d_dtau105 = get_field_out("dtau105").get_view<Real**>();
-  auto d_sunlit = get_field_out("sunlit").get_view<Real*>();
+  auto d_dtau067 = get_rad_field_out("dtau067").get_view<Real**>();
+  auto d_dtau105 = get_rad_field_out("dtau105").get_view<Real**>();
+  auto d_sunlit = get_rad_field_out("sunlit").get_view<Real*>();
 
   Kokkos::deep_copy(d_dtau067,0.0);
   Kokkos::deep_copy(d_dtau105,0.0);
+  if (m_coarsener) {
+    // On rad steps, the physics grid ones are overwritten when refining
+    get_field_out("dtau067").deep_copy(0.0);
+    get_field_out("dtau105").deep_copy(0.0);
+  }
   // Outputs for AeroCom cloud-top diagnostics
-  auto d_T_mid_at_cldtop = get_field_out("T_mid_at_cldtop").get_view<Real *>();
-  auto d_p_mid_at_cldtop = get_field_out("p_mid_at_cldtop").get_view<Real *>();
+  auto d_T_mid_at_cldtop = get_rad_field_out("T_mid_at_cldtop").get_view<Real *>();
+  auto d_p_mid_at_cldtop = get_rad_field_out("p_mid_at_cldtop").get_view<Real *>();
   auto d_cldfrac_ice_at_cldtop =
-      get_field_out("cldfrac_ice_at_cldtop").get_view<Real *>();
+      get_rad_field_out("cldfrac_ice_at_cldtop").get_view<Real *>();
   auto d_cldfrac_liq_at_cldtop =
-      get_field_out("cldfrac_liq_at_cldtop").get_view<Real *>();
+      get_rad_field_out("cldfrac_liq_at_cldtop").get_view<Real *>();
   auto d_cldfrac_tot_at_cldtop =
-      get_field_out("cldfrac_tot_at_cldtop").get_view<Real *>();
-  auto d_cdnc_at_cldtop = get_field_out("cdnc_at_cldtop").get_view<Real *>();
+      get_rad_field_out("cldfrac_tot_at_cldtop").get_view<Real *>();
+  auto d_cdnc_at_cldtop = get_rad_field_out("cdnc_at_cldtop").get_view<Real *>();
   auto d_eff_radius_qc_at_cldtop =
-      get_field_out("eff_radius_qc_at_cldtop").get_view<Real *>();
+      get_rad_field_out("eff_radius_qc_at_cldtop").get_view<Real *>();
   auto d_eff_radius_qi_at_cldtop =
-      get_field_out("eff_radius_qi_at_cldtop").get_view<Real *>();
+      get_rad_field_out("eff_radius_qi_at_cldtop").get_view<Real *>();
 
   constexpr auto stebol = PC::stebol;
   const auto nlay = m_nlay;
@@ -758,7 +906,40 @@ void RRTMGPRadiation::run_impl (const double dt) {
   auto ts = timestamp();
   auto update_rad = scream::rrtmgp::radiation_do(m_rad_freq_in_steps, ts.get_num_steps());
 
+  // If not, are we going to interpolate the heating from the last rad steps?
+  const bool interp_heating = m_interp_rad_heating and not update_rad and m_num_rad_states>0;
+
+  // Compute orbital parameters; these are used both for computing
+  // the solar zenith angle and also for computing total solar
+  // irradiance scaling (tsi_scaling). The zenith angle is also
+  // needed in between rad steps if we interpolate the heating.
+  double obliqr, lambm0, mvelpp;
+  auto orbital_year = m_orbital_year;
+  auto eccen = m_orbital_eccen;
+  auto obliq = m_orbital_obliq;
+  auto mvelp = m_orbital_mvelp;
+  if (eccen >= 0 && obliq >= 0 && mvelp >= 0) {
+    // use fixed orbital parameters; to force this, we need to set
+    // orbital_year to SHR_ORB_UNDEF_INT, which is exposed through
+    // our c2f bridge as shr_orb_undef_int_c2f
+    orbital_year = shr_orb_undef_int_c2f;
+  } else if (orbital_year < 0) {
+    // compute orbital parameters based on current year
+    orbital_year = ts.get_year();
+  }
+  shr_orb_params_c2f(&orbital_year, &eccen, &obliq, &mvelp,
+                     &obliqr, &lambm0, &mvelpp);
+  // Use the orbital parameters to calculate the solar declination and eccentricity factor
+  double delta, eccf;
+  auto calday = ts.frac_of_year_in_days() + 1;  // Want day + fraction; calday 1 == Jan 1 0Z
+  shr_orb_decl_c2f(calday, eccen, mvelpp, lambm0,
+                   obliqr, &delta, &eccf);
+
   if (update_rad) {
+    if (m_coarsener) {
+      m_coarsener->remap(true);
+    }
+
     // On each chunk, we internally "reset" the GasConcs object to subview the concs 3d array
     // with the correct ncol dimension. So let's keep a copy of the original (ref-counted)
     // array, to restore at the end inside the m_gast_concs object.
@@ -771,30 +952,10 @@ void RRTMGPRadiation::run_impl (const double dt) {
     auto orig_ncol_k = m_gas_concs_k.ncol;
 #endif
 
-    // Compute orbital parameters; these are used both for computing
-    // the solar zenith angle and also for computing total solar
-    // irradiance scaling (tsi_scaling).
-    double obliqr, lambm0, mvelpp;
-    auto orbital_year = m_orbital_year;
-    auto eccen = m_orbital_eccen;
-    auto obliq = m_orbital_obliq;
-    auto mvelp = m_orbital_mvelp;
-    if (eccen >= 0 && obliq >= 0 && mvelp >= 0) {
-      // use fixed orbital parameters; to force this, we need to set
-      // orbital_year to SHR_ORB_UNDEF_INT, which is exposed through
-      // our c2f bridge as shr_orb_undef_int_c2f
-      orbital_year = shr_orb_undef_int_c2f;
-    } else if (orbital_year < 0) {
-      // compute orbital parameters based on current year
-      orbital_year = ts.get_year();
+    // Save the LW heating of the previous rad step, to extrapolate its trend
+    if (m_interp_rad_heating and m_num_rad_states>0) {
+      Kokkos::deep_copy(m_lw_heating_prev,m_lw_heating_rad);
     }
-    shr_orb_params_c2f(&orbital_year, &eccen, &obliq, &mvelp,
-                       &obliqr, &lambm0, &mvelpp);
-    // Use the orbital parameters to calculate the solar declination and eccentricity factor
-    double delta, eccf;
-    auto calday = ts.frac_of_year_in_days() + 1;  // Want day + fraction; calday 1 == Jan 1 0Z
-    shr_orb_decl_c2f(calday, eccen, mvelpp, lambm0,
-                     obliqr, &delta, &eccf);
 
     // Precompute VMR for all gases, on all cols, before starting the chunks loop
     //
@@ -810,7 +971,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
       // as a constant value, read from file during init. Skip these.
       if (name=="o3" or name == "n2" or name == "co") continue;
 
-      auto d_vmr = get_field_out(name + "_volume_mix_ratio").get_view<Real**>();
+      auto d_vmr = get_rad_field_out(name + "_volume_mix_ratio").get_view<Real**>();
       if (name == "h2o") {
         // h2o is (wet) mass mixing ratio in FM, otherwise known as "qv", which we've already read in above
         // Convert to vmr
@@ -841,12 +1002,23 @@ void RRTMGPRadiation::run_impl (const double dt) {
     }
 
     // Loop over each chunk of columns
-    for (int ic=0; ic<m_num_col_chunks; ++ic) {
-      const int beg  = m_col_chunk_beg[ic];
-      const int ncol = m_col_chunk_beg[ic+1] - beg;
+    for (int ic=0; ic<m_col_chunks.num; ++ic) {
+      const int beg  = m_col_chunks.beg[ic];
+      const int ncol = m_col_chunks.ncols(ic);
       this->log(LogLevel::debug,
                 "[RRTMGP::run_impl] Col chunk beg,end: " + std::to_string(beg) + ", " + std::to_string(beg+ncol) + "\n");
 
+      if (ncol==0) {
+        // Empty chunk (only possible when balancing SW columns): we have no
+        // columns, but we must take part in this chunk's SW exchange
+#ifdef RRTMGP_ENABLE_YAKL
+        rrtmgp::rrtmgp_sw_balance_no_cols(
+          m_nlay, m_gas_concs, eccf, m_atm_logger,
+          m_extra_clnclrsky_diag, m_extra_clnsky_diag, m_comm);
+#endif
+        continue;
+      }
+
 
       // Create YAKL arrays. RRTMGP expects YAKL arrays with styleFortran, i.e., data has ncol
       // as the fastest index. For this reason we must copy the data.
@@ -1047,6 +1219,12 @@ void RRTMGPRadiation::run_impl (const double dt) {
           }
         }
         Kokkos::deep_copy(d_mu0,h_mu0);
+        if (m_interp_rad_heating) {
+          auto mu0_rad = m_mu0_rad;
+          Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,ncol), KOKKOS_LAMBDA(const int i) {
+            mu0_rad(i+beg) = d_mu0(i);
+          });
+        }
 
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
@@ -1213,7 +1391,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         auto full_name = name + "_volume_mix_ratio";
 
         // 'o3' is marked as 'Required' rather than 'Computed', so we need to get the proper field
-        auto f = name=="o3" ? get_field_in(full_name) : get_field_out(full_name);
+        auto f = name=="o3" ? get_rad_field_in(full_name) : get_rad_field_out(full_name);
         auto d_vmr = f.get_view<const Real**>();
 
         // Copy to YAKL
@@ -1380,7 +1558,8 @@ void RRTMGPRadiation::run_impl (const double dt) {
         lw_clnsky_flux_up, lw_clnsky_flux_dn,
         sw_bnd_flux_up   , sw_bnd_flux_dn   , sw_bnd_flux_dir      , lw_bnd_flux_up   , lw_bnd_flux_dn,
         eccf, m_atm_logger,
-        m_extra_clnclrsky_diag, m_extra_clnsky_diag
+        m_extra_clnclrsky_diag, m_extra_clnsky_diag,
+        m_balance_sw_columns ? &m_comm : nullptr
       );
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
@@ -1436,6 +1615,9 @@ void RRTMGPRadiation::run_impl (const double dt) {
         lw_flux_up, lw_flux_dn, p_del, lw_heating
       );
       {
+        const auto interp = m_interp_rad_heating;
+        const auto sw_heating_rad = m_sw_heating_rad;
+        const auto lw_heating_rad = m_lw_heating_rad;
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int idx = team.league_rank();
@@ -1444,6 +1626,10 @@ void RRTMGPRadiation::run_impl (const double dt) {
             // Combine SW and LW heating into a net heating tendency; use d_rad_heating_pdel temporarily
             // Note that for YAKL arrays i and k start with index 1
             d_rad_heating_pdel(icol,ilay) = sw_heating(idx+1,ilay+1) + lw_heating(idx+1,ilay+1);
+            if (interp) {
+              sw_heating_rad(icol,ilay) = sw_heating(idx+1,ilay+1);
+              lw_heating_rad(icol,ilay) = lw_heating(idx+1,ilay+1);
+            }
           });
         });
       }
@@ -1459,6 +1645,9 @@ void RRTMGPRadiation::run_impl (const double dt) {
         lw_flux_up_k, lw_flux_dn_k, p_del_k, lw_heating_k
       );
       {
+        const auto interp = m_interp_rad_heating;
+        const auto sw_heating_rad = m_sw_heating_rad;
+        const auto lw_heating_rad = m_lw_heating_rad;
         const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int idx = team.league_rank();
@@ -1467,6 +1656,10 @@ void RRTMGPRadiation::run_impl (const double dt) {
             // Combine SW and LW heating into a net heating tendency; use d_rad_heating_pdel temporarily
             // Note that for YAKL arrays i and k start with index 1
             d_rad_heating_pdel(icol,ilay) = sw_heating_k(idx,ilay) + lw_heating_k(idx,ilay);
+            if (interp) {
+              sw_heating_rad(icol,ilay) = sw_heating_k(idx,ilay);
+              lw_heating_rad(icol,ilay) = lw_heating_k(idx,ilay);
+            }
           });
         });
       }
@@ -1521,10 +1714,10 @@ void RRTMGPRadiation::run_impl (const double dt) {
 
       // Compute diagnostic total cloud area (vertically-projected cloud cover)
 #ifdef RRTMGP_ENABLE_YAKL
-      real1d cldlow ("cldlow", d_cldlow.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldmed ("cldmed", d_cldmed.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldhgh ("cldhgh", d_cldhgh.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldtot ("cldtot", d_cldtot.data() + m_col_chunk_beg[ic], ncol);
+      real1d cldlow ("cldlow", d_cldlow.data() + m_col_chunks.beg[ic], ncol);
+      real1d cldmed ("cldmed", d_cldmed.data() + m_col_chunks.beg[ic], ncol);
+      real1d cldhgh ("cldhgh", d_cldhgh.data() + m_col_chunks.beg[ic], ncol);
+      real1d cldtot ("cldtot", d_cldtot.data() + m_col_chunks.beg[ic], ncol);
       // NOTE: limits for low, mid, and high clouds are mostly taken from EAM F90 source, with the
       // exception that I removed the restriction on low clouds to be above (numerically lower pressures)
       // 1200 hPa, and on high clouds to be below (numerically high pressures) 50 hPa. This probably
@@ -1537,10 +1730,10 @@ void RRTMGPRadiation::run_impl (const double dt) {
       rrtmgp::compute_cloud_area(ncol, nlay, nlwgpts,     0, std::numeric_limits<Real>::max(), p_lay, cld_tau_lw_gpt, cldtot);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
-      real1dk cldlow_k (d_cldlow.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldmed_k (d_cldmed.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldhgh_k (d_cldhgh.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldtot_k (d_cldtot.data() + m_col_chunk_beg[ic], ncol);
+      real1dk cldlow_k (d_cldlow.data() + m_col_chunks.beg[ic], ncol);
+      real1dk cldmed_k (d_cldmed.data() + m_col_chunks.beg[ic], ncol);
+      real1dk cldhgh_k (d_cldhgh.data() + m_col_chunks.beg[ic], ncol);
+      real1dk cldtot_k (d_cldtot.data() + m_col_chunks.beg[ic], ncol);
       // NOTE: limits for low, mid, and high clouds are mostly taken from EAM F90 source, with the
       // exception that I removed the restriction on low clouds to be above (numerically lower pressures)
       // 1200 hPa, and on high clouds to be below (numerically high pressures) 50 hPa. This probably
@@ -1563,14 +1756,14 @@ void RRTMGPRadiation::run_impl (const double dt) {
       auto idx_105 = rrtmgp::get_wavelength_index_lw(10.5e-6);
 
       // Compute cloud-top diagnostics following AeroCom recommendation
-      real1d T_mid_at_cldtop ("T_mid_at_cldtop", d_T_mid_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d p_mid_at_cldtop ("p_mid_at_cldtop", d_p_mid_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldfrac_ice_at_cldtop ("cldfrac_ice_at_cldtop", d_cldfrac_ice_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldfrac_liq_at_cldtop ("cldfrac_liq_at_cldtop", d_cldfrac_liq_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d cldfrac_tot_at_cldtop ("cldfrac_tot_at_cldtop", d_cldfrac_tot_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d cdnc_at_cldtop ("cdnc_at_cldtop", d_cdnc_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d eff_radius_qc_at_cldtop ("eff_radius_qc_at_cldtop", d_eff_radius_qc_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1d eff_radius_qi_at_cldtop ("eff_radius_qi_at_cldtop", d_eff_radius_qi_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
+      real1d T_mid_at_cldtop ("T_mid_at_cldtop", d_T_mid_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1d p_mid_at_cldtop ("p_mid_at_cldtop", d_p_mid_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1d cldfrac_ice_at_cldtop ("cldfrac_ice_at_cldtop", d_cldfrac_ice_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1d cldfrac_liq_at_cldtop ("cldfrac_liq_at_cldtop", d_cldfrac_liq_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1d cldfrac_tot_at_cldtop ("cldfrac_tot_at_cldtop", d_cldfrac_tot_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1d cdnc_at_cldtop ("cdnc_at_cldtop", d_cdnc_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1d eff_radius_qc_at_cldtop ("eff_radius_qc_at_cldtop", d_eff_radius_qc_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1d eff_radius_qi_at_cldtop ("eff_radius_qi_at_cldtop", d_eff_radius_qi_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
 
       rrtmgp::compute_aerocom_cloudtop(
           ncol, nlay, t_lay, p_lay, p_del, z_del, qc, qi, rel, rei, cldfrac_tot,
@@ -1584,14 +1777,14 @@ void RRTMGPRadiation::run_impl (const double dt) {
       // Get IR 10.5 micron band for COSP
       auto idx_105_k = rrtmgp::get_wavelength_index_lw_k(10.5e-6);
 
-      real1dk T_mid_at_cldtop_k (d_T_mid_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk p_mid_at_cldtop_k (d_p_mid_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldfrac_ice_at_cldtop_k (d_cldfrac_ice_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldfrac_liq_at_cldtop_k (d_cldfrac_liq_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cldfrac_tot_at_cldtop_k (d_cldfrac_tot_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk cdnc_at_cldtop_k (d_cdnc_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk eff_radius_qc_at_cldtop_k (d_eff_radius_qc_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
-      real1dk eff_radius_qi_at_cldtop_k (d_eff_radius_qi_at_cldtop.data() + m_col_chunk_beg[ic], ncol);
+      real1dk T_mid_at_cldtop_k (d_T_mid_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1dk p_mid_at_cldtop_k (d_p_mid_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1dk cldfrac_ice_at_cldtop_k (d_cldfrac_ice_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1dk cldfrac_liq_at_cldtop_k (d_cldfrac_liq_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1dk cldfrac_tot_at_cldtop_k (d_cldfrac_tot_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1dk cdnc_at_cldtop_k (d_cdnc_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1dk eff_radius_qc_at_cldtop_k (d_eff_radius_qc_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
+      real1dk eff_radius_qi_at_cldtop_k (d_eff_radius_qi_at_cldtop.data() + m_col_chunks.beg[ic], ncol);
 
       rrtmgp::compute_aerocom_cloudtop(
           ncol, nlay, t_lay_k, p_lay_k, p_del_k, z_del_k, qc_k, qi_k, rel_k, rei_k, cldfrac_tot_k,
@@ -1714,13 +1907,80 @@ void RRTMGPRadiation::run_impl (const double dt) {
     m_gas_concs_k.concs = gas_concs_k;
     m_gas_concs_k.ncol = orig_ncol_k;
 #endif
+
+    if (m_interp_rad_heating) {
+      m_num_rad_states = std::min(m_num_rad_states+1,2);
+      m_last_rad_step = ts.get_num_steps();
+      ekat::any_cast<int>(m_restart_extra_data["rrtmgp_num_rad_states"]) = m_num_rad_states;
+      ekat::any_cast<int>(m_restart_extra_data["rrtmgp_last_rad_step"])  = m_last_rad_step;
+      // Update the internal fields time stamp (the base class does not)
+      auto t_end = ts;
+      t_end += dt;
+      for (const auto& it : get_internal_fields()) {
+        const auto& fid = it.get_header().get_identifier();
+        auto& f = get_internal_field(fid.name(),fid.get_grid_name());
+        f.get_header().get_tracking().update_time_stamp(t_end);
+      }
+    }
   } // update_rad
 
+  if (m_coarsener) {
+    if (update_rad) {
+      refine_rad_outputs();
+    }
+    // From here on, we work on the physics grid
+    d_tmid = get_field_out("T_mid").get_view<Real**>();
+    d_pdel = get_field_in("pseudo_density").get_view<const Real**>();
+    d_rad_heating_pdel = get_field_out("rad_heating_pdel").get_view<Real**>();
+    d_sw_flux_up = get_field_out("SW_flux_up").get_view<Real**>();
+    d_sw_flux_dn = get_field_out("SW_flux_dn").get_view<Real**>();
+    d_lw_flux_up = get_field_out("LW_flux_up").get_view<Real**>();
+    d_lw_flux_dn = get_field_out("LW_flux_dn").get_view<Real**>();
+  }
+
+  if (interp_heating) {
+    // In between rad steps, rather than reusing the last heating as is, we scale the SW
+    // heating by the ratio of the current cosine zenith angle over the one used in the
+    // last rad step, and linearly extrapolate the LW heating from the last two rad steps.
+    // We store the result in d_rad_heating_pdel, so that it is applied below.
+    auto d_mu0 = m_mu0;
+    auto h_mu0 = Kokkos::create_mirror_view(d_mu0);
+    if (m_fixed_solar_zenith_angle > 0) {
+      Kokkos::deep_copy(h_mu0,m_fixed_solar_zenith_angle);
+    } else {
+      for (int i=0; i<m_ncol; i++) {
+        double lat = h_lat(i)*PC::Pi/180.0;  // Convert lat/lon to radians
+        double lon = h_lon(i)*PC::Pi/180.0;
+        h_mu0(i) = shr_orb_cosz_c2f(calday, lat, lon, delta, dt);
+      }
+    }
+    Kokkos::deep_copy(d_mu0,h_mu0);
+
+    const auto mu0_rad = m_mu0_rad;
+    const auto sw_heating_rad = m_sw_heating_rad;
+    const auto lw_heating_rad = m_lw_heating_rad;
+    const auto lw_heating_prev = m_lw_heating_prev;
+    const Real lw_wgt = m_num_rad_states>1
+                      ? Real(ts.get_num_steps()-m_last_rad_step) / m_rad_freq_in_steps
+                      : 0;
+    // Below this, the zenith angle ratio is unreliable, so keep the SW heating as is
+    constexpr Real mu0_min = 1e-3;
+    const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const int i = team.league_rank();
+      const Real sw_fact = mu0_rad(i)>mu0_min ? ekat::impl::max(d_mu0(i),Real(0))/mu0_rad(i) : Real(1);
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
+        const auto lw = lw_heating_rad(i,k) + lw_wgt*(lw_heating_rad(i,k)-lw_heating_prev(i,k));
+        d_rad_heating_pdel(i,k) = d_pdel(i,k) * (sw_fact*sw_heating_rad(i,k) + lw);
+      });
+    });
+  }
+
   // Apply temperature tendency; if we updated radiation this timestep, then d_rad_heating_pdel should
   // contain actual heating rate, not pdel scaled heating rate. Otherwise, if we have NOT updated the
   // radiative heating, then we need to back out the heating from the rad_heating*pdel term that we carry
   // across timesteps to conserve energy.
-  const int ncols = m_ncol;
+  const int ncols = m_ncol_phys;
   const int nlays = m_nlay;
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols, nlays);
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
@@ -1744,7 +2004,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
     auto ice_flux   = get_field_out("ice_flux").get_view<Real*>();
     auto heat_flux  = get_field_out("heat_flux").get_view<Real*>();
 
-    const int ncols = m_ncol;
+    const int ncols = m_ncol_phys;
     const int nlays = m_nlay;
     const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncols, nlays);
     Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
@@ -1766,7 +2026,166 @@ void RRTMGPRadiation::run_impl (const double dt) {
 }
 // =========================================================================================
 
+Field RRTMGPRadiation::get_rad_field_in (const std::string& name)
+{
+  return m_coarsener ? m_rad_fields.at(name) : get_field_in(name);
+}
+
+Field RRTMGPRadiation::get_rad_field_out (const std::string& name)
+{
+  return m_coarsener ? m_rad_fields.at(name) : get_field_out(name);
+}
+
+void RRTMGPRadiation::setup_rad_to_refiner_exchange ()
+{
+  using namespace ShortFieldTagsNames;
+
+  // All rad fields were created by this class without padding, so the col data
+  // of each field is contiguous. In the buffers, we store the col data of all
+  // fields back to back, so that each col is a contiguous chunk.
+  const int nfields = m_rad_to_refiner_fields.size();
+  m_rad_to_refiner_offsets.resize(nfields+1,0);
+  for (int i=0; i<nfields; ++i) {
+    const auto& fl = m_rad_to_refiner_fields[i].first.get_header().get_identifier().get_layout();
+    m_rad_to_refiner_offsets[i+1] = m_rad_to_refiner_offsets[i] + fl.clone().strip_dim(COL).size();
+  }
+  const int col_size = m_rad_to_refiner_offsets.back();
+
+  // Exports and imports are sorted by pid, so each pid gets a contiguous
+  // portion of the send/recv buffers
+  const int num_exports = m_rad_grid_imp_exp->export_lids().size();
+  const int num_imports = m_rad_grid_imp_exp->import_lids().size();
+  m_rad_send_buffer = view_1d_real("RRTMGPRadiation::rad_send_buf",num_exports*col_size);
+  m_rad_recv_buffer = view_1d_real("RRTMGPRadiation::rad_recv_buf",num_imports*col_size);
+  m_rad_mpi_send_buffer = Kokkos::create_mirror_view(typename mpi_view_1d_real::execution_space(),m_rad_send_buffer);
+  m_rad_mpi_recv_buffer = Kokkos::create_mirror_view(typename mpi_view_1d_real::execution_space(),m_rad_recv_buffer);
+
+  const auto mpi_comm = m_comm.mpi_comm();
+  const auto mpi_real = ekat::get_mpi_type<Real>();
+  auto ncols_send_h = m_rad_grid_imp_exp->num_exports_per_pid_h();
+  auto ncols_recv_h = m_rad_grid_imp_exp->num_imports_per_pid_h();
+  int send_offset = 0;
+  int recv_offset = 0;
+  for (int pid=0; pid<m_comm.size(); ++pid) {
+    if (ncols_send_h(pid)>0) {
+      auto& req = m_rad_send_req.emplace_back();
+      MPI_Send_init (m_rad_mpi_send_buffer.data() + send_offset*col_size,
+                     ncols_send_h(pid)*col_size, mpi_real, pid, 0, mpi_comm, &req);
+      send_offset += ncols_send_h(pid);
+    }
+    if (ncols_recv_h(pid)>0) {
+      auto& req = m_rad_recv_req.emplace_back();
+      MPI_Recv_init (m_rad_mpi_recv_buffer.data() + recv_offset*col_size,
+                     ncols_recv_h(pid)*col_size, mpi_real, pid, 0, mpi_comm, &req);
+      recv_offset += ncols_recv_h(pid);
+    }
+  }
+}
+
+void RRTMGPRadiation::refine_rad_outputs ()
+{
+  if (m_rad_grid_imp_exp) {
+    // Move the outputs to the coarse grid of the refiner, packing/unpacking on device
+    if (not m_rad_recv_req.empty()) {
+      check_mpi_call(MPI_Startall(m_rad_recv_req.size(),m_rad_recv_req.data()),
+                     "[RRTMGPRadiation] starting persistent recv requests.\n");
+    }
+
+    const int nfields = m_rad_to_refiner_fields.size();
+    const int col_size = m_rad_to_refiner_offsets.back();
+    auto export_lids = m_rad_grid_imp_exp->export_lids();
+    auto send_buf = m_rad_send_buffer;
+    const int num_exports = export_lids.size();
+    for (int i=0; i<nfields; ++i) {
+      const auto& f_rad = m_rad_to_refiner_fields[i].first;
+      const int n = m_rad_to_refiner_offsets[i+1] - m_rad_to_refiner_offsets[i];
+      const int f_offset = m_rad_to_refiner_offsets[i];
+      const auto data = f_rad.get_internal_view_data<const Real>();
+      Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,num_exports*n),
+                           KOKKOS_LAMBDA(const int idx) {
+        const int iexp = idx / n;
+        const int k    = idx % n;
+        send_buf(iexp*col_size + f_offset + k) = data[export_lids(iexp)*n + k];
+      });
+    }
+    Kokkos::fence();
+    if (not MpiOnDev) {
+      Kokkos::deep_copy(m_rad_mpi_send_buffer,m_rad_send_buffer);
+    }
+    if (not m_rad_send_req.empty()) {
+      check_mpi_call(MPI_Startall(m_rad_send_req.size(),m_rad_send_req.data()),
+                     "[RRTMGPRadiation] starting persistent send requests.\n");
+    }
+
+    if (not m_rad_recv_req.empty()) {
+      check_mpi_call(MPI_Waitall(m_rad_recv_req.size(),m_rad_recv_req.data(),MPI_STATUSES_IGNORE),
+                     "[RRTMGPRadiation] waiting on persistent recv requests.\n");
+    }
+    if (not MpiOnDev) {
+      Kokkos::deep_copy(m_rad_recv_buffer,m_rad_mpi_recv_buffer);
+    }
+
+    auto import_lids = m_rad_grid_imp_exp->import_lids();
+    auto recv_buf = m_rad_recv_buffer;
+    const int num_imports = import_lids.size();
+    for (int i=0; i<nfields; ++i) {
+      const auto& f_src = m_rad_to_refiner_fields[i].second;
+      const int n = m_rad_to_refiner_offsets[i+1] - m_rad_to_refiner_offsets[i];
+      const int f_offset = m_rad_to_refiner_offsets[i];
+      const auto data = f_src.get_internal_view_data<Real>();
+      Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,num_imports*n),
+                           KOKKOS_LAMBDA(const int idx) {
+        const int iimp = idx / n;
+        const int k    = idx % n;
+        data[import_lids(iimp)*n + k] = recv_buf(iimp*col_size + f_offset + k);
+      });
+    }
+
+    if (not m_rad_send_req.empty()) {
+      check_mpi_call(MPI_Waitall(m_rad_send_req.size(),m_rad_send_req.data(),MPI_STATUSES_IGNORE),
+                     "[RRTMGPRadiation] waiting on persistent send requests.\n");
+    }
+  }
+
+  m_refiner->remap(true);
+
+  // Make the surface fluxes consistent with the physics grid surface properties: the
+  // net SW flux uses the physics grid albedos, and the upward LW flux at the surface
+  // is the physics grid one.
+  auto alb_dir_vis = get_field_in("sfc_alb_dir_vis").get_view<const Real*>();
+  auto alb_dir_nir = get_field_in("sfc_alb_dir_nir").get_view<const Real*>();
+  auto alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
+  auto alb_dif_nir = get_field_in("sfc_alb_dif_nir").get_view<const Real*>();
+  auto surf_lw_flux_up = get_field_in("surf_lw_flux_up").get_view<const Real*>();
+  auto flux_dir_vis = get_field_out("sfc_flux_dir_vis").get_view<const Real*>();
+  auto flux_dir_nir = get_field_out("sfc_flux_dir_nir").get_view<const Real*>();
+  auto flux_dif_vis = get_field_out("sfc_flux_dif_vis").get_view<const Real*>();
+  auto flux_dif_nir = get_field_out("sfc_flux_dif_nir").get_view<const Real*>();
+  auto flux_sw_net  = get_field_out("sfc_flux_sw_net").get_view<Real*>();
+  auto sw_flux_up   = get_field_out("SW_flux_up").get_view<Real**>();
+  auto sw_flux_dn   = get_field_out("SW_flux_dn").get_view<const Real**>();
+  auto lw_flux_up   = get_field_out("LW_flux_up").get_view<Real**>();
+  const int kbot = m_nlay;
+  Kokkos::parallel_for(Kokkos::RangePolicy<ExeSpace>(0,m_ncol_phys), KOKKOS_LAMBDA(const int i) {
+    flux_sw_net(i) = flux_dir_vis(i)*(1-alb_dir_vis(i)) + flux_dir_nir(i)*(1-alb_dir_nir(i))
+                   + flux_dif_vis(i)*(1-alb_dif_vis(i)) + flux_dif_nir(i)*(1-alb_dif_nir(i));
+    sw_flux_up(i,kbot) = sw_flux_dn(i,kbot) - flux_sw_net(i);
+    lw_flux_up(i,kbot) = surf_lw_flux_up(i);
+  });
+}
+
+// =========================================================================================
+
 void RRTMGPRadiation::finalize_impl  () {
+  for (auto& req : m_rad_send_req) {
+    MPI_Request_free(&req);
+  }
+  for (auto& req : m_rad_recv_req) {
+    MPI_Request_free(&req);
+  }
+  m_rad_send_req.clear();
+  m_rad_recv_req.clear();
+
 #ifdef RRTMGP_ENABLE_YAKL
   m_gas_concs.reset();
 #endif
@@ -4,8 +4,15 @@
 #include "cpp/rrtmgp/mo_gas_concentrations.h"
 #include "physics/rrtmgp/scream_rrtmgp_interface.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/grid/remap/abstract_remapper.hpp"
+#include "share/grid/grid_import_export.hpp"
+#include "share/util/eamxx_column_chunks.hpp"
+#include "scream_config.h"
+
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
+
+#include <mpi.h>
 #include <string>
 
 namespace scream {
@@ -49,9 +56,7 @@ public:
 
   // Keep track of number of columns and levels
   int m_ncol;
-  int m_num_col_chunks;
-  int m_col_chunk_size;
-  std::vector<int> m_col_chunk_beg;
+  ColumnChunks m_col_chunks;
   int m_nlay;
   Field m_lat;
   Field m_lon;
@@ -62,6 +67,10 @@ public:
   bool m_extra_clnsky_diag;
   bool m_extra_clnclrsky_diag;
 
+  // Whether we redistribute the daytime SW columns across ranks, so that
+  // all ranks have a similar SW workload
+  bool m_balance_sw_columns;
+
   // The orbital year, used for zenith angle calculations:
   // If > 0, use constant orbital year for duration of simulation
   // If < 0, use year from timestamp for orbital parameters
@@ -107,6 +116,19 @@ public:
   // Rad frequency in number of steps
   int m_rad_freq_in_steps;
 
+  // Whether we interpolate the heating in between rad steps. If so, we keep
+  // the SW heating and cosine zenith angle of the last rad step, and the LW
+  // heating of the last two rad steps. These are internal fields, and the
+  // counters are restart extra data, so that restarts are BFB.
+  bool m_interp_rad_heating;
+  int m_num_rad_states = 0;
+  int m_last_rad_step;
+  view_1d_real m_mu0;
+  view_1d_real m_mu0_rad;
+  view_2d_real m_sw_heating_rad;
+  view_2d_real m_lw_heating_rad;
+  view_2d_real m_lw_heating_prev;
+
   // Whether or not to do subcolumn sampling of cloud state for MCICA
   bool m_do_subcol_sampling;
 
@@ -315,8 +337,50 @@ protected:
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager &buffer_manager);
 
+  // Fields used by the rad computations. If radiation runs on a coarser grid,
+  // these are the coarse copies of the process fields.
+  Field get_rad_field_in  (const std::string& name);
+  Field get_rad_field_out (const std::string& name);
+
+  // Remap the rad outputs from the coarse grid back to the physics grid
+  void refine_rad_outputs ();
+
+  // Create buffers and persistent MPI requests used to move the rad outputs
+  // to the refiner coarse grid (only if the two partitions differ)
+  void setup_rad_to_refiner_exchange ();
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 
+  // If radiation runs on a coarser grid, the inputs are coarsened from the physics
+  // grid before each rad step, and the outputs are refined back to the physics grid.
+  // If the coarse grid of the refiner is partitioned differently from the rad grid,
+  // we first move the outputs to the refiner coarse grid, packing the col data of
+  // all fields in device buffers, using the import/export lists of m_rad_grid_imp_exp.
+  std::shared_ptr<const AbstractGrid>   m_rad_grid;
+  std::shared_ptr<AbstractRemapper>     m_coarsener;
+  std::shared_ptr<AbstractRemapper>     m_refiner;
+  std::shared_ptr<GridImportExport>     m_rad_grid_imp_exp;
+  std::map<std::string,Field>           m_rad_fields;
+  std::vector<std::pair<Field,Field>>   m_rad_to_refiner_fields;
+  int m_ncol_phys;
+
+  // If MpiOnDev=true, we pass device pointers to MPI. Otherwise, we use host mirrors.
+  static constexpr bool MpiOnDev = SCREAM_MPI_ON_DEVICE;
+  using mpi_view_1d_real = typename std::conditional<
+                             MpiOnDev,
+                             view_1d_real,
+                             typename view_1d_real::HostMirror
+                           >::type;
+
+  // Offset of each field within the col data of the send/recv buffers
+  std::vector<int>          m_rad_to_refiner_offsets;
+  view_1d_real              m_rad_send_buffer;
+  view_1d_real              m_rad_recv_buffer;
+  mpi_view_1d_real          m_rad_mpi_send_buffer;
+  mpi_view_1d_real          m_rad_mpi_recv_buffer;
+  std::vector<MPI_Request>  m_rad_send_req;
+  std::vector<MPI_Request>  m_rad_recv_req;
+
   // Struct which contains local variables
   Buffer m_buffer;
 };  // class RRTMGPRadiation
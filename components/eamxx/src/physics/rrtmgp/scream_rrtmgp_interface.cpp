@@ -8,7 +8,10 @@
 #include "cpp/rte/mo_rte_sw.h"
 #include "cpp/rte/mo_rte_lw.h"
 #include "physics/share/physics_constants.hpp"
+#include "share/util/scream_utils.hpp"
 #include "ekat/util/ekat_math_utils.hpp"
+
+#include <numeric>
 #ifdef RRTMGP_ENABLE_KOKKOS
 #include "Kokkos_Random.hpp"
 #endif
@@ -709,7 +712,8 @@ void rrtmgp_main(
   real3d &lw_bnd_flux_up, real3d &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag) {
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const ekat::Comm* sw_balance_comm) {
 
 #ifdef SCREAM_RRTMGP_DEBUG
   // Sanity check inputs, and possibly repair
@@ -842,7 +846,8 @@ void rrtmgp_main(
     sfc_alb_dir, sfc_alb_dif, mu0, aerosol_sw, clouds_sw_gpt,
     fluxes_sw, clnclrsky_fluxes_sw, clrsky_fluxes_sw, clnsky_fluxes_sw,
     tsi_scaling, logger,
-    extra_clnclrsky_diag, extra_clnsky_diag
+    extra_clnclrsky_diag, extra_clnsky_diag,
+    sw_balance_comm
             );
 
   // Do longwave
@@ -1168,6 +1173,328 @@ int3dk get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2d
 #endif
 
 #ifdef RRTMGP_ENABLE_YAKL
+namespace {
+
+// Helpers to move the values of a subset of columns of an array into/out of a
+// (nvals,ncols) buffer, where each buffer column stores the values of one column.
+// The values of column cols(i) are stored in buf(off+1:off+n,i), where n is the
+// number of values per column of the array. On exit, off is incremented by n.
+void pack_cols (const real1d& a, const int1d& cols, const int ncols,
+                const real2d& buf, int& off) {
+  const int o = off;
+  parallel_for(SimpleBounds<1>(ncols), YAKL_LAMBDA(int i) {
+      buf(o+1,i) = a(cols(i));
+    });
+  off += 1;
+}
+void pack_cols (const real2d& a, const int n1, const int1d& cols, const int ncols,
+                const real2d& buf, int& off) {
+  const int o = off;
+  parallel_for(SimpleBounds<2>(n1,ncols), YAKL_LAMBDA(int j, int i) {
+      buf(o+j,i) = a(cols(i),j);
+    });
+  off += n1;
+}
+void pack_cols (const real3d& a, const int n1, const int n2, const int1d& cols, const int ncols,
+                const real2d& buf, int& off) {
+  const int o = off;
+  parallel_for(SimpleBounds<3>(n2,n1,ncols), YAKL_LAMBDA(int k, int j, int i) {
+      buf(o+j+(k-1)*n1,i) = a(cols(i),j,k);
+    });
+  off += n1*n2;
+}
+void unpack_cols (const real2d& buf, const int1d& cols, const int ncols,
+                  const real1d& a, int& off) {
+  const int o = off;
+  parallel_for(SimpleBounds<1>(ncols), YAKL_LAMBDA(int i) {
+      a(cols(i)) = buf(o+1,i);
+    });
+  off += 1;
+}
+void unpack_cols (const real2d& buf, const int1d& cols, const int ncols,
+                  const real2d& a, const int n1, int& off) {
+  const int o = off;
+  parallel_for(SimpleBounds<2>(n1,ncols), YAKL_LAMBDA(int j, int i) {
+      a(cols(i),j) = buf(o+j,i);
+    });
+  off += n1;
+}
+void unpack_cols (const real2d& buf, const int1d& cols, const int ncols,
+                  const real3d& a, const int n1, const int n2, int& off) {
+  const int o = off;
+  parallel_for(SimpleBounds<3>(n2,n1,ncols), YAKL_LAMBDA(int k, int j, int i) {
+      a(cols(i),j,k) = buf(o+j+(k-1)*n1,i);
+    });
+  off += n1*n2;
+}
+
+// Device copy of a list of (1-based) column indices
+int1d get_col_indices (const std::vector<int>& cols) {
+  const int n = cols.size();
+  int1d indices("col_indices", n);
+  auto indices_h = indices.createHostCopy();
+  for (int i = 1; i <= n; i++) {
+    indices_h(i) = cols[i-1];
+  }
+  indices_h.deep_copy_to(indices);
+  return indices;
+}
+
+/*
+ * Shortwave driver with load balancing of the daytime columns across the ranks
+ * of comm. The daytime columns of all ranks are ordered by (rank, local index),
+ * and each rank gets a contiguous range of that ordering, of (almost) equal size.
+ * Each rank computes the fluxes of the columns it received, and sends them back
+ * to the owning rank. Night-time columns have zero fluxes, as in rrtmgp_sw.
+ */
+void rrtmgp_sw_balanced(
+  const int ncol, const int nlay,
+  GasOpticsRRTMGP &k_dist,
+  real2d &p_lay, real2d &t_lay, real2d &p_lev, real2d &t_lev,
+  GasConcs &gas_concs,
+  real2d &sfc_alb_dir, real2d &sfc_alb_dif, real1d &mu0,
+  OpticalProps2str &aerosol, OpticalProps2str &clouds,
+  FluxesByband &fluxes, FluxesBroadband &clnclrsky_fluxes, FluxesBroadband &clrsky_fluxes, FluxesBroadband &clnsky_fluxes,
+  const Real tsi_scaling,
+  const std::shared_ptr<spdlog::logger>& logger,
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const ekat::Comm& comm) {
+
+  // Get problem sizes
+  const int nbnd = k_dist.get_nband();
+  const int ngpt = k_dist.get_ngpt();
+  const int ngas = gas_concs.get_num_gases();
+  const int nlev = nlay+1;
+  auto gas_names = gas_concs.get_gas_names();
+
+  // The broadband and by-band fluxes, in the order they are packed
+  std::vector<real2d> flux2d = {
+    fluxes.flux_up, fluxes.flux_dn, fluxes.flux_dn_dir,
+    clnclrsky_fluxes.flux_up, clnclrsky_fluxes.flux_dn, clnclrsky_fluxes.flux_dn_dir,
+    clrsky_fluxes.flux_up, clrsky_fluxes.flux_dn, clrsky_fluxes.flux_dn_dir,
+    clnsky_fluxes.flux_up, clnsky_fluxes.flux_dn, clnsky_fluxes.flux_dn_dir };
+  std::vector<real3d> flux3d = {
+    fluxes.bnd_flux_up, fluxes.bnd_flux_dn, fluxes.bnd_flux_dn_dir };
+
+  // Get daytime indices (on host, as in rrtmgp_sw), and reset fluxes to zero
+  // (night-time columns are not touched below). With no local columns, the
+  // local arrays may be empty, and we only serve other ranks' columns.
+  std::vector<int> day_cols;
+  if (ncol>0) {
+    for (auto& f : flux2d) { memset(f, 0.); }
+    for (auto& f : flux3d) { memset(f, 0.); }
+
+    auto mu0_h = mu0.createHostCopy();
+    for (int icol = 1; icol <= ncol; icol++) {
+      if (mu0_h(icol) > 0) {
+        day_cols.push_back(icol);
+      }
+    }
+  }
+  const int nday = day_cols.size();
+
+  // Compute the global position of our first daytime column, and the
+  // range of global positions assigned to each rank after balancing
+  const int nranks = comm.size();
+  const int me = comm.rank();
+  std::vector<int> ndays(nranks,0);
+  ndays[me] = nday;
+  comm.all_gather(ndays.data(),1);
+  int ntot = 0, my_start = 0;
+  for (int pid=0; pid<nranks; ++pid) {
+    if (pid==me) {
+      my_start = ntot;
+    }
+    ntot += ndays[pid];
+  }
+  if (ntot==0) {
+    // No daytime columns on any rank, skip the rest of this routine
+    return;
+  }
+  auto balanced_start = [&](const int pid) {
+    return pid*(ntot/nranks) + std::min(pid,ntot%nranks);
+  };
+
+  // Number of inputs/outputs values per column
+  const int nvals_in = 1 + 2*nlay + 2*nlev + ngas*nlay + 2*nbnd + 3*nlay*nbnd + 3*nlay*ngpt;
+  const int nvals_out = flux2d.size()*nlev + flux3d.size()*nlev*nbnd;
+
+  // Pack the inputs of each daytime column, and split them by destination rank
+  std::vector<std::vector<Real>> send(nranks);
+  if (nday>0) {
+    auto dayIndices = get_col_indices(day_cols);
+    real2d buf("sw_balance_in", nvals_in, nday);
+    int off = 0;
+    pack_cols(mu0, dayIndices, nday, buf, off);
+    pack_cols(p_lay, nlay, dayIndices, nday, buf, off);
+    pack_cols(t_lay, nlay, dayIndices, nday, buf, off);
+    pack_cols(p_lev, nlev, dayIndices, nday, buf, off);
+    pack_cols(t_lev, nlev, dayIndices, nday, buf, off);
+    real2d vmr("vmr", ncol, nlay);
+    for (int igas = 0; igas < ngas; igas++) {
+      gas_concs.get_vmr(gas_names[igas], vmr);
+      pack_cols(vmr, nlay, dayIndices, nday, buf, off);
+    }
+    pack_cols(sfc_alb_dir, nbnd, dayIndices, nday, buf, off);
+    pack_cols(sfc_alb_dif, nbnd, dayIndices, nday, buf, off);
+    pack_cols(aerosol.tau, nlay, nbnd, dayIndices, nday, buf, off);
+    pack_cols(aerosol.ssa, nlay, nbnd, dayIndices, nday, buf, off);
+    pack_cols(aerosol.g,   nlay, nbnd, dayIndices, nday, buf, off);
+    pack_cols(clouds.tau, nlay, ngpt, dayIndices, nday, buf, off);
+    pack_cols(clouds.ssa, nlay, ngpt, dayIndices, nday, buf, off);
+    pack_cols(clouds.g,   nlay, ngpt, dayIndices, nday, buf, off);
+
+    // Arrays are column-major, so the values of each column are contiguous
+    auto buf_h = buf.createHostCopy();
+    int pid = 0;
+    for (int iday = 0; iday < nday; iday++) {
+      while (my_start+iday >= balanced_start(pid+1)) {
+        ++pid;
+      }
+      auto beg = buf_h.data() + iday*nvals_in;
+      send[pid].insert(send[pid].end(), beg, beg+nvals_in);
+    }
+  }
+
+  std::vector<int> recv_offsets;
+  auto recv = all_to_all_v(send, recv_offsets, comm);
+  const int nbal = recv.size() / nvals_in;
+
+  // Compute fluxes on the columns we received, and send them back
+  std::vector<std::vector<Real>> send_back(nranks);
+  if (nbal>0) {
+    std::vector<int> bal_cols(nbal);
+    std::iota(bal_cols.begin(), bal_cols.end(), 1);
+    auto balIndices = get_col_indices(bal_cols);
+
+    real2d buf("sw_balance_in", nvals_in, nbal);
+    auto buf_h = buf.createHostCopy();
+    std::copy(recv.begin(), recv.end(), buf_h.data());
+    buf_h.deep_copy_to(buf);
+
+    real1d mu0_bal("mu0_bal", nbal);
+    real2d p_lay_bal("p_lay_bal", nbal, nlay);
+    real2d t_lay_bal("t_lay_bal", nbal, nlay);
+    real2d p_lev_bal("p_lev_bal", nbal, nlev);
+    real2d t_lev_bal("t_lev_bal", nbal, nlev);
+    real2d sfc_alb_dir_bal("sfc_alb_dir_bal", nbal, nbnd);
+    real2d sfc_alb_dif_bal("sfc_alb_dif_bal", nbal, nbnd);
+    GasConcs gas_concs_bal;
+    gas_concs_bal.init(gas_names, nbal, nlay);
+    OpticalProps2str aerosol_bal;
+    aerosol_bal.init(k_dist.get_band_lims_wavenumber());
+    aerosol_bal.alloc_2str(nbal, nlay);
+    OpticalProps2str clouds_bal;
+    clouds_bal.init(k_dist.get_band_lims_wavenumber(), k_dist.get_band_lims_gpoint());
+    clouds_bal.alloc_2str(nbal, nlay);
+
+    int off = 0;
+    unpack_cols(buf, balIndices, nbal, mu0_bal, off);
+    unpack_cols(buf, balIndices, nbal, p_lay_bal, nlay, off);
+    unpack_cols(buf, balIndices, nbal, t_lay_bal, nlay, off);
+    unpack_cols(buf, balIndices, nbal, p_lev_bal, nlev, off);
+    unpack_cols(buf, balIndices, nbal, t_lev_bal, nlev, off);
+    for (int igas = 0; igas < ngas; igas++) {
+      real2d vmr_bal("vmr_bal", nbal, nlay);
+      unpack_cols(buf, balIndices, nbal, vmr_bal, nlay, off);
+      gas_concs_bal.set_vmr(gas_names[igas], vmr_bal);
+    }
+    unpack_cols(buf, balIndices, nbal, sfc_alb_dir_bal, nbnd, off);
+    unpack_cols(buf, balIndices, nbal, sfc_alb_dif_bal, nbnd, off);
+    unpack_cols(buf, balIndices, nbal, aerosol_bal.tau, nlay, nbnd, off);
+    unpack_cols(buf, balIndices, nbal, aerosol_bal.ssa, nlay, nbnd, off);
+    unpack_cols(buf, balIndices, nbal, aerosol_bal.g,   nlay, nbnd, off);
+    unpack_cols(buf, balIndices, nbal, clouds_bal.tau, nlay, ngpt, off);
+    unpack_cols(buf, balIndices, nbal, clouds_bal.ssa, nlay, ngpt, off);
+    unpack_cols(buf, balIndices, nbal, clouds_bal.g,   nlay, ngpt, off);
+
+    FluxesByband fluxes_bal;
+    fluxes_bal.flux_up         = real2d("flux_up_bal", nbal, nlev);
+    fluxes_bal.flux_dn         = real2d("flux_dn_bal", nbal, nlev);
+    fluxes_bal.flux_dn_dir     = real2d("flux_dn_dir_bal", nbal, nlev);
+    fluxes_bal.bnd_flux_up     = real3d("bnd_flux_up_bal", nbal, nlev, nbnd);
+    fluxes_bal.bnd_flux_dn     = real3d("bnd_flux_dn_bal", nbal, nlev, nbnd);
+    fluxes_bal.bnd_flux_dn_dir = real3d("bnd_flux_dn_dir_bal", nbal, nlev, nbnd);
+    FluxesBroadband clnclrsky_fluxes_bal, clrsky_fluxes_bal, clnsky_fluxes_bal;
+    for (auto f : {&clnclrsky_fluxes_bal, &clrsky_fluxes_bal, &clnsky_fluxes_bal}) {
+      f->flux_up     = real2d("flux_up_bal", nbal, nlev);
+      f->flux_dn     = real2d("flux_dn_bal", nbal, nlev);
+      f->flux_dn_dir = real2d("flux_dn_dir_bal", nbal, nlev);
+    }
+
+    // All the columns we received are daytime columns
+    rrtmgp_sw(nbal, nlay, k_dist, p_lay_bal, t_lay_bal, p_lev_bal, t_lev_bal, gas_concs_bal,
+              sfc_alb_dir_bal, sfc_alb_dif_bal, mu0_bal, aerosol_bal, clouds_bal,
+              fluxes_bal, clnclrsky_fluxes_bal, clrsky_fluxes_bal, clnsky_fluxes_bal,
+              tsi_scaling, logger, extra_clnclrsky_diag, extra_clnsky_diag);
+
+    std::vector<real2d> flux2d_bal = {
+      fluxes_bal.flux_up, fluxes_bal.flux_dn, fluxes_bal.flux_dn_dir,
+      clnclrsky_fluxes_bal.flux_up, clnclrsky_fluxes_bal.flux_dn, clnclrsky_fluxes_bal.flux_dn_dir,
+      clrsky_fluxes_bal.flux_up, clrsky_fluxes_bal.flux_dn, clrsky_fluxes_bal.flux_dn_dir,
+      clnsky_fluxes_bal.flux_up, clnsky_fluxes_bal.flux_dn, clnsky_fluxes_bal.flux_dn_dir };
+    std::vector<real3d> flux3d_bal = {
+      fluxes_bal.bnd_flux_up, fluxes_bal.bnd_flux_dn, fluxes_bal.bnd_flux_dn_dir };
+
+    real2d buf_out("sw_balance_out", nvals_out, nbal);
+    off = 0;
+    for (const auto& f : flux2d_bal) {
+      pack_cols(f, nlev, balIndices, nbal, buf_out, off);
+    }
+    for (const auto& f : flux3d_bal) {
+      pack_cols(f, nlev, nbnd, balIndices, nbal, buf_out, off);
+    }
+
+    // Columns from rank pid are in [recv_offsets[pid],recv_offsets[pid+1])/nvals_in
+    auto buf_out_h = buf_out.createHostCopy();
+    for (int pid=0; pid<nranks; ++pid) {
+      auto beg = buf_out_h.data() + (recv_offsets[pid]/nvals_in)*nvals_out;
+      auto end = buf_out_h.data() + (recv_offsets[pid+1]/nvals_in)*nvals_out;
+      send_back[pid].assign(beg, end);
+    }
+  }
+
+  // We get back the fluxes of our daytime columns, in the same order we sent them
+  auto recv_back = all_to_all_v(send_back, recv_offsets, comm);
+  if (nday>0) {
+    auto dayIndices = get_col_indices(day_cols);
+    real2d buf("sw_balance_out", nvals_out, nday);
+    auto buf_h = buf.createHostCopy();
+    std::copy(recv_back.begin(), recv_back.end(), buf_h.data());
+    buf_h.deep_copy_to(buf);
+
+    // Expand daytime fluxes to all columns
+    int off = 0;
+    for (const auto& f : flux2d) {
+      unpack_cols(buf, dayIndices, nday, f, nlev, off);
+    }
+    for (const auto& f : flux3d) {
+      unpack_cols(buf, dayIndices, nday, f, nlev, nbnd, off);
+    }
+  }
+}
+
+} // anonymous namespace
+
+void rrtmgp_sw_balance_no_cols(
+  const int nlay,
+  GasConcs &gas_concs,
+  const Real tsi_scaling,
+  const std::shared_ptr<spdlog::logger>& logger,
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const ekat::Comm& sw_balance_comm) {
+  real2d p_lay, t_lay, p_lev, t_lev, sfc_alb_dir, sfc_alb_dif;
+  real1d mu0;
+  OpticalProps2str aerosol, clouds;
+  FluxesByband fluxes;
+  FluxesBroadband clnclrsky_fluxes, clrsky_fluxes, clnsky_fluxes;
+  rrtmgp_sw_balanced(0, nlay, k_dist_sw, p_lay, t_lay, p_lev, t_lev, gas_concs,
+                     sfc_alb_dir, sfc_alb_dif, mu0, aerosol, clouds,
+                     fluxes, clnclrsky_fluxes, clrsky_fluxes, clnsky_fluxes,
+                     tsi_scaling, logger, extra_clnclrsky_diag, extra_clnsky_diag,
+                     sw_balance_comm);
+}
+
 void rrtmgp_sw(
   const int ncol, const int nlay,
   GasOpticsRRTMGP &k_dist,
@@ -1178,7 +1505,17 @@ void rrtmgp_sw(
   FluxesByband &fluxes, FluxesBroadband &clnclrsky_fluxes, FluxesBroadband &clrsky_fluxes, FluxesBroadband &clnsky_fluxes,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag) {
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const ekat::Comm* sw_balance_comm) {
+
+  if (sw_balance_comm!=nullptr) {
+    rrtmgp_sw_balanced(ncol, nlay, k_dist, p_lay, t_lay, p_lev, t_lev, gas_concs,
+                       sfc_alb_dir, sfc_alb_dif, mu0, aerosol, clouds,
+                       fluxes, clnclrsky_fluxes, clrsky_fluxes, clnsky_fluxes,
+                       tsi_scaling, logger, extra_clnclrsky_diag, extra_clnsky_diag,
+                       *sw_balance_comm);
+    return;
+  }
 
   // Get problem sizes
   int nbnd = k_dist.get_nband();
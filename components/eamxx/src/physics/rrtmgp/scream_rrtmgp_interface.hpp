@@ -137,7 +137,8 @@ extern void rrtmgp_main(
   real3d &lw_bnd_flux_up, real3d &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false);
+  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false,
+  const ekat::Comm* sw_balance_comm = nullptr);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
 extern void rrtmgp_main(
@@ -171,6 +172,10 @@ extern void rrtmgp_finalize();
 
 /*
  * Shortwave driver (called by rrtmgp_main)
+ * If sw_balance_comm is not null, the daytime columns are redistributed across
+ * the ranks of sw_balance_comm, so that all ranks do the same amount of SW work,
+ * and the resulting fluxes are sent back to the owning ranks. In this case, all
+ * ranks of sw_balance_comm must call this function the same number of times.
  */
 #ifdef RRTMGP_ENABLE_YAKL
 extern void rrtmgp_sw(
@@ -183,7 +188,8 @@ extern void rrtmgp_sw(
   FluxesByband &fluxes, FluxesBroadband &clnclrsky_fluxes, FluxesBroadband &clrsky_fluxes, FluxesBroadband &clnsky_fluxes,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag);
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const ekat::Comm* sw_balance_comm = nullptr);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
 extern void rrtmgp_sw(
@@ -199,6 +205,21 @@ extern void rrtmgp_sw(
   const bool extra_clnclrsky_diag, const bool extra_clnsky_diag);
 #endif
 
+/*
+ * Take part in the balanced SW exchange without local columns (e.g., on a rank
+ * with fewer columns than radiation column chunks). Daytime columns of other
+ * ranks may still be assigned to, and computed by, this rank.
+ */
+#ifdef RRTMGP_ENABLE_YAKL
+extern void rrtmgp_sw_balance_no_cols(
+  const int nlay,
+  GasConcs &gas_concs,
+  const Real tsi_scaling,
+  const std::shared_ptr<spdlog::logger>& logger,
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const ekat::Comm& sw_balance_comm);
+#endif
+
 /*
  * Longwave driver (called by rrtmgp_main)
  */
@@ -0,0 +1,221 @@
+#include "catch2/catch.hpp"
+#include "physics/rrtmgp/scream_rrtmgp_interface.hpp"
+#include "physics/rrtmgp/rrtmgp_test_utils.hpp"
+
+#include "share/scream_types.hpp"
+
+#include "cpp/rrtmgp/mo_gas_concentrations.h"
+#include "examples/all-sky/mo_garand_atmos_io.h"
+
+#ifdef RRTMGP_ENABLE_YAKL
+#include "YAKL.h"
+#endif
+
+#include <ekat/logging/ekat_logger.hpp>
+#include <ekat/mpi/ekat_comm.hpp>
+
+namespace {
+
+using namespace scream;
+
+// Names of input files we will need.
+std::string inputfile = SCREAM_DATA_DIR "/init/rrtmgp-allsky.nc";
+std::string coefficients_file_sw = SCREAM_DATA_DIR "/init/rrtmgp-data-sw-g224-2018-12-04.nc";
+std::string coefficients_file_lw = SCREAM_DATA_DIR "/init/rrtmgp-data-lw-g256-2018-12-04.nc";
+std::string cloud_optics_file_sw = SCREAM_DATA_DIR "/init/rrtmgp-cloud-optics-coeffs-sw.nc";
+std::string cloud_optics_file_lw = SCREAM_DATA_DIR "/init/rrtmgp-cloud-optics-coeffs-lw.nc";
+
+#ifdef RRTMGP_ENABLE_YAKL
+
+// Outputs of rrtmgp_main. We only compare the SW ones, but all are needed to run it.
+struct Outputs {
+  Outputs (const int ncol, const int nlay) {
+    const int nlev = nlay+1;
+    const int nswbands = rrtmgp::k_dist_sw.get_nband();
+    const int nlwbands = rrtmgp::k_dist_lw.get_nband();
+    const int nswgpts  = rrtmgp::k_dist_sw.get_ngpt();
+    const int nlwgpts  = rrtmgp::k_dist_lw.get_ngpt();
+    for (auto f : {&sw_flux_up, &sw_flux_dn, &sw_flux_dn_dir, &lw_flux_up, &lw_flux_dn,
+                   &sw_clnclrsky_flux_up, &sw_clnclrsky_flux_dn, &sw_clnclrsky_flux_dn_dir,
+                   &sw_clrsky_flux_up, &sw_clrsky_flux_dn, &sw_clrsky_flux_dn_dir,
+                   &sw_clnsky_flux_up, &sw_clnsky_flux_dn, &sw_clnsky_flux_dn_dir,
+                   &lw_clnclrsky_flux_up, &lw_clnclrsky_flux_dn,
+                   &lw_clrsky_flux_up, &lw_clrsky_flux_dn,
+                   &lw_clnsky_flux_up, &lw_clnsky_flux_dn}) {
+      *f = real2d("flux", ncol, nlev);
+    }
+    for (auto f : {&sw_bnd_flux_up, &sw_bnd_flux_dn, &sw_bnd_flux_dn_dir}) {
+      *f = real3d("sw_bnd_flux", ncol, nlev, nswbands);
+    }
+    for (auto f : {&lw_bnd_flux_up, &lw_bnd_flux_dn}) {
+      *f = real3d("lw_bnd_flux", ncol, nlev, nlwbands);
+    }
+    cld_tau_sw_bnd = real3d("cld_tau_sw_bnd", ncol, nlay, nswbands);
+    cld_tau_lw_bnd = real3d("cld_tau_lw_bnd", ncol, nlay, nlwbands);
+    cld_tau_sw_gpt = real3d("cld_tau_sw_gpt", ncol, nlay, nswgpts);
+    cld_tau_lw_gpt = real3d("cld_tau_lw_gpt", ncol, nlay, nlwgpts);
+  }
+
+  std::vector<real2d> sw_fluxes () const {
+    return {sw_flux_up, sw_flux_dn, sw_flux_dn_dir,
+            sw_clnclrsky_flux_up, sw_clnclrsky_flux_dn, sw_clnclrsky_flux_dn_dir,
+            sw_clrsky_flux_up, sw_clrsky_flux_dn, sw_clrsky_flux_dn_dir,
+            sw_clnsky_flux_up, sw_clnsky_flux_dn, sw_clnsky_flux_dn_dir};
+  }
+
+  real2d sw_flux_up, sw_flux_dn, sw_flux_dn_dir, lw_flux_up, lw_flux_dn;
+  real2d sw_clnclrsky_flux_up, sw_clnclrsky_flux_dn, sw_clnclrsky_flux_dn_dir;
+  real2d sw_clrsky_flux_up, sw_clrsky_flux_dn, sw_clrsky_flux_dn_dir;
+  real2d sw_clnsky_flux_up, sw_clnsky_flux_dn, sw_clnsky_flux_dn_dir;
+  real2d lw_clnclrsky_flux_up, lw_clnclrsky_flux_dn;
+  real2d lw_clrsky_flux_up, lw_clrsky_flux_dn;
+  real2d lw_clnsky_flux_up, lw_clnsky_flux_dn;
+  real3d sw_bnd_flux_up, sw_bnd_flux_dn, sw_bnd_flux_dn_dir;
+  real3d lw_bnd_flux_up, lw_bnd_flux_dn;
+  real3d cld_tau_sw_bnd, cld_tau_lw_bnd, cld_tau_sw_gpt, cld_tau_lw_gpt;
+};
+
+TEST_CASE("rrtmgp_sw_balanced") {
+  using namespace ekat::logger;
+  using logger_t = Logger<LogNoFile,LogRootRank>;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  auto logger = std::make_shared<logger_t>("",LogLevel::info,comm);
+
+  if (!yakl::isInitialized()) { yakl::init(); }
+
+  // Get the number of columns from the reference fluxes in the input file
+  real2d sw_flux_up_ref, sw_flux_dn_ref, sw_flux_dir_ref, lw_flux_up_ref, lw_flux_dn_ref;
+  rrtmgpTest::read_fluxes(inputfile, sw_flux_up_ref, sw_flux_dn_ref, sw_flux_dir_ref, lw_flux_up_ref, lw_flux_dn_ref);
+  const int ncol = sw_flux_up_ref.dimension[0];
+  const int nlay = sw_flux_up_ref.dimension[1] - 1;
+
+  real2d p_lay("p_lay", ncol, nlay);
+  real2d t_lay("t_lay", ncol, nlay);
+  real2d p_lev("p_lev", ncol, nlay+1);
+  real2d t_lev("t_lev", ncol, nlay+1);
+  real2d col_dry;
+  GasConcs gas_concs;
+  read_atmos(inputfile, p_lay, t_lay, p_lev, t_lev, gas_concs, col_dry, ncol);
+
+  rrtmgp::rrtmgp_initialize(gas_concs, coefficients_file_sw, coefficients_file_lw, cloud_optics_file_sw, cloud_optics_file_lw, logger);
+
+  real1d sfc_alb_dir_vis("sfc_alb_dir_vis", ncol);
+  real1d sfc_alb_dir_nir("sfc_alb_dir_nir", ncol);
+  real1d sfc_alb_dif_vis("sfc_alb_dif_vis", ncol);
+  real1d sfc_alb_dif_nir("sfc_alb_dif_nir", ncol);
+  real1d mu0("mu0", ncol);
+  real2d lwp("lwp", ncol, nlay);
+  real2d iwp("iwp", ncol, nlay);
+  real2d rel("rel", ncol, nlay);
+  real2d rei("rei", ncol, nlay);
+  real2d cld("cld", ncol, nlay);
+  rrtmgpTest::dummy_atmos(
+    inputfile, ncol, p_lay, t_lay,
+    sfc_alb_dir_vis, sfc_alb_dir_nir,
+    sfc_alb_dif_vis, sfc_alb_dif_nir,
+    mu0,
+    lwp, iwp, rel, rei, cld
+  );
+
+  // Make the daytime columns unevenly distributed: rank 0 is all night,
+  // while on rank r>0 only one column every r+1 is a nighttime column
+  const int rank = comm.rank();
+  auto mu0_h = mu0.createHostCopy();
+  for (int icol=1; icol<=ncol; ++icol) {
+    if (rank==0 or icol%(rank+1)==0) {
+      mu0_h(icol) = 0;
+    }
+  }
+  mu0_h.deep_copy_to(mu0);
+
+  const int nswbands = rrtmgp::k_dist_sw.get_nband();
+  const int nlwbands = rrtmgp::k_dist_lw.get_nband();
+  real2d sfc_alb_dir("sfc_alb_dir", ncol, nswbands);
+  real2d sfc_alb_dif("sfc_alb_dif", ncol, nswbands);
+  rrtmgp::compute_band_by_band_surface_albedos(
+    ncol, nswbands,
+    sfc_alb_dir_vis, sfc_alb_dir_nir,
+    sfc_alb_dif_vis, sfc_alb_dif_nir,
+    sfc_alb_dir, sfc_alb_dif);
+
+  real3d aer_tau_sw("aer_tau_sw", ncol, nlay, nswbands);
+  real3d aer_ssa_sw("aer_ssa_sw", ncol, nlay, nswbands);
+  real3d aer_asm_sw("aer_asm_sw", ncol, nlay, nswbands);
+  real3d aer_tau_lw("aer_tau_lw", ncol, nlay, nlwbands);
+  memset(aer_tau_sw, 0.0);
+  memset(aer_ssa_sw, 0.0);
+  memset(aer_asm_sw, 0.0);
+  memset(aer_tau_lw, 0.0);
+
+  const Real tsi_scaling = 1;
+  auto run = [&](Outputs& o, const ekat::Comm* sw_balance_comm) {
+    rrtmgp::rrtmgp_main(
+      ncol, nlay,
+      p_lay, t_lay, p_lev, t_lev, gas_concs,
+      sfc_alb_dir, sfc_alb_dif, mu0,
+      lwp, iwp, rel, rei, cld,
+      aer_tau_sw, aer_ssa_sw, aer_asm_sw, aer_tau_lw,
+      o.cld_tau_sw_bnd, o.cld_tau_lw_bnd,
+      o.cld_tau_sw_gpt, o.cld_tau_lw_gpt,
+      o.sw_flux_up, o.sw_flux_dn, o.sw_flux_dn_dir,
+      o.lw_flux_up, o.lw_flux_dn,
+      o.sw_clnclrsky_flux_up, o.sw_clnclrsky_flux_dn, o.sw_clnclrsky_flux_dn_dir,
+      o.sw_clrsky_flux_up, o.sw_clrsky_flux_dn, o.sw_clrsky_flux_dn_dir,
+      o.sw_clnsky_flux_up, o.sw_clnsky_flux_dn, o.sw_clnsky_flux_dn_dir,
+      o.lw_clnclrsky_flux_up, o.lw_clnclrsky_flux_dn,
+      o.lw_clrsky_flux_up, o.lw_clrsky_flux_dn,
+      o.lw_clnsky_flux_up, o.lw_clnsky_flux_dn,
+      o.sw_bnd_flux_up, o.sw_bnd_flux_dn, o.sw_bnd_flux_dn_dir,
+      o.lw_bnd_flux_up, o.lw_bnd_flux_dn, tsi_scaling,
+      logger, true, true, sw_balance_comm);
+  };
+
+  // Each column is computed independently, so moving it to another rank
+  // must not change its fluxes
+  const double tol = 1e-8;
+  Outputs ref(ncol,nlay);
+  run(ref,nullptr);
+
+  SECTION ("all_ranks_with_cols") {
+    Outputs bal(ncol,nlay);
+    run(bal,&comm);
+
+    auto ref_fluxes = ref.sw_fluxes();
+    auto bal_fluxes = bal.sw_fluxes();
+    for (size_t i=0; i<ref_fluxes.size(); ++i) {
+      REQUIRE (rrtmgpTest::all_close(ref_fluxes[i],bal_fluxes[i],tol));
+    }
+    for (auto f : {&Outputs::sw_bnd_flux_up, &Outputs::sw_bnd_flux_dn, &Outputs::sw_bnd_flux_dn_dir}) {
+      auto ref_h = (ref.*f).createHostCopy();
+      auto bal_h = (bal.*f).createHostCopy();
+      for (int i=0; i<static_cast<int>(ref_h.totElems()); ++i) {
+        REQUIRE (std::abs(ref_h.data()[i]-bal_h.data()[i])<=tol);
+      }
+    }
+  }
+
+  SECTION ("rank_without_cols") {
+    // Rank 0 has no daytime columns, so it can join the exchange without any
+    // local column, and still compute the daytime columns of the other ranks
+    Outputs bal(ncol,nlay);
+    if (rank==0) {
+      rrtmgp::rrtmgp_sw_balance_no_cols(nlay, gas_concs, tsi_scaling, logger, true, true, comm);
+    } else {
+      run(bal,&comm);
+
+      auto ref_fluxes = ref.sw_fluxes();
+      auto bal_fluxes = bal.sw_fluxes();
+      for (size_t i=0; i<ref_fluxes.size(); ++i) {
+        REQUIRE (rrtmgpTest::all_close(ref_fluxes[i],bal_fluxes[i],tol));
+      }
+    }
+  }
+
+  gas_concs.reset();
+  rrtmgp::rrtmgp_finalize();
+}
+
+#endif // RRTMGP_ENABLE_YAKL
+
+} // anonymous namespace
@@ -6,9 +6,27 @@
 
 #include "scream_config.h" // for SCREAM_CIME_BUILD
 
+#include "ekat/std_meta/ekat_std_utils.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+
 namespace scream
 {
 
+namespace {
+
+// Names of the runtime options, in the order of the SHOCRuntime::col_options entries
+const std::vector<std::string>& runtime_options_names ()
+{
+  static const std::vector<std::string> names = {
+    "lambda_low", "lambda_high", "lambda_slope", "lambda_thresh",
+    "thl2tune", "qw2tune", "qwthl2tune", "w2tune",
+    "length_fac", "c_diag_3rd_mom", "Ckh", "Ckm"
+  };
+  return names;
+}
+
+} // anonymous namespace
+
 // =========================================================================================
 SHOCMacrophysics::SHOCMacrophysics (const ekat::Comm& comm,const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
@@ -29,6 +47,13 @@ void SHOCMacrophysics::set_grids(const std::shared_ptr<const GridsManager> grids
   m_num_cols = m_grid->get_num_local_dofs(); // Number of columns on this rank
   m_num_levs = m_grid->get_num_vertical_levels();  // Number of levels per column
 
+  // Figure out column chunks stats. A non-positive chunk size means "all columns"
+  m_col_chunks = make_column_chunks(m_num_cols,m_params.get("column_chunk_size", m_num_cols));
+  this->log(LogLevel::debug,
+            "[SHOCMacrophysics::set_grids] Col chunking stats:\n"
+            "  - Chunk size: " + std::to_string(m_col_chunks.size) + "\n"
+            "  - Number of chunks: " + std::to_string(m_col_chunks.num) + "\n");
+
   // Define the different field layouts that will be used for this process
 
   // Layout for 2D (1d horiz X 1d vertical) variable
@@ -89,6 +114,21 @@ void SHOCMacrophysics::set_grids(const std::shared_ptr<const GridsManager> grids
   add_field<Computed>("w_variance",       scalar3d_mid, m2/s2,       grid_name, ps);
   add_field<Computed>("cldfrac_liq_prev", scalar3d_mid, nondim,      grid_name, ps);
 
+  // Runtime options that vary across columns are read from input fields
+  using vos_t = std::vector<std::string>;
+  m_col_options_names = m_params.get<vos_t>("per_column_runtime_options",vos_t{});
+#ifdef SCREAM_SMALL_KERNELS
+  EKAT_REQUIRE_MSG (m_col_options_names.empty(),
+      "Error! Per-column SHOC runtime options are not supported with small kernels.\n");
+#endif
+  for (const auto& name : m_col_options_names) {
+    EKAT_REQUIRE_MSG (ekat::contains(runtime_options_names(),name),
+        "Error! Invalid entry in SHOC per_column_runtime_options.\n"
+        "  - entry: " + name + "\n"
+        "  - valid entries: " + ekat::join(runtime_options_names(),", ") + "\n");
+    add_field<Required>("shoc_"+name, scalar2d, nondim, grid_name);
+  }
+
   // Tracer group
   add_group<Updated>("tracers", grid_name, ps, Bundling::Required);
 
@@ -127,15 +167,16 @@ size_t SHOCMacrophysics::requested_buffer_size_in_bytes() const
   const int nlevi_packs      = ekat::npack<Spack>(m_num_levs+1);
   const int num_tracer_packs = ekat::npack<Spack>(m_num_tracers);
 
-  // Number of Reals needed by local views in the interface
-  const size_t interface_request = Buffer::num_1d_scalar_ncol*m_num_cols*sizeof(Real) +
+  // Number of Reals needed by local views in the interface. Local views
+  // (and the workspace) only need to store one column chunk at a time.
+  const size_t interface_request = Buffer::num_1d_scalar_ncol*m_col_chunks.size*sizeof(Real) +
                                    Buffer::num_1d_scalar_nlev*nlev_packs*sizeof(Spack) +
-                                   Buffer::num_2d_vector_mid*m_num_cols*nlev_packs*sizeof(Spack) +
-                                   Buffer::num_2d_vector_int*m_num_cols*nlevi_packs*sizeof(Spack) +
-                                   Buffer::num_2d_vector_tr*m_num_cols*num_tracer_packs*sizeof(Spack);
+                                   Buffer::num_2d_vector_mid*m_col_chunks.size*nlev_packs*sizeof(Spack) +
+                                   Buffer::num_2d_vector_int*m_col_chunks.size*nlevi_packs*sizeof(Spack) +
+                                   Buffer::num_2d_vector_tr*m_col_chunks.size*num_tracer_packs*sizeof(Spack);
 
   // Number of Reals needed by the WorkspaceManager passed to shoc_main
-  const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
+  const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_col_chunks.size, nlev_packs);
   const int n_wind_slots  = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots  = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
   const size_t wsm_request= WSM::get_total_bytes_needed(nlevi_packs, 14+(n_wind_slots+n_trac_slots), policy);
@@ -161,7 +202,7 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
 #endif
     };
   for (int i = 0; i < Buffer::num_1d_scalar_ncol; ++i) {
-    *_1d_scalar_view_ptrs[i] = scalar_view_t(mem, m_num_cols);
+    *_1d_scalar_view_ptrs[i] = scalar_view_t(mem, m_col_chunks.size);
     mem += _1d_scalar_view_ptrs[i]->size();
   }
 
@@ -195,15 +236,15 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
   };
 
   for (int i = 0; i < Buffer::num_2d_vector_mid; ++i) {
-    *_2d_spack_mid_view_ptrs[i] = spack_2d_view_t(s_mem, m_num_cols, nlev_packs);
+    *_2d_spack_mid_view_ptrs[i] = spack_2d_view_t(s_mem, m_col_chunks.size, nlev_packs);
     s_mem += _2d_spack_mid_view_ptrs[i]->size();
   }
 
   for (int i = 0; i < Buffer::num_2d_vector_int; ++i) {
-    *_2d_spack_int_view_ptrs[i] = spack_2d_view_t(s_mem, m_num_cols, nlevi_packs);
+    *_2d_spack_int_view_ptrs[i] = spack_2d_view_t(s_mem, m_col_chunks.size, nlevi_packs);
     s_mem += _2d_spack_int_view_ptrs[i]->size();
   }
-  m_buffer.wtracer_sfc = decltype(m_buffer.wtracer_sfc)(s_mem, m_num_cols, num_tracer_packs);
+  m_buffer.wtracer_sfc = decltype(m_buffer.wtracer_sfc)(s_mem, m_col_chunks.size, num_tracer_packs);
   s_mem += m_buffer.wtracer_sfc.size();
 
   // WSM data
@@ -211,7 +252,7 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
 
   // Compute workspace manager size to check used memory
   // vs. requested memory
-  const auto policy      = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
+  const auto policy      = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_col_chunks.size, nlev_packs);
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
   const int wsm_size     = WSM::get_total_bytes_needed(nlevi_packs, 14+(n_wind_slots+n_trac_slots), policy)/sizeof(Spack);
@@ -237,153 +278,16 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   runtime_options.c_diag_3rd_mom = m_params.get<double>("c_diag_3rd_mom");
   runtime_options.Ckh           = m_params.get<double>("Ckh");
   runtime_options.Ckm           = m_params.get<double>("Ckm");
-  // Initialize all of the structures that are passed to shoc_main in run_impl.
-  // Note: Some variables in the structures are not stored in the field manager.  For these
-  //       variables a local view is constructed.
-  const auto& T_mid               = get_field_out("T_mid").get_view<Spack**>();
-  const auto& p_mid               = get_field_in("p_mid").get_view<const Spack**>();
-  const auto& p_int               = get_field_in("p_int").get_view<const Spack**>();
-  const auto& pseudo_density      = get_field_in("pseudo_density").get_view<const Spack**>();
-  const auto& omega               = get_field_in("omega").get_view<const Spack**>();
-  const auto& surf_sens_flux      = get_field_in("surf_sens_flux").get_view<const Real*>();
-  const auto& surf_evap           = get_field_in("surf_evap").get_view<const Real*>();
-  const auto& surf_mom_flux       = get_field_in("surf_mom_flux").get_view<const Real**>();
-  const auto& qtracers            = get_group_out("tracers").m_bundle->get_view<Spack***>();
-  const auto& qc                  = get_field_out("qc").get_view<Spack**>();
-  const auto& qv                  = get_field_out("qv").get_view<Spack**>();
-  const auto& tke                 = get_field_out("tke").get_view<Spack**>();
-  const auto& cldfrac_liq         = get_field_out("cldfrac_liq").get_view<Spack**>();
-  const auto& cldfrac_liq_prev    = get_field_out("cldfrac_liq_prev").get_view<Spack**>();
-  const auto& sgs_buoy_flux       = get_field_out("sgs_buoy_flux").get_view<Spack**>();
-  const auto& tk                  = get_field_out("eddy_diff_mom").get_view<Spack**>();
-  const auto& inv_qc_relvar       = get_field_out("inv_qc_relvar").get_view<Spack**>();
-  const auto& phis                = get_field_in("phis").get_view<const Real*>();
-
-  // Alias local variables from temporary buffer
-  auto z_mid       = m_buffer.z_mid;
-  auto z_int       = m_buffer.z_int;
-  auto wpthlp_sfc  = m_buffer.wpthlp_sfc;
-  auto wprtp_sfc   = m_buffer.wprtp_sfc;
-  auto upwp_sfc    = m_buffer.upwp_sfc;
-  auto vpwp_sfc    = m_buffer.vpwp_sfc;
-  auto rrho        = m_buffer.rrho;
-  auto rrho_i      = m_buffer.rrho_i;
-  auto thv         = m_buffer.thv;
-  auto dz          = m_buffer.dz;
-  auto zt_grid     = m_buffer.zt_grid;
-  auto zi_grid     = m_buffer.zi_grid;
-  auto wtracer_sfc = m_buffer.wtracer_sfc;
-  auto wm_zt       = m_buffer.wm_zt;
-  auto inv_exner   = m_buffer.inv_exner;
-  auto thlm        = m_buffer.thlm;
-  auto qw          = m_buffer.qw;
-  auto dse         = m_buffer.dse;
-  auto tke_copy    = m_buffer.tke_copy;
-  auto qc_copy     = m_buffer.qc_copy;
-  auto shoc_ql2    = m_buffer.shoc_ql2;
-
-  // For now, set z_int(i,nlevs) = z_surf = 0
-  const Real z_surf = 0.0;
-
+  if (not m_col_options_names.empty()) {
+    m_col_options = sview_2d("shoc_col_options",m_num_cols,SHF::SHOCRuntime::num_options);
+  }
   // Some SHOC variables should be initialized uniformly if an Initial run
   if (run_type==RunType::Initial){
-    Kokkos::deep_copy(sgs_buoy_flux,0.0);
-    Kokkos::deep_copy(tk,0.0);
-    Kokkos::deep_copy(tke,0.0004);
-    Kokkos::deep_copy(tke_copy,0.0004);
-    Kokkos::deep_copy(cldfrac_liq,0.0);
-  }
-
-  shoc_preprocess.set_variables(m_num_cols,m_num_levs,m_num_tracers,z_surf,
-                                T_mid,p_mid,p_int,pseudo_density,omega,phis,surf_sens_flux,surf_evap,
-                                surf_mom_flux,qtracers,qv,qc,qc_copy,tke,tke_copy,z_mid,z_int,
-                                dse,rrho,rrho_i,thv,dz,zt_grid,zi_grid,wpthlp_sfc,wprtp_sfc,upwp_sfc,vpwp_sfc,
-                                wtracer_sfc,wm_zt,inv_exner,thlm,qw, cldfrac_liq, cldfrac_liq_prev);
-
-  // Input Variables:
-  input.zt_grid     = shoc_preprocess.zt_grid;
-  input.zi_grid     = shoc_preprocess.zi_grid;
-  input.pres        = p_mid;
-  input.presi       = p_int;
-  input.pdel        = pseudo_density;
-  input.thv         = shoc_preprocess.thv;
-  input.w_field     = shoc_preprocess.wm_zt;
-  input.wthl_sfc    = shoc_preprocess.wpthlp_sfc;
-  input.wqw_sfc     = shoc_preprocess.wprtp_sfc;
-  input.uw_sfc      = shoc_preprocess.upwp_sfc;
-  input.vw_sfc      = shoc_preprocess.vpwp_sfc;
-  input.wtracer_sfc = shoc_preprocess.wtracer_sfc;
-  input.inv_exner   = shoc_preprocess.inv_exner;
-  input.phis        = phis;
-
-  // Input/Output Variables
-  input_output.host_dse     = shoc_preprocess.shoc_s;
-  input_output.tke          = shoc_preprocess.tke_copy;
-  input_output.thetal       = shoc_preprocess.thlm;
-  input_output.qw           = shoc_preprocess.qw;
-  input_output.horiz_wind   = get_field_out("horiz_winds").get_view<Spack***>();
-  input_output.wthv_sec     = sgs_buoy_flux;
-  input_output.qtracers     = shoc_preprocess.qtracers;
-  input_output.tk           = tk;
-  input_output.shoc_cldfrac = cldfrac_liq;
-  input_output.shoc_ql      = qc_copy;
-
-  // Output Variables
-  output.pblh     = get_field_out("pbl_height").get_view<Real*>();
-  output.shoc_ql2 = shoc_ql2;
-  output.tkh      = get_field_out("eddy_diff_heat").get_view<Spack**>();
-
-  // Ouput (diagnostic)
-  history_output.shoc_mix  = m_buffer.shoc_mix;
-  history_output.isotropy  = m_buffer.isotropy;
-  history_output.w_sec     = get_field_out("w_variance").get_view<Spack**>();
-  history_output.thl_sec   = m_buffer.thl_sec;
-  history_output.qw_sec    = m_buffer.qw_sec;
-  history_output.qwthl_sec = m_buffer.qwthl_sec;
-  history_output.wthl_sec  = m_buffer.wthl_sec;
-  history_output.wqw_sec   = m_buffer.wqw_sec;
-  history_output.wtke_sec  = m_buffer.wtke_sec;
-  history_output.uw_sec    = m_buffer.uw_sec;
-  history_output.vw_sec    = m_buffer.vw_sec;
-  history_output.w3        = m_buffer.w3;
-  history_output.wqls_sec  = m_buffer.wqls_sec;
-  history_output.brunt     = m_buffer.brunt;
-
-#ifdef SCREAM_SMALL_KERNELS
-  temporaries.se_b = m_buffer.se_b;
-  temporaries.ke_b = m_buffer.ke_b;
-  temporaries.wv_b = m_buffer.wv_b;
-  temporaries.wl_b = m_buffer.wl_b;
-  temporaries.se_a = m_buffer.se_a;
-  temporaries.ke_a = m_buffer.ke_a;
-  temporaries.wv_a = m_buffer.wv_a;
-  temporaries.wl_a = m_buffer.wl_a;
-  temporaries.ustar = m_buffer.ustar;
-  temporaries.kbfs = m_buffer.kbfs;
-  temporaries.obklen = m_buffer.obklen;
-  temporaries.ustar2 = m_buffer.ustar2;
-  temporaries.wstar = m_buffer.wstar;
-
-  temporaries.rho_zt = m_buffer.rho_zt;
-  temporaries.shoc_qv = m_buffer.shoc_qv;
-  temporaries.tabs = m_buffer.tabs;
-  temporaries.dz_zt = m_buffer.dz_zt;
-  temporaries.dz_zi = m_buffer.dz_zi;
-#endif
-
-  shoc_postprocess.set_variables(m_num_cols,m_num_levs,m_num_tracers,
-                                 rrho,qv,qw,qc,qc_copy,tke,tke_copy,qtracers,shoc_ql2,
-                                 cldfrac_liq,inv_qc_relvar,
-                                 T_mid, dse, z_mid, phis);
-
-  if (has_column_conservation_check()) {
-    const auto& vapor_flux = get_field_out("vapor_flux").get_view<Real*>();
-    const auto& water_flux = get_field_out("water_flux").get_view<Real*>();
-    const auto& ice_flux   = get_field_out("ice_flux").get_view<Real*>();
-    const auto& heat_flux  = get_field_out("heat_flux").get_view<Real*>();
-    shoc_postprocess.set_mass_and_energy_fluxes (surf_evap, surf_sens_flux,
-                                                 vapor_flux, water_flux,
-                                                 ice_flux, heat_flux);
+    get_field_out("sgs_buoy_flux").deep_copy(0.0);
+    get_field_out("eddy_diff_mom").deep_copy(0.0);
+    get_field_out("tke").deep_copy(0.0004);
+    Kokkos::deep_copy(m_buffer.tke_copy,0.0004);
+    get_field_out("cldfrac_liq").deep_copy(0.0);
   }
 
   // Set field property checks for the fields in this process
@@ -404,7 +308,7 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   const auto nlevi_packs = ekat::npack<Spack>(m_num_levs+1);
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
   const int n_trac_slots = ekat::npack<Spack>(m_num_tracers+3)*Spack::n;
-  const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
+  const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_col_chunks.size, nlev_packs);
   workspace_mgr.setup(m_buffer.wsm_data, nlevi_packs, 14+(n_wind_slots+n_trac_slots), default_policy);
 
   // Calculate pref_mid, and use that to calculate
@@ -427,6 +331,7 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   // Compute cell length for input dx and dy.
   const auto ncols = m_num_cols;
   view_1d cell_length("cell_length", ncols);
+  m_cell_length = cell_length;
   if (m_grid->has_geometry_data("dx_short")) {
     // We must be running with IntensiveObservationPeriod on, with a planar geometry
     auto dx = m_grid->get_geometry_data("dx_short").get_view<const Real,Host>()();
@@ -441,35 +346,176 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
       cell_length(icol) = PF::calculate_dx_from_area(area(icol),lat(icol));;
     });
   }
-  input.dx = cell_length;
-  input.dy = cell_length;
+
+  // Initialize all of the structures that are passed to shoc_main in run_impl.
+  // If running in column chunks, run_impl resets them for each chunk.
+  if (m_col_chunks.num>0) {
+    set_column_chunk(0);
+  }
 }
 
 // =========================================================================================
-void SHOCMacrophysics::run_impl (const double dt)
+void SHOCMacrophysics::set_column_chunk (const int ichunk)
 {
-  EKAT_REQUIRE_MSG (dt<=300,
-      "Error! SHOC is intended to run with a timestep no longer than 5 minutes.\n"
-      "       Please, reduce timestep (perhaps increasing subcycling iterations).\n");
+  // Initialize all of the structures that are passed to shoc_main in run_impl.
+  // Note: Some variables in the structures are not stored in the field manager.  For these
+  //       variables a local view is constructed.
+  // Note: field views are restricted to the chunk columns, while buffer views,
+  //       which only store one chunk, are restricted to the first ncol entries.
+  const int beg  = m_col_chunks.beg[ichunk];
+  const int ncol = m_col_chunks.ncols(ichunk);
+  const auto cols = std::make_pair(beg,beg+ncol);
+  const auto bcols = std::make_pair(0,ncol);
+  const auto& T_mid               = chunk(get_field_out("T_mid").get_view<Spack**>(),cols);
+  const auto& p_mid               = chunk(get_field_in("p_mid").get_view<const Spack**>(),cols);
+  const auto& p_int               = chunk(get_field_in("p_int").get_view<const Spack**>(),cols);
+  const auto& pseudo_density      = chunk(get_field_in("pseudo_density").get_view<const Spack**>(),cols);
+  const auto& omega               = chunk(get_field_in("omega").get_view<const Spack**>(),cols);
+  const auto& surf_sens_flux      = chunk(get_field_in("surf_sens_flux").get_view<const Real*>(),cols);
+  const auto& surf_evap           = chunk(get_field_in("surf_evap").get_view<const Real*>(),cols);
+  const auto& surf_mom_flux       = chunk(get_field_in("surf_mom_flux").get_view<const Real**>(),cols);
+  const auto& qtracers            = chunk(get_group_out("tracers").m_bundle->get_view<Spack***>(),cols);
+  const auto& qc                  = chunk(get_field_out("qc").get_view<Spack**>(),cols);
+  const auto& qv                  = chunk(get_field_out("qv").get_view<Spack**>(),cols);
+  const auto& tke                 = chunk(get_field_out("tke").get_view<Spack**>(),cols);
+  const auto& cldfrac_liq         = chunk(get_field_out("cldfrac_liq").get_view<Spack**>(),cols);
+  const auto& cldfrac_liq_prev    = chunk(get_field_out("cldfrac_liq_prev").get_view<Spack**>(),cols);
+  const auto& sgs_buoy_flux       = chunk(get_field_out("sgs_buoy_flux").get_view<Spack**>(),cols);
+  const auto& tk                  = chunk(get_field_out("eddy_diff_mom").get_view<Spack**>(),cols);
+  const auto& inv_qc_relvar       = chunk(get_field_out("inv_qc_relvar").get_view<Spack**>(),cols);
+  const auto& phis                = chunk(get_field_in("phis").get_view<const Real*>(),cols);
 
-  const auto nlev_packs  = ekat::npack<Spack>(m_num_levs);
-  const auto scan_policy    = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(m_num_cols, nlev_packs);
-  const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
-
-  // Preprocessing of SHOC inputs. Kernel contains a parallel_scan,
-  // so a special TeamPolicy is required.
-  Kokkos::parallel_for("shoc_preprocess",
-                       scan_policy,
-                       shoc_preprocess);
-  Kokkos::fence();
+  // Alias local variables from temporary buffer
+  auto z_mid       = chunk(m_buffer.z_mid,bcols);
+  auto z_int       = chunk(m_buffer.z_int,bcols);
+  auto wpthlp_sfc  = chunk(m_buffer.wpthlp_sfc,bcols);
+  auto wprtp_sfc   = chunk(m_buffer.wprtp_sfc,bcols);
+  auto upwp_sfc    = chunk(m_buffer.upwp_sfc,bcols);
+  auto vpwp_sfc    = chunk(m_buffer.vpwp_sfc,bcols);
+  auto rrho        = chunk(m_buffer.rrho,bcols);
+  auto rrho_i      = chunk(m_buffer.rrho_i,bcols);
+  auto thv         = chunk(m_buffer.thv,bcols);
+  auto dz          = chunk(m_buffer.dz,bcols);
+  auto zt_grid     = chunk(m_buffer.zt_grid,bcols);
+  auto zi_grid     = chunk(m_buffer.zi_grid,bcols);
+  auto wtracer_sfc = chunk(m_buffer.wtracer_sfc,bcols);
+  auto wm_zt       = chunk(m_buffer.wm_zt,bcols);
+  auto inv_exner   = chunk(m_buffer.inv_exner,bcols);
+  auto thlm        = chunk(m_buffer.thlm,bcols);
+  auto qw          = chunk(m_buffer.qw,bcols);
+  auto dse         = chunk(m_buffer.dse,bcols);
+  auto tke_copy    = chunk(m_buffer.tke_copy,bcols);
+  auto qc_copy     = chunk(m_buffer.qc_copy,bcols);
+  auto shoc_ql2    = chunk(m_buffer.shoc_ql2,bcols);
 
-  if (m_params.get<bool>("apply_tms", false)) {
-    apply_turbulent_mountain_stress();
+  // For now, set z_int(i,nlevs) = z_surf = 0
+  const Real z_surf = 0.0;
+
+  shoc_preprocess.set_variables(ncol,m_num_levs,m_num_tracers,z_surf,
+                                T_mid,p_mid,p_int,pseudo_density,omega,phis,surf_sens_flux,surf_evap,
+                                surf_mom_flux,qtracers,qv,qc,qc_copy,tke,tke_copy,z_mid,z_int,
+                                dse,rrho,rrho_i,thv,dz,zt_grid,zi_grid,wpthlp_sfc,wprtp_sfc,upwp_sfc,vpwp_sfc,
+                                wtracer_sfc,wm_zt,inv_exner,thlm,qw, cldfrac_liq, cldfrac_liq_prev);
+
+  // Input Variables:
+  if (m_col_options.size()>0) {
+    runtime_options.col_options = chunk(m_col_options,cols);
   }
 
-  if (m_params.get<bool>("check_flux_state_consistency", false)) {
-    check_flux_state_consistency(dt);
+  input.zt_grid     = shoc_preprocess.zt_grid;
+  input.zi_grid     = shoc_preprocess.zi_grid;
+  input.pres        = p_mid;
+  input.presi       = p_int;
+  input.pdel        = pseudo_density;
+  input.thv         = shoc_preprocess.thv;
+  input.w_field     = shoc_preprocess.wm_zt;
+  input.wthl_sfc    = shoc_preprocess.wpthlp_sfc;
+  input.wqw_sfc     = shoc_preprocess.wprtp_sfc;
+  input.uw_sfc      = shoc_preprocess.upwp_sfc;
+  input.vw_sfc      = shoc_preprocess.vpwp_sfc;
+  input.wtracer_sfc = shoc_preprocess.wtracer_sfc;
+  input.inv_exner   = shoc_preprocess.inv_exner;
+  input.phis        = phis;
+  input.dx          = chunk(m_cell_length,cols);
+  input.dy          = input.dx;
+
+  // Input/Output Variables
+  input_output.host_dse     = shoc_preprocess.shoc_s;
+  input_output.tke          = shoc_preprocess.tke_copy;
+  input_output.thetal       = shoc_preprocess.thlm;
+  input_output.qw           = shoc_preprocess.qw;
+  input_output.horiz_wind   = chunk(get_field_out("horiz_winds").get_view<Spack***>(),cols);
+  input_output.wthv_sec     = sgs_buoy_flux;
+  input_output.qtracers     = shoc_preprocess.qtracers;
+  input_output.tk           = tk;
+  input_output.shoc_cldfrac = cldfrac_liq;
+  input_output.shoc_ql      = qc_copy;
+
+  // Output Variables
+  output.pblh     = chunk(get_field_out("pbl_height").get_view<Real*>(),cols);
+  output.shoc_ql2 = shoc_ql2;
+  output.tkh      = chunk(get_field_out("eddy_diff_heat").get_view<Spack**>(),cols);
+
+  // Ouput (diagnostic)
+  history_output.shoc_mix  = chunk(m_buffer.shoc_mix,bcols);
+  history_output.isotropy  = chunk(m_buffer.isotropy,bcols);
+  history_output.w_sec     = chunk(get_field_out("w_variance").get_view<Spack**>(),cols);
+  history_output.thl_sec   = chunk(m_buffer.thl_sec,bcols);
+  history_output.qw_sec    = chunk(m_buffer.qw_sec,bcols);
+  history_output.qwthl_sec = chunk(m_buffer.qwthl_sec,bcols);
+  history_output.wthl_sec  = chunk(m_buffer.wthl_sec,bcols);
+  history_output.wqw_sec   = chunk(m_buffer.wqw_sec,bcols);
+  history_output.wtke_sec  = chunk(m_buffer.wtke_sec,bcols);
+  history_output.uw_sec    = chunk(m_buffer.uw_sec,bcols);
+  history_output.vw_sec    = chunk(m_buffer.vw_sec,bcols);
+  history_output.w3        = chunk(m_buffer.w3,bcols);
+  history_output.wqls_sec  = chunk(m_buffer.wqls_sec,bcols);
+  history_output.brunt     = chunk(m_buffer.brunt,bcols);
+
+#ifdef SCREAM_SMALL_KERNELS
+  temporaries.se_b = chunk(m_buffer.se_b,bcols);
+  temporaries.ke_b = chunk(m_buffer.ke_b,bcols);
+  temporaries.wv_b = chunk(m_buffer.wv_b,bcols);
+  temporaries.wl_b = chunk(m_buffer.wl_b,bcols);
+  temporaries.se_a = chunk(m_buffer.se_a,bcols);
+  temporaries.ke_a = chunk(m_buffer.ke_a,bcols);
+  temporaries.wv_a = chunk(m_buffer.wv_a,bcols);
+  temporaries.wl_a = chunk(m_buffer.wl_a,bcols);
+  temporaries.ustar = chunk(m_buffer.ustar,bcols);
+  temporaries.kbfs = chunk(m_buffer.kbfs,bcols);
+  temporaries.obklen = chunk(m_buffer.obklen,bcols);
+  temporaries.ustar2 = chunk(m_buffer.ustar2,bcols);
+  temporaries.wstar = chunk(m_buffer.wstar,bcols);
+
+  temporaries.rho_zt = chunk(m_buffer.rho_zt,bcols);
+  temporaries.shoc_qv = chunk(m_buffer.shoc_qv,bcols);
+  temporaries.tabs = chunk(m_buffer.tabs,bcols);
+  temporaries.dz_zt = chunk(m_buffer.dz_zt,bcols);
+  temporaries.dz_zi = chunk(m_buffer.dz_zi,bcols);
+#endif
+
+  shoc_postprocess.set_variables(ncol,m_num_levs,m_num_tracers,
+                                 rrho,qv,qw,qc,qc_copy,tke,tke_copy,qtracers,shoc_ql2,
+                                 cldfrac_liq,inv_qc_relvar,
+                                 T_mid, dse, z_mid, phis);
+
+  if (has_column_conservation_check()) {
+    const auto& vapor_flux = chunk(get_field_out("vapor_flux").get_view<Real*>(),cols);
+    const auto& water_flux = chunk(get_field_out("water_flux").get_view<Real*>(),cols);
+    const auto& ice_flux   = chunk(get_field_out("ice_flux").get_view<Real*>(),cols);
+    const auto& heat_flux  = chunk(get_field_out("heat_flux").get_view<Real*>(),cols);
+    shoc_postprocess.set_mass_and_energy_fluxes (surf_evap, surf_sens_flux,
+                                                 vapor_flux, water_flux,
+                                                 ice_flux, heat_flux);
   }
+}
+
+// =========================================================================================
+void SHOCMacrophysics::run_impl (const double dt)
+{
+  EKAT_REQUIRE_MSG (dt<=300,
+      "Error! SHOC is intended to run with a timestep no longer than 5 minutes.\n"
+      "       Please, reduce timestep (perhaps increasing subcycling iterations).\n");
 
   // For now set the host timestep to the shoc timestep. This forces
   // number of SHOC timesteps (nadv) to be 1.
@@ -477,22 +523,63 @@ void SHOCMacrophysics::run_impl (const double dt)
   hdtime = dt;
   m_nadv = std::max(static_cast<int>(round(hdtime/dt)),1);
 
-  // Reset internal WSM variables.
-  workspace_mgr.reset_internals();
+  // Update the per-column runtime options, since their input fields may have changed
+  if (m_col_options.size()>0) {
+    const auto& names = runtime_options_names();
+    for (int k=0; k<SHF::SHOCRuntime::num_options; ++k) {
+      auto col_option = Kokkos::subview(m_col_options,Kokkos::ALL(),k);
+      if (ekat::contains(m_col_options_names,names[k])) {
+        Kokkos::deep_copy(col_option,get_field_in("shoc_"+names[k]).get_view<const Real*>());
+      } else {
+        Kokkos::deep_copy(col_option,static_cast<Real>(m_params.get<double>(names[k])));
+      }
+    }
+  }
+
+  // Run SHOC one column chunk at a time. Local views and workspace only store
+  // one chunk, so they are reused across chunks.
+  const auto nlev_packs  = ekat::npack<Spack>(m_num_levs);
+  for (int ic=0; ic<m_col_chunks.num; ++ic) {
+    const int ncol = m_col_chunks.ncols(ic);
+    if (m_col_chunks.num>1) {
+      set_column_chunk(ic);
+    }
+
+    const auto scan_policy    = ekat::ExeSpaceUtils<KT::ExeSpace>::get_thread_range_parallel_scan_team_policy(ncol, nlev_packs);
+    const auto default_policy = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(ncol, nlev_packs);
 
-  // Run shoc main
-  SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
-                 workspace_mgr,runtime_options,input,input_output,output,history_output
+    // Preprocessing of SHOC inputs. Kernel contains a parallel_scan,
+    // so a special TeamPolicy is required.
+    Kokkos::parallel_for("shoc_preprocess",
+                         scan_policy,
+                         shoc_preprocess);
+    Kokkos::fence();
+
+    if (m_params.get<bool>("apply_tms", false)) {
+      apply_turbulent_mountain_stress(ic);
+    }
+
+    if (m_params.get<bool>("check_flux_state_consistency", false)) {
+      check_flux_state_consistency(dt,ic);
+    }
+
+    // Reset internal WSM variables.
+    workspace_mgr.reset_internals();
+
+    // Run shoc main
+    SHF::shoc_main(ncol, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
+                   workspace_mgr,runtime_options,input,input_output,output,history_output
 #ifdef SCREAM_SMALL_KERNELS
-                 , temporaries
+                   , temporaries
 #endif
-                 );
+                   );
 
-  // Postprocessing of SHOC outputs
-  Kokkos::parallel_for("shoc_postprocess",
-                       default_policy,
-                       shoc_postprocess);
-  Kokkos::fence();
+    // Postprocessing of SHOC outputs
+    Kokkos::parallel_for("shoc_postprocess",
+                         default_policy,
+                         shoc_postprocess);
+    Kokkos::fence();
+  }
 }
 // =========================================================================================
 void SHOCMacrophysics::finalize_impl()
@@ -500,10 +587,14 @@ void SHOCMacrophysics::finalize_impl()
   // Do nothing
 }
 // =========================================================================================
-void SHOCMacrophysics::apply_turbulent_mountain_stress()
+void SHOCMacrophysics::apply_turbulent_mountain_stress(const int ichunk)
 {
-  auto surf_drag_coeff_tms = get_field_in("surf_drag_coeff_tms").get_view<const Real*>();
-  auto horiz_winds         = get_field_in("horiz_winds").get_view<const Spack***>();
+  const int beg  = m_col_chunks.beg[ichunk];
+  const int ncol = m_col_chunks.ncols(ichunk);
+  const auto cols = std::make_pair(beg,beg+ncol);
+
+  auto surf_drag_coeff_tms = chunk(get_field_in("surf_drag_coeff_tms").get_view<const Real*>(),cols);
+  auto horiz_winds         = chunk(get_field_in("horiz_winds").get_view<const Spack***>(),cols);
 
   auto rrho_i   = m_buffer.rrho_i;
   auto upwp_sfc = m_buffer.upwp_sfc;
@@ -514,27 +605,31 @@ void SHOCMacrophysics::apply_turbulent_mountain_stress()
   const int nlevi_v = m_num_levs/Spack::n;
   const int nlevi_p = m_num_levs%Spack::n;
 
-  Kokkos::parallel_for("apply_tms", KT::RangePolicy(0, m_num_cols), KOKKOS_LAMBDA (const int i) {
+  Kokkos::parallel_for("apply_tms", KT::RangePolicy(0, ncol), KOKKOS_LAMBDA (const int i) {
     upwp_sfc(i) -= surf_drag_coeff_tms(i)*horiz_winds(i,0,nlev_v)[nlev_p]/rrho_i(i,nlevi_v)[nlevi_p];
     vpwp_sfc(i) -= surf_drag_coeff_tms(i)*horiz_winds(i,1,nlev_v)[nlev_p]/rrho_i(i,nlevi_v)[nlevi_p];
   });
 }
 // =========================================================================================
-void SHOCMacrophysics::check_flux_state_consistency(const double dt)
+void SHOCMacrophysics::check_flux_state_consistency(const double dt, const int ichunk)
 {
   using PC = scream::physics::Constants<Real>;
   const Real gravit = PC::gravit;
   const Real qmin   = 1e-12; // minimum permitted constituent concentration (kg/kg)
 
-  const auto& pseudo_density = get_field_in ("pseudo_density").get_view<const Spack**>();
-  const auto& surf_evap      = get_field_out("surf_evap").get_view<Real*>();
-  const auto& qv             = get_field_out("qv").get_view<Spack**>();
+  const int beg  = m_col_chunks.beg[ichunk];
+  const int ncol = m_col_chunks.ncols(ichunk);
+  const auto cols = std::make_pair(beg,beg+ncol);
+
+  const auto& pseudo_density = chunk(get_field_in ("pseudo_density").get_view<const Spack**>(),cols);
+  const auto& surf_evap      = chunk(get_field_out("surf_evap").get_view<Real*>(),cols);
+  const auto& qv             = chunk(get_field_out("qv").get_view<Spack**>(),cols);
 
   const auto nlevs           = m_num_levs;
   const auto nlev_packs      = ekat::npack<Spack>(nlevs);
   const auto last_pack_idx   = (nlevs-1)/Spack::n;
   const auto last_pack_entry = (nlevs-1)%Spack::n;
-  const auto policy          = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
+  const auto policy          = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(ncol, nlev_packs);
   Kokkos::parallel_for("check_flux_state_consistency",
                        policy,
                        KOKKOS_LAMBDA (const KT::MemberType& team) {
@@ -2,6 +2,7 @@
 #define SCREAM_SHOC_MACROPHYSICS_HPP
 
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/util/eamxx_column_chunks.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "physics/shoc/shoc_functions.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
@@ -472,11 +473,11 @@ protected:
 
   void initialize_impl (const RunType run_type);
 
-  // Update flux (if necessary)
-  void check_flux_state_consistency(const double dt);
+  // Update flux (if necessary) for the given column chunk
+  void check_flux_state_consistency(const double dt, const int ichunk);
 
-  // Apply TMS drag coeff to shoc_main inputs (if necessary)
-  void apply_turbulent_mountain_stress ();
+  // Apply TMS drag coeff to shoc_main inputs (if necessary) for the given column chunk
+  void apply_turbulent_mountain_stress (const int ichunk);
 
 protected:
 
@@ -493,6 +494,9 @@ protected:
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager &buffer_manager);
 
+  // Point the shoc_main structures to the fields/buffers of the given column chunk
+  void set_column_chunk (const int ichunk);
+
   // Keep track of field dimensions and other scalar values
   // needed in shoc_main
   Int m_num_cols;
@@ -502,6 +506,13 @@ protected:
   Int m_num_tracers;
   Int hdtime;
 
+  // SHOC can run on chunks of columns, so that local views and workspace
+  // are sized by the chunk size, rather than by the number of local columns
+  ColumnChunks m_col_chunks;
+
+  // Cell length (for all local columns), used for input dx/dy
+  view_1d m_cell_length;
+
   // Struct which contains local variables
   Buffer m_buffer;
 
@@ -511,6 +522,12 @@ protected:
   SHF::SHOCOutput output;
   SHF::SHOCHistoryOutput history_output;
   SHF::SHOCRuntime runtime_options;
+
+  // Runtime options that vary across columns (e.g., across ensemble members), which
+  // are read from the input fields "shoc_<option>", and the per-column values of
+  // all the runtime options (only allocated if some option varies across columns)
+  std::vector<std::string> m_col_options_names;
+  sview_2d m_col_options;
 #ifdef SCREAM_SMALL_KERNELS
   SHF::SHOCTemporaries temporaries;
 #endif
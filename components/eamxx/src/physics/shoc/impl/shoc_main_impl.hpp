@@ -612,11 +612,30 @@ Int Functions<S,D>::shoc_main(
   // SHOC main loop
   const auto nlev_packs = ekat::npack<Spack>(nlev);
   const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+  const auto col_options = shoc_runtime.col_options;
+  const bool per_col_options = col_options.size()>0;
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
 
     auto workspace = workspace_mgr.get_workspace(team);
 
+    // Runtime options of this column
+    auto option = [&](const int k, const Scalar val) {
+      return per_col_options ? col_options(i,k) : val;
+    };
+    const Scalar lambda_low_s     = option(0,lambda_low);
+    const Scalar lambda_high_s    = option(1,lambda_high);
+    const Scalar lambda_slope_s   = option(2,lambda_slope);
+    const Scalar lambda_thresh_s  = option(3,lambda_thresh);
+    const Scalar thl2tune_s       = option(4,thl2tune);
+    const Scalar qw2tune_s        = option(5,qw2tune);
+    const Scalar qwthl2tune_s     = option(6,qwthl2tune);
+    const Scalar w2tune_s         = option(7,w2tune);
+    const Scalar length_fac_s     = option(8,length_fac);
+    const Scalar c_diag_3rd_mom_s = option(9,c_diag_3rd_mom);
+    const Scalar Ckh_s            = option(10,Ckh);
+    const Scalar Ckm_s            = option(11,Ckm);
+
     const Scalar dx_s{shoc_input.dx(i)};
     const Scalar dy_s{shoc_input.dy(i)};
     const Scalar wthl_sfc_s{shoc_input.wthl_sfc(i)};
@@ -665,9 +684,9 @@ Int Functions<S,D>::shoc_main(
     const auto qtracers_s = Kokkos::subview(shoc_input_output.qtracers, i, Kokkos::ALL(), Kokkos::ALL());
 
     shoc_main_internal(team, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
-	               lambda_low, lambda_high, lambda_slope, lambda_thresh,  // Runtime options
-                       thl2tune, qw2tune, qwthl2tune, w2tune, length_fac,     // Runtime options
-                       c_diag_3rd_mom, Ckh, Ckm,                              // Runtime options
+                       lambda_low_s, lambda_high_s, lambda_slope_s,           // Runtime options
+                       lambda_thresh_s, thl2tune_s, qw2tune_s, qwthl2tune_s,  // Runtime options
+                       w2tune_s, length_fac_s, c_diag_3rd_mom_s, Ckh_s, Ckm_s,// Runtime options
                        dx_s, dy_s, zt_grid_s, zi_grid_s,                      // Input
                        pres_s, presi_s, pdel_s, thv_s, w_field_s,             // Input
                        wthl_sfc_s, wqw_sfc_s, uw_sfc_s, vw_sfc_s,             // Input
@@ -85,6 +85,12 @@ struct Functions
    Scalar c_diag_3rd_mom;
    Scalar Ckh;
    Scalar Ckm;
+
+   // Optional per-column values of the options above, with one row per column,
+   // and one entry per option (in the order above). If empty, all columns use
+   // the scalar values. Not supported with small kernels.
+   static constexpr int num_options = 12;
+   view_2d<const Scalar> col_options;
  };
 
   // This struct stores input views for shoc_main.
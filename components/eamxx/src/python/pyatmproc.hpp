@@ -87,8 +87,11 @@ struct PyAtmProc {
   void initialize (const std::string& t0_str) {
     int nbytes = ap->requested_buffer_size_in_bytes ();
     buffer.request_bytes(nbytes);
+    int slot = 0;
+    ap->request_scratch_fields(buffer,slot);
     buffer.allocate();
     ap->init_buffers(buffer);
+    ap->init_scratch_fields(buffer);
 
     time = t0 = util::str_to_time_stamp(t0_str);
     for (auto it : fields) {
@@ -148,11 +151,19 @@ struct PyAtmProc {
     output_mgr->set_logger(ap->get_logger());
   }
 
-  void run (double dt) {
-    ap->run(dt);
-    time += dt;
-    if (output_mgr) {
-      output_mgr->run(time);
+  // Run nsteps steps without returning to python in between. Field arrays
+  // obtained via get/buffer protocol/DLPack alias the fields data, so they
+  // need not be re-fetched after this call.
+  void run (double dt, int nsteps) {
+    // We don't touch any python object in here, so let other python threads go.
+    // Processes that call into python (e.g., MLCorrection) re-acquire the GIL.
+    pybind11::gil_scoped_release no_gil;
+    for (int n=0; n<nsteps; ++n) {
+      ap->run(dt);
+      time += dt;
+      if (output_mgr) {
+        output_mgr->run(time);
+      }
     }
   }
 };
@@ -165,7 +176,7 @@ inline void pybind_pyatmproc(pybind11::module& m)
     .def("get_field",&PyAtmProc::get_field)
     .def("initialize",&PyAtmProc::initialize)
     .def("setup_output",&PyAtmProc::setup_output)
-    .def("run",&PyAtmProc::run)
+    .def("run",&PyAtmProc::run,pybind11::arg("dt"),pybind11::arg("nsteps")=1)
     .def("read_ic",&PyAtmProc::read_ic);
 }
 } // namespace scream
@@ -0,0 +1,79 @@
+#ifndef PYDLPACK_HPP
+#define PYDLPACK_HPP
+
+#include <pybind11/pybind11.h>
+
+#include <cstdint>
+
+namespace scream {
+
+// Minimal subset of the DLPack C ABI (https://dmlc.github.io/dlpack), to exchange
+// tensors with other python libraries (numpy, cupy, pytorch, jax,...) without copies.
+// Layouts and enum values must match dlpack.h, which we don't want to depend on.
+namespace dlpack {
+
+enum DLDeviceType : int32_t {
+  kDLCPU  = 1,
+  kDLCUDA = 2,
+  kDLROCM = 10,
+};
+
+enum DLDataTypeCode : uint8_t {
+  kDLInt   = 0,
+  kDLUInt  = 1,
+  kDLFloat = 2,
+};
+
+struct DLDevice {
+  DLDeviceType device_type;
+  int32_t      device_id;
+};
+
+struct DLDataType {
+  uint8_t  code;
+  uint8_t  bits;
+  uint16_t lanes;
+};
+
+struct DLTensor {
+  void*       data;
+  DLDevice    device;
+  int32_t     ndim;
+  DLDataType  dtype;
+  int64_t*    shape;
+  int64_t*    strides; // In number of entries, not bytes
+  uint64_t    byte_offset;
+};
+
+struct DLManagedTensor {
+  DLTensor dl_tensor;
+  void*    manager_ctx;
+  void   (*deleter)(DLManagedTensor* self);
+};
+
+// Wrap a managed tensor in a "dltensor" capsule. Per the DLPack python
+// protocol, the consumer renames the capsule to "used_dltensor" once it takes
+// ownership of the tensor. If that never happens, we call the deleter here.
+inline pybind11::capsule make_capsule (DLManagedTensor* t)
+{
+  auto destructor = [](PyObject* capsule) {
+    if (PyCapsule_IsValid(capsule,"dltensor")) {
+      auto t = static_cast<DLManagedTensor*>(PyCapsule_GetPointer(capsule,"dltensor"));
+      if (t!=nullptr and t->deleter!=nullptr) {
+        t->deleter(t);
+      }
+    }
+  };
+  auto capsule = PyCapsule_New(t,"dltensor",destructor);
+  if (capsule==nullptr) {
+    t->deleter(t);
+    throw pybind11::error_already_set();
+  }
+  return pybind11::reinterpret_steal<pybind11::capsule>(capsule);
+}
+
+} // namespace dlpack
+
+} // namespace scream
+
+#endif // PYDLPACK_HPP
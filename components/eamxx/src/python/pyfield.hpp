@@ -4,6 +4,8 @@
 #include "share/field/field.hpp"
 #include "share/field/field_utils.hpp"
 
+#include "pydlpack.hpp"
+
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 #include <pybind11/stl.h>
@@ -24,37 +26,45 @@ struct PyField {
     f.allocate_view();
   }
 
-  pybind11::array get () const {
-    const auto& fh  = f.get_header();
-    const auto& fid = fh.get_identifier();
+  // Create a standalone nondimensional field with the given dims, with the last
+  // dim padded to a multiple of pack_size (e.g., to test the python arrays strides)
+  PyField(const std::string& name,
+          const std::vector<int>& dims,
+          const int pack_size = 1)
+  {
+    using namespace ShortFieldTagsNames;
+    const int rank = dims.size();
+    EKAT_REQUIRE_MSG (rank>0,
+        "Error! Cannot create a field with no dimensions.\n"
+        "  - field name: " + name + "\n");
+    std::vector<FieldTag> tags (rank,CMP);
+    std::vector<std::string> names;
+    tags.back() = LEV;
+    for (int i=0; i<rank; ++i) {
+      names.push_back("dim" + std::to_string(i));
+    }
+    FieldIdentifier fid (name,FieldLayout(tags,dims,names),ekat::units::Units::nondimensional(),"");
+    f = Field(fid);
+    f.get_header().get_alloc_properties().request_allocation(pack_size);
+    f.allocate_view();
+  }
 
-    // Can this actually happen? For now, no, since we only create fields from identifiers, so each PyField
-    // holds separate memory. However, this may change if we allow subfields.
-    EKAT_REQUIRE_MSG (f.get_header().get_parent().lock()==nullptr,
-        "Error! Cannot get the array for a field that is a subfield of another. Please, get array of parent field.\n"
-        "  - field name : " + fid.name() + "\n"
-        "  - parent name: " + fh.get_parent().lock()->get_identifier().name() + "\n");
+  // A read-only alias of this field
+  PyField get_const () const {
+    PyField cf;
+    cf.f = f.get_const();
+    return cf;
+  }
 
-    // Get array shape and strides.
-    // NOTE: since the field may be padded, the strides do not necessarily
-    //       match the dims. Also, the strides must be grabbed from the
-    //       actual view, since the layout doesn't know them.
-    pybind11::array::ShapeContainer shape (fid.get_layout().dims());
-    std::vector<ssize_t> strides;
-
-    pybind11::dtype dt;
-    switch (fid.data_type()) {
-      case DataType::IntType:
-        dt = get_dt_and_set_strides<int>(strides);
-        break;
-      case DataType::FloatType:
-        dt = get_dt_and_set_strides<float>(strides);
-        break;
-      case DataType::DoubleType:
-        dt = get_dt_and_set_strides<double>(strides);
-        break;
-      default:
-        EKAT_ERROR_MSG ("Unrecognized/unsupported data type.\n");
+  // Numpy array aliasing the field host view
+  pybind11::array get () const {
+    check_not_subfield();
+
+    const auto dt = get_dtype();
+    pybind11::array::ShapeContainer shape (f.get_header().get_identifier().get_layout().dims());
+    std::vector<ssize_t> strides = get_strides();
+    for (auto& s : strides) {
+      s *= dt.itemsize();
     }
 
     // NOTE: you MUST set the parent handle, or else you won't have view semantic
@@ -63,6 +73,88 @@ struct PyField {
     return pybind11::array(dt,shape,strides,data,pybind11::handle(this_obj));
   }
 
+  // Buffer protocol, exposing the field host view
+  pybind11::buffer_info get_buffer_info () const {
+    check_not_subfield();
+
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    const auto dt = get_dtype();
+    std::vector<ssize_t> shape (fl.dims().begin(),fl.dims().end());
+    std::vector<ssize_t> strides = get_strides();
+    for (auto& s : strides) {
+      s *= dt.itemsize();
+    }
+
+    std::string format;
+    switch (f.data_type()) {
+      case DataType::IntType:    format = pybind11::format_descriptor<int>::format();    break;
+      case DataType::FloatType:  format = pybind11::format_descriptor<float>::format();  break;
+      case DataType::DoubleType: format = pybind11::format_descriptor<double>::format(); break;
+      default:
+        EKAT_ERROR_MSG ("Unrecognized/unsupported data type.\n");
+    }
+
+    auto data = f.get_internal_view_data_unsafe<void,Host>();
+    return pybind11::buffer_info(data,dt.itemsize(),format,fl.rank(),shape,strides,f.is_read_only());
+  }
+
+  // DLPack protocol, exposing the field device view. Consumers (cupy, pytorch, ...)
+  // get a tensor aliasing the field data, so no copy is needed to read/write the
+  // field on device. On CPU builds, numpy.from_dlpack works too.
+  // NOTE: we fence before returning, so the tensor can be used on any stream.
+  // NOTE: DLPack tensors (pre v1.0) have no read-only flag, so we refuse to export
+  //       read-only fields, since consumers could write into them.
+  pybind11::capsule dlpack (const pybind11::kwargs& /* stream, max_version, ... */) const {
+    check_not_subfield();
+    EKAT_REQUIRE_MSG (not f.is_read_only(),
+        "Error! Cannot export a read-only field via DLPack, since the tensor would be writable.\n"
+        "  Use the buffer protocol (e.g., numpy.asarray(field)) to get a read-only host array.\n"
+        "  - field name: " + f.name() + "\n");
+
+    struct Context {
+      Field f; // Keeps the allocation alive as long as the consumer uses it
+      std::vector<int64_t> shape;
+      std::vector<int64_t> strides;
+      dlpack::DLManagedTensor tensor;
+    };
+
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    auto ctx = new Context();
+    ctx->f = f;
+    ctx->shape.assign(fl.dims().begin(),fl.dims().end());
+    for (auto s : get_strides()) {
+      ctx->strides.push_back(s);
+    }
+
+    auto& t = ctx->tensor.dl_tensor;
+    t.data = f.get_internal_view_data_unsafe<void,Device>();
+    t.device = get_dl_device();
+    t.ndim = fl.rank();
+    t.shape = ctx->shape.data();
+    t.strides = ctx->strides.data();
+    t.byte_offset = 0;
+    switch (f.data_type()) {
+      case DataType::IntType:    t.dtype = {dlpack::kDLInt,  8*sizeof(int),   1}; break;
+      case DataType::FloatType:  t.dtype = {dlpack::kDLFloat,8*sizeof(float), 1}; break;
+      case DataType::DoubleType: t.dtype = {dlpack::kDLFloat,8*sizeof(double),1}; break;
+      default:
+        delete ctx;
+        EKAT_ERROR_MSG ("Unrecognized/unsupported data type.\n");
+    }
+    ctx->tensor.manager_ctx = ctx;
+    ctx->tensor.deleter = [](dlpack::DLManagedTensor* self) {
+      delete static_cast<Context*>(self->manager_ctx);
+    };
+
+    Kokkos::fence();
+    return dlpack::make_capsule(&ctx->tensor);
+  }
+
+  pybind11::tuple dlpack_device () const {
+    const auto dev = get_dl_device();
+    return pybind11::make_tuple(static_cast<int>(dev.device_type),dev.device_id);
+  }
+
   void sync_to_host () {
     f.sync_to_host();
   }
@@ -74,49 +166,99 @@ struct PyField {
   }
 private:
 
+  void check_not_subfield () const {
+    const auto& fh  = f.get_header();
+
+    // Can this actually happen? For now, no, since we only create fields from identifiers, so each PyField
+    // holds separate memory. However, this may change if we allow subfields.
+    EKAT_REQUIRE_MSG (fh.get_parent().lock()==nullptr,
+        "Error! Cannot get the array for a field that is a subfield of another. Please, get array of parent field.\n"
+        "  - field name : " + f.name() + "\n"
+        "  - parent name: " + fh.get_parent().lock()->get_identifier().name() + "\n");
+  }
+
+  pybind11::dtype get_dtype () const {
+    switch (f.data_type()) {
+      case DataType::IntType:    return pybind11::dtype::of<int>();
+      case DataType::FloatType:  return pybind11::dtype::of<float>();
+      case DataType::DoubleType: return pybind11::dtype::of<double>();
+      default:
+        EKAT_ERROR_MSG ("Unrecognized/unsupported data type.\n");
+    }
+  }
+
+  static dlpack::DLDevice get_dl_device () {
+    using MemSpace = typename DefaultDevice::memory_space;
+    if (std::is_same<MemSpace,Kokkos::HostSpace>::value) {
+      return {dlpack::kDLCPU,0};
+    }
+#if defined(KOKKOS_ENABLE_CUDA)
+    return {dlpack::kDLCUDA,Kokkos::Cuda().cuda_device()};
+#elif defined(KOKKOS_ENABLE_HIP)
+    return {dlpack::kDLROCM,Kokkos::HIP().hip_device()};
+#else
+    EKAT_ERROR_MSG ("Error! DLPack export is not supported for this device.\n");
+#endif
+  }
+
+  // Strides of the field views (in number of entries).
+  // NOTE: since the field may be padded, the strides do not necessarily
+  //       match the dims. Also, the strides must be grabbed from the
+  //       actual view, since the layout doesn't know them.
+  //       Host and device views have the same layout, hence the same strides.
+  std::vector<ssize_t> get_strides () const {
+    switch (f.data_type()) {
+      case DataType::IntType:    return get_strides_impl<int>();
+      case DataType::FloatType:  return get_strides_impl<float>();
+      case DataType::DoubleType: return get_strides_impl<double>();
+      default:
+        EKAT_ERROR_MSG ("Unrecognized/unsupported data type.\n");
+    }
+  }
+
   template<typename T>
-  pybind11::dtype get_dt_and_set_strides (std::vector<ssize_t>& strides) const
+  std::vector<ssize_t> get_strides_impl () const
   {
-    strides.resize(f.rank());
+    std::vector<ssize_t> strides(f.rank());
     switch (f.rank()) {
       case 1:
       {
         auto v = f.get_view<const T*,Host>();
-        strides[0] = v.stride(0)*sizeof(T);
+        strides[0] = v.stride(0);
         break;
       }
       case 2:
       {
         auto v = f.get_view<const T**,Host>();
-        strides[0] = v.stride(0)*sizeof(T);
-        strides[1] = v.stride(1)*sizeof(T);
+        strides[0] = v.stride(0);
+        strides[1] = v.stride(1);
         break;
       }
       case 3:
       {
         auto v = f.get_view<const T***,Host>();
-        strides[0] = v.stride(0)*sizeof(T);
-        strides[1] = v.stride(1)*sizeof(T);
-        strides[2] = v.stride(2)*sizeof(T);
+        strides[0] = v.stride(0);
+        strides[1] = v.stride(1);
+        strides[2] = v.stride(2);
         break;
       }
       case 4:
       {
         auto v = f.get_view<const T****,Host>();
-        strides[0] = v.stride(0)*sizeof(T);
-        strides[1] = v.stride(1)*sizeof(T);
-        strides[2] = v.stride(2)*sizeof(T);
-        strides[3] = v.stride(3)*sizeof(T);
+        strides[0] = v.stride(0);
+        strides[1] = v.stride(1);
+        strides[2] = v.stride(2);
+        strides[3] = v.stride(3);
         break;
       }
       case 5:
       {
         auto v = f.get_view<const T*****,Host>();
-        strides[0] = v.stride(0)*sizeof(T);
-        strides[1] = v.stride(1)*sizeof(T);
-        strides[2] = v.stride(2)*sizeof(T);
-        strides[3] = v.stride(3)*sizeof(T);
-        strides[4] = v.stride(4)*sizeof(T);
+        strides[0] = v.stride(0);
+        strides[1] = v.stride(1);
+        strides[2] = v.stride(2);
+        strides[3] = v.stride(3);
+        strides[4] = v.stride(4);
         break;
       }
       default:
@@ -126,15 +268,21 @@ private:
             " - field rnak: " + std::to_string(f.rank()) + "\n");
     }
 
-    return pybind11::dtype::of<T>();
+    return strides;
   }
 };
 
 inline void pybind_pyfield (pybind11::module& m) {
   // Field class
-  pybind11::class_<PyField>(m,"Field")
+  pybind11::class_<PyField>(m,"Field",pybind11::buffer_protocol())
     .def(pybind11::init<>())
+    .def(pybind11::init<const std::string&,const std::vector<int>&,int>(),
+         pybind11::arg("name"),pybind11::arg("dims"),pybind11::arg("pack_size")=1)
     .def("get",&PyField::get)
+    .def("get_const",&PyField::get_const)
+    .def_buffer(&PyField::get_buffer_info)
+    .def("__dlpack__",&PyField::dlpack)
+    .def("__dlpack_device__",&PyField::dlpack_device)
     .def("sync_to_host",&PyField::sync_to_host)
     .def("sync_to_dev",&PyField::sync_to_dev)
     .def("print",&PyField::print);
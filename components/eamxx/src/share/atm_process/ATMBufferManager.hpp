@@ -4,15 +4,29 @@
 #include "share/scream_types.hpp"
 #include "ekat/ekat_assert.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <string>
+#include <vector>
+
 namespace scream {
 
 // Struct which allows for the allocation of a single
 // memory buffer for all ATM processes.
+// Besides the buffer shared by all processes (see request_bytes), it is
+// possible to request memory blocks with a lifetime, expressed as a range
+// of "slots", that is, positions of atm procs in the sequence of run calls
+// within an atm time step. At allocation time, blocks are packed in an
+// arena after the shared buffer, so that blocks with non-overlapping
+// lifetimes can use the same memory.
 struct ATMBufferManager {
 
   template <typename S>
   using view_1d = typename KokkosTypes<DefaultDevice>::template view_1d<S>;
 
+  // A block whose lifetime lasts until the end of the atm time step
+  static constexpr int end_of_step = std::numeric_limits<int>::max();
+
   ATMBufferManager()
   {
     m_size      = 0;
@@ -28,19 +42,83 @@ struct ATMBufferManager {
   void request_bytes (const size_t num_bytes) {
     ekat::error::runtime_check(num_bytes%sizeof(Real)==0,
                                "Error! Must request number of bytes which is divisible by sizeof(Real).\n");
+    ekat::error::runtime_check(!m_allocated, "Error! Cannot request bytes after 'allocate' was called.\n");
 
     const size_t num_reals = num_bytes/sizeof(Real);
     m_size = std::max(num_reals, m_size);
   }
 
+  // Request a block of memory that is only used during the slots [first_slot,last_slot].
+  // Returns the id of the block, to be used to retrieve the memory after allocation.
+  int request_block (const std::string& name, const size_t num_bytes,
+                     const int first_slot, const int last_slot) {
+    EKAT_REQUIRE_MSG (num_bytes%sizeof(Real)==0,
+        "Error! Must request number of bytes which is divisible by sizeof(Real).\n"
+        "  - block name: " + name + "\n");
+    EKAT_REQUIRE_MSG (first_slot>=0 and first_slot<=last_slot,
+        "Error! Invalid lifetime for memory block.\n"
+        "  - block name: " + name + "\n"
+        "  - first slot: " + std::to_string(first_slot) + "\n"
+        "  - last slot : " + std::to_string(last_slot) + "\n");
+    EKAT_REQUIRE_MSG (not m_allocated,
+        "Error! Cannot request memory blocks after 'allocate' was called.\n"
+        "  - block name: " + name + "\n");
+
+    // Pad blocks to a multiple of the pack size, so that all blocks are pack-aligned
+    const size_t num_reals = num_bytes/sizeof(Real);
+    const size_t padded = (num_reals + SCREAM_PACK_SIZE - 1) / SCREAM_PACK_SIZE * SCREAM_PACK_SIZE;
+    m_blocks.push_back(Block{name,padded,first_slot,last_slot,0});
+    return m_blocks.size()-1;
+  }
+
+  // Extend the lifetime of the blocks with id>=first_block, so that it covers
+  // at least the slots [first_slot,last_slot]. This is needed when a sequence
+  // of slots is run multiple times within an atm time step (e.g., a subcycled
+  // group of atm procs), since a block must then survive the slots of the
+  // sequence that come before or after its own.
+  void extend_blocks_lifetime (const int first_block, const int first_slot, const int last_slot) {
+    EKAT_REQUIRE_MSG (not m_allocated,
+        "Error! Cannot modify memory blocks after 'allocate' was called.\n");
+    for (size_t i=first_block; i<m_blocks.size(); ++i) {
+      auto& b = m_blocks[i];
+      b.first_slot = std::min(b.first_slot,first_slot);
+      b.last_slot  = std::max(b.last_slot,last_slot);
+    }
+  }
+
+  int num_blocks () const { return m_blocks.size(); }
+
   Real* get_memory () const { return m_buffer.data(); }
 
-  size_t allocated_bytes () const { return m_size*sizeof(Real); }
+  Real* get_block_memory (const int block_id) const {
+    EKAT_REQUIRE_MSG (m_allocated,
+        "Error! Cannot retrieve memory blocks before 'allocate' is called.\n");
+    EKAT_REQUIRE_MSG (block_id>=0 and block_id<static_cast<int>(m_blocks.size()),
+        "Error! Invalid memory block id: " + std::to_string(block_id) + "\n");
+    return m_buffer.data() + m_arena_offset + m_blocks[block_id].offset;
+  }
+
+  size_t allocated_bytes () const { return (m_arena_offset+m_arena_size)*sizeof(Real); }
+
+  // Bytes needed by the blocks if each block had its own memory, and
+  // bytes actually used by the blocks in the arena.
+  size_t blocks_naive_bytes () const {
+    size_t n = 0;
+    for (const auto& b : m_blocks) {
+      n += b.size;
+    }
+    return n*sizeof(Real);
+  }
+  size_t blocks_packed_bytes () const { return m_arena_size*sizeof(Real); }
 
   void allocate () {
     ekat::error::runtime_check(!m_allocated, "Error! Cannot call 'allocate' more than once.\n");
 
-    m_buffer = view_1d<Real>("",m_size);
+    // The arena starts after the shared buffer (pack-aligned)
+    m_arena_offset = (m_size + SCREAM_PACK_SIZE - 1) / SCREAM_PACK_SIZE * SCREAM_PACK_SIZE;
+    pack_blocks ();
+
+    m_buffer = view_1d<Real>("",m_arena_offset+m_arena_size);
     m_allocated = true;
   }
 
@@ -48,9 +126,61 @@ struct ATMBufferManager {
 
 protected:
 
-  view_1d<Real> m_buffer;
-  size_t        m_size;
-  bool          m_allocated;
+  struct Block {
+    std::string name;
+    size_t      size;   // In number of Reals
+    int         first_slot;
+    int         last_slot;
+    size_t      offset; // In number of Reals, from the start of the arena
+  };
+
+  // Assign an offset to each block, so that blocks with overlapping lifetimes
+  // do not overlap in memory. Blocks are placed from the largest to the smallest,
+  // each at the lowest offset that fits among the (already placed) blocks
+  // whose lifetime overlaps with it.
+  void pack_blocks () {
+    std::vector<int> order (m_blocks.size());
+    for (size_t i=0; i<order.size(); ++i) {
+      order[i] = i;
+    }
+    std::stable_sort(order.begin(),order.end(),[&](const int i, const int j) {
+      return m_blocks[i].size>m_blocks[j].size;
+    });
+
+    m_arena_size = 0;
+    std::vector<const Block*> placed, live;
+    for (int i : order) {
+      auto& b = m_blocks[i];
+      live.clear();
+      for (auto p : placed) {
+        if (p->first_slot<=b.last_slot and b.first_slot<=p->last_slot) {
+          live.push_back(p);
+        }
+      }
+      std::sort(live.begin(),live.end(),[](const Block* l, const Block* r) {
+        return l->offset<r->offset;
+      });
+
+      size_t offset = 0;
+      for (auto p : live) {
+        if (offset+b.size<=p->offset) {
+          break;
+        }
+        offset = std::max(offset,p->offset+p->size);
+      }
+      b.offset = offset;
+      m_arena_size = std::max(m_arena_size,offset+b.size);
+      placed.push_back(&b);
+    }
+  }
+
+  view_1d<Real>       m_buffer;
+  size_t              m_size;
+  bool                m_allocated;
+
+  std::vector<Block>  m_blocks;
+  size_t              m_arena_offset = 0;
+  size_t              m_arena_size   = 0;
 };
 
 } // scream
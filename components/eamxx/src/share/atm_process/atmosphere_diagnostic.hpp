@@ -25,6 +25,11 @@ namespace scream
  *    A diagnostic output is meant to be used for OUTPUT or a PROPERTY CHECK.
  */
 
+// Data that diagnostics can share with each other (e.g., quantities that several
+// diagnostics need), owned by whoever creates the diagnostics. Each diagnostic
+// type is responsible for the keys it uses, and for the actual type of the data.
+using DiagnosticsSharedData = std::map<std::string,std::shared_ptr<void>>;
+
 // TODO: inheriting from AtmosphereProcess is conceptually wrong. It was done
 //       out of convenience, but we should revisit that choice.
 
@@ -56,6 +61,10 @@ public:
   virtual void init_timestep (const util::TimeStamp& /* start_of_step */) {}
 
   void compute_diagnostic (const double dt = 0);
+
+  // Set the storage for data that can be shared with other diagnostics.
+  // Must be called before initialize. If not set, nothing is shared.
+  void set_shared_data (const std::shared_ptr<DiagnosticsSharedData>& data) { m_shared_data = data; }
 protected:
 
   void set_required_field_impl (const Field& f) final;
@@ -75,6 +84,9 @@ protected:
 
   // Diagnostics are meant to return a field
   Field m_diagnostic_output;
+
+  // Data shared with other diagnostics (may be null)
+  std::shared_ptr<DiagnosticsSharedData> m_shared_data;
 };
 
 // A short name for the factory for atmosphere diagnostics
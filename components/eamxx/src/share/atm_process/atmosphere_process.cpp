@@ -74,11 +74,11 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
   m_time_stamp = t0;
   initialize_impl(run_type);
 
-  // Create all start-of-step fields needed for tendencies calculation
+  // Get all start-of-step fields needed for tendencies calculation
   for (const auto& it : m_proc_tendencies) {
     const auto& tname = it.first;
     const auto& fname = m_tend_to_field.at(tname);
-    m_start_of_step_fields[fname] = get_field_out(fname).clone();
+    m_start_of_step_fields[fname] = get_scratch_field(fname + "_start_of_step");
   }
 
   if (this->type()!=AtmosphereProcessType::Group) {
@@ -243,6 +243,12 @@ void AtmosphereProcess::setup_tendencies_requests () {
         // Create tend FID and request field
         FieldIdentifier t_fid(tname,layout,units,gname,dtype);
         add_field<Computed>(t_fid,strlist_t{"ACCUMULATED","DIVIDE_BY_DT"});
+
+        // The start-of-step copy of the field is only needed within a run call,
+        // so it can share memory with the scratch fields of other atm procs
+        if (grid_found=="") {
+          add_scratch_field(fid.alias(fn + "_start_of_step"),ScratchLifetime::RunCall);
+        }
         grid_found = gname;
       }
     }
@@ -610,6 +616,101 @@ void AtmosphereProcess::add_internal_field (const Field& f) {
   m_internal_fields.push_back(f);
 }
 
+void AtmosphereProcess::
+add_scratch_field (const FieldIdentifier& fid, const ScratchLifetime lifetime,
+                   const int pack_size)
+{
+  EKAT_REQUIRE_MSG (m_scratch_fields.count(fid.name())==0,
+      "Error! Scratch field was already added.\n"
+      "  - atm proc name: " + this->name() + "\n"
+      "  - field name   : " + fid.name() + "\n");
+  EKAT_REQUIRE_MSG (fid.data_type()==get_data_type<Real>(),
+      "Error! Scratch fields must have Real data type.\n"
+      "  - atm proc name: " + this->name() + "\n"
+      "  - field name   : " + fid.name() + "\n");
+
+  // The field is not allocated, but we can already commit the alloc props,
+  // so that we know how much memory it needs
+  Field f(fid);
+  auto& ap = f.get_header().get_alloc_properties();
+  ap.request_allocation(pack_size);
+  ap.commit(fid.get_layout());
+  m_scratch_fields[fid.name()] = ScratchField{f,lifetime,-1};
+}
+
+Field& AtmosphereProcess::get_scratch_field (const std::string& name)
+{
+  EKAT_REQUIRE_MSG (m_scratch_fields.count(name)==1,
+      "Error! Scratch field not found.\n"
+      "  - atm proc name: " + this->name() + "\n"
+      "  - field name   : " + name + "\n");
+  auto& f = m_scratch_fields.at(name).field;
+  EKAT_REQUIRE_MSG (f.is_allocated(),
+      "Error! Scratch field was not yet initialized.\n"
+      "  - atm proc name: " + this->name() + "\n"
+      "  - field name   : " + name + "\n");
+  return f;
+}
+
+void AtmosphereProcess::
+request_scratch_fields (ATMBufferManager& buffer_manager, int& slot)
+{
+  request_own_scratch_fields(buffer_manager,slot,slot);
+  ++slot;
+}
+
+void AtmosphereProcess::
+request_own_scratch_fields (ATMBufferManager& buffer_manager,
+                            const int first_slot, const int last_slot)
+{
+  for (auto& it : m_scratch_fields) {
+    auto& sf = it.second;
+    const auto& ap = sf.field.get_header().get_alloc_properties();
+    const int last = sf.lifetime==ScratchLifetime::RunCall ? last_slot : ATMBufferManager::end_of_step;
+    sf.block_id = buffer_manager.request_block(name() + "::" + it.first,ap.get_alloc_size(),first_slot,last);
+  }
+}
+
+void AtmosphereProcess::
+init_scratch_fields (const ATMBufferManager& buffer_manager)
+{
+  using KT = KokkosTypes<DefaultDevice>;
+
+  for (auto& it : m_scratch_fields) {
+    auto& sf = it.second;
+    const auto& fid = sf.field.get_header().get_identifier();
+    const auto& fl  = fid.get_layout();
+    const auto& ap  = sf.field.get_header().get_alloc_properties();
+
+    // Build an unmanaged view (with padded last extent) on the block memory,
+    // and let the Field constructor take care of the rest
+    auto data = buffer_manager.get_block_memory(sf.block_id);
+    std::vector<int> dims = fl.dims();
+    if (dims.size()>0) {
+      dims.back() = ap.get_last_extent();
+    }
+    switch (fl.rank()) {
+      case 1:
+        sf.field = Field(fid,ekat::Unmanaged<KT::view_ND<Real,1>>(data,dims[0]));
+        break;
+      case 2:
+        sf.field = Field(fid,ekat::Unmanaged<KT::view_ND<Real,2>>(data,dims[0],dims[1]));
+        break;
+      case 3:
+        sf.field = Field(fid,ekat::Unmanaged<KT::view_ND<Real,3>>(data,dims[0],dims[1],dims[2]));
+        break;
+      case 4:
+        sf.field = Field(fid,ekat::Unmanaged<KT::view_ND<Real,4>>(data,dims[0],dims[1],dims[2],dims[3]));
+        break;
+      default:
+        EKAT_ERROR_MSG ("Error! Unsupported rank for scratch field.\n"
+            "  - atm proc name: " + this->name() + "\n"
+            "  - field name   : " + it.first + "\n"
+            "  - field rank   : " + std::to_string(fl.rank()) + "\n");
+    }
+  }
+}
+
 const Field& AtmosphereProcess::
 get_field_in(const std::string& field_name, const std::string& grid_name) const {
   return get_field_in_impl(field_name,grid_name);
@@ -213,6 +213,14 @@ public:
         "   - Atm proc name: " + this->name() + "\n");
   }
 
+  // Request to the ATMBufferManager the memory for the scratch fields of this
+  // atm proc. The slot is the position of this atm proc in the sequence of
+  // run calls within an atm time step, and it is incremented on exit.
+  virtual void request_scratch_fields (ATMBufferManager& buffer_manager, int& slot);
+
+  // Create the scratch fields, using memory provided by the ATMBufferManager
+  virtual void init_scratch_fields (const ATMBufferManager& buffer_manager);
+
   // Convenience function to retrieve input/output fields from the field/group (and grid) name.
   // Note: the version without grid name only works if there is only one copy of the field/group.
   //       In that case, the single copy is returned, regardless of the associated grid name.
@@ -438,6 +446,22 @@ protected:
   // Adds a field to the list of internal fields
   void add_internal_field (const Field& f);
 
+  // Declare a scratch field, whose memory is provided by the ATMBufferManager
+  // (see ATMBufferManager::request_block). Scratch fields with non-overlapping
+  // lifetimes (possibly of different atm procs) can share the same memory, so their
+  // content must not be assumed to survive beyond their lifetime.
+  // Note: must be called before request_scratch_fields (e.g., in set_grids), while
+  //       the field can only be retrieved after init_scratch_fields.
+  void add_scratch_field (const FieldIdentifier& fid, const ScratchLifetime lifetime,
+                          const int pack_size = 1);
+  Field& get_scratch_field (const std::string& name);
+
+  // Request the memory for the scratch fields of this atm proc (but not of
+  // the atm procs it contains, if any), with RunCall fields alive during the
+  // slots [first_slot,last_slot].
+  void request_own_scratch_fields (ATMBufferManager& buffer_manager,
+                                   const int first_slot, const int last_slot);
+
   // These methods set up an extra pointer in the m_[fields|groups]_[in|out]_pointers,
   // for convenience of use (e.g., use a short name for a field/group).
   // Note: these methods do *not* create a copy of the field/group. Also, notice that
@@ -527,6 +551,14 @@ private:
   std::list<Field>        m_fields_out;
   std::list<Field>        m_internal_fields;
 
+  // Scratch fields, along with their lifetime and memory block id in the ATMBufferManager
+  struct ScratchField {
+    Field           field;
+    ScratchLifetime lifetime;
+    int             block_id;
+  };
+  strmap_t<ScratchField>  m_scratch_fields;
+
   // Data structures necessary to compute tendencies of updated fields
   strmap_t<std::string>    m_tend_to_field;
   strmap_t<Field>          m_proc_tendencies;
@@ -6,6 +6,7 @@
 #include "ekat/std_meta/ekat_std_utils.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 
+#include <algorithm>
 #include <memory>
 
 namespace scream {
@@ -681,4 +682,31 @@ init_buffers(const ATMBufferManager& buffer_manager) {
   }
 }
 
+void AtmosphereProcessGroup::
+request_scratch_fields (ATMBufferManager& buffer_manager, int& slot) {
+  const int first_block = buffer_manager.num_blocks();
+  const int first_slot  = slot;
+  for (auto& atm_proc : m_atm_processes) {
+    atm_proc->request_scratch_fields(buffer_manager,slot);
+  }
+
+  // If the group is subcycled, each process runs again after the following ones
+  // have run, so its scratch fields must be alive for the whole group.
+  // Note: Step blocks already last until the end of the step.
+  if (get_num_subcycles()>1 and slot>first_slot) {
+    buffer_manager.extend_blocks_lifetime(first_block,first_slot,slot-1);
+  }
+
+  // The group own scratch fields (e.g., for tendencies) span the whole group
+  request_own_scratch_fields(buffer_manager,first_slot,std::max(first_slot,slot-1));
+}
+
+void AtmosphereProcessGroup::
+init_scratch_fields (const ATMBufferManager& buffer_manager) {
+  AtmosphereProcess::init_scratch_fields(buffer_manager);
+  for (auto& atm_proc : m_atm_processes) {
+    atm_proc->init_scratch_fields(buffer_manager);
+  }
+}
+
 } // namespace scream
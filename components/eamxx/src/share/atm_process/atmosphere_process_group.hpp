@@ -75,6 +75,10 @@ public:
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager& buffer_manager);
 
+  // Request/create scratch fields for all the stored processes
+  void request_scratch_fields (ATMBufferManager& buffer_manager, int& slot);
+  void init_scratch_fields (const ATMBufferManager& buffer_manager);
+
   // The APG class needs to perform special checks before establishing whether
   // a required group/field is indeed a required group for this APG
   void set_required_field (const Field& field);
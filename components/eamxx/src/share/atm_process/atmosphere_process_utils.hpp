@@ -43,6 +43,14 @@ enum class ScheduleType {
   Parallel
 };
 
+// Lifetime of the content of a scratch field (see AtmosphereProcess::add_scratch_field):
+//  - RunCall: only valid within a single call to run (including all its subcycles).
+//  - Step: valid from the run call until the end of the atm time step
+enum class ScratchLifetime {
+  RunCall,
+  Step
+};
+
 // Enum used for disinguishing between pre/postcondition
 // property checks for output.
 enum PropertyCheckCategory {
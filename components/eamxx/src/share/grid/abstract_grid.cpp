@@ -1,10 +1,12 @@
 #include "share/grid/abstract_grid.hpp"
 
 #include "share/field/field_utils.hpp"
+#include "share/util/scream_utils.hpp"
 
 #include <ekat/ekat_assert.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <string>
 
@@ -117,62 +119,20 @@ AbstractGrid::get_3d_tensor_layout (const bool midpoints, const std::vector<int>
 
 bool AbstractGrid::is_unique () const {
   auto compute_is_unique = [&]() {
-    // Get a copy of gids on host. CAREFUL: do not use the stored dofs,
-    // since we need to sort dofs in order to call unique, and we don't
-    // want to alter the order of gids in this grid.
-    auto dofs = m_dofs_gids.clone();
-    auto dofs_h = dofs.get_view<gid_type*,Host>();
-
-    std::sort(dofs_h.data(),dofs_h.data()+m_num_local_dofs);
-    auto unique_end = std::unique(dofs_h.data(),dofs_h.data()+m_num_local_dofs);
-
-    int locally_unique = unique_end==(dofs_h.data()+m_num_local_dofs);
-    int unique;
-    m_comm.all_reduce(&locally_unique,&unique,1,MPI_PROD);
-    if (unique==0) {
-      return false;
-    }
-
-    // Each rank has unique gids locally. Now it's time to verify if they are also globally unique.
-    int max_dofs;
-    m_comm.all_reduce(&m_num_local_dofs,&max_dofs,1,MPI_MAX);
-    std::vector<gid_type> gids(max_dofs,-1);
-    int unique_gids = 1;
-
-    for (int pid=0; pid<m_comm.size(); ++pid) {
-      // Rank pid broadcasts its gids, everyone else checks if there are duplicates
-      if (pid==m_comm.rank()) {
-        auto start = dofs_h.data();
-        auto end   = start + m_num_local_dofs;
-        std::copy(start,end,gids.data());
-      }
-
-      int ndofs = m_num_local_dofs;
-      m_comm.broadcast(&ndofs,1,pid);
-      m_comm.broadcast(gids.data(),ndofs,pid);
-
-      int my_unique_gids = 1;
-      if (pid!=m_comm.rank()) {
-        // Checking two sorted arrays of length m and n for elements in common is O(m+n) ops.
-        int i=0, j=0;
-        while (i<m_num_local_dofs && j<ndofs && my_unique_gids==1) {
-          if (dofs_h[i]<gids[j]) {
-            ++i;
-          } else if (dofs_h[i]>gids[j]) {
-            ++j;
-          } else {
-            // Found a match. We can stop here
-            my_unique_gids = 0;
-            break;
-          }
-        }
-      }
-      m_comm.all_reduce(&my_unique_gids,&unique_gids,1,MPI_PROD);
-      if (unique_gids==0) {
+    // The directory stores all the copies of each gid (including copies
+    // on the same rank), so each home rank can check its own gids.
+    build_gid_directory();
+
+    int locally_unique = 1;
+    for (const auto& it : m_gid_directory) {
+      if (it.second.size()>1) {
+        locally_unique = 0;
         break;
       }
     }
-    return unique_gids==1;
+    int unique;
+    m_comm.all_reduce(&locally_unique,&unique,1,MPI_PROD);
+    return unique==1;
   };
 
   if (not m_is_unique_computed) {
@@ -262,6 +222,8 @@ AbstractGrid::get_dofs_gids () const {
 
 Field
 AbstractGrid::get_dofs_gids () {
+  // The caller may modify the gids, so drop whatever we computed from them
+  reset_gid_directory();
   return m_dofs_gids;
 }
 
@@ -364,35 +326,15 @@ void AbstractGrid::reset_num_vertical_lev (const int num_vertical_lev) {
 std::vector<AbstractGrid::gid_type>
 AbstractGrid::get_unique_gids () const
 {
-  // Gather local sizes across all ranks
-  std::vector<int> ngids (m_comm.size());
-  ngids[m_comm.rank()] = get_num_local_dofs();
-  m_comm.all_gather(ngids.data(),1);
-
-  std::vector<int> offsets (m_comm.size()+1,0);
-  for (int pid=1; pid<=m_comm.size(); ++pid) {
-    offsets[pid] = offsets[pid-1] + ngids[pid-1];
-  }
-  EKAT_REQUIRE_MSG (offsets[m_comm.size()]==m_num_global_dofs,
-      "Error! Something went wrong while computing offsets in AbstractGrid::get_unique_grid.\n");
-
-  // Gather all dofs
-  const auto mpi_gid_t = ekat::get_mpi_type<gid_type>();
-  std::vector<gid_type> all_gids (m_num_global_dofs);
+  // A gid is kept by the lowest rank that has a copy of it
   auto dofs_gids_h = m_dofs_gids.get_view<const gid_type*,Host>();
-  MPI_Allgatherv (dofs_gids_h.data(),m_num_local_dofs,mpi_gid_t,
-                  all_gids.data(),ngids.data(),offsets.data(),
-                  mpi_gid_t,m_comm.mpi_comm());
+  std::vector<int> pids, lids, ncopies;
+  query_gid_directory(dofs_gids_h,pids,lids,ncopies);
 
-  // Figure out unique dofs
   std::vector<gid_type> unique_dofs;
-  const auto all_gids_beg = all_gids.begin();
-  const auto all_gids_end = all_gids.begin() + offsets[m_comm.rank()];
-  const auto my_gids_beg = dofs_gids_h.data();
-  const auto my_gids_end = dofs_gids_h.data() + m_num_local_dofs;
-  for (auto it=my_gids_beg; it!=my_gids_end; ++it) {
-    if (std::find(all_gids_beg,all_gids_end,*it)==all_gids_end) {
-      unique_dofs.push_back(*it);
+  for (int i=0; i<m_num_local_dofs; ++i) {
+    if (pids[i]==m_comm.rank()) {
+      unique_dofs.push_back(dofs_gids_h[i]);
     }
   }
 
@@ -402,133 +344,132 @@ AbstractGrid::get_unique_gids () const
 std::vector<int> AbstractGrid::
 get_owners (const gid_view_h& gids) const
 {
-  const auto& comm = get_comm();
+  std::vector<int> pids, lids;
+  get_remote_pids_and_lids(gids,pids,lids);
+  return pids;
+}
 
-  // Init owners to in
-  std::map<gid_type,int> owners;
+void AbstractGrid::
+get_remote_pids_and_lids (const gid_view_h& gids,
+                          std::vector<int>& pids,
+                          std::vector<int>& lids) const
+{
+  const auto& comm = get_comm();
   int num_gids_in = gids.size();
-  for (int i=0; i<num_gids_in; ++i) {
-    owners[gids[i]] = -1;
-  }
-  int num_found = 0;
 
-  // Let each rank bcast its owned gids, so that other procs can
-  // check against their input list
-  // Note: we can't use a view of const, since the view ptr needs to be passed
-  //       to MPI bcast routines, which expect pointer to nonconst. It's an
-  //       innocuous issue though, since only the send rank will use the ptr
-  //       from the view, and it's not writing in it.
-  auto my_gids_h = m_dofs_gids.get_view<gid_type*,Host>();
-  gid_type* data;
-  std::vector<gid_type> pid_gids;
-  for (int pid=0; pid<comm.size(); ++pid) {
-    // Bcast gids count for this pid
-    int num_gids_pid = my_gids_h.size();
-    comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==comm.rank()) {
-      data = my_gids_h.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of the input pids is in this list
-    for (int i=0; i<num_gids_pid && num_found<num_gids_in; ++i) {
-      auto it = owners.find(data[i]);
-      if (it!=owners.end()) {
-        EKAT_REQUIRE_MSG (it->second==-1,
-            "Error! Found a GID with multiple owners.\n"
-            "  - owner 1: " + std::to_string(it->second) + "\n"
-            "  - owner 2: " + std::to_string(pid) + "\n");
-        it->second = pid;
-        ++num_found;
-      }
-    }
+  std::vector<int> ncopies;
+  query_gid_directory(gids,pids,lids,ncopies);
+
+  int num_found = 0;
+  for (int i=0; i<num_gids_in; ++i) {
+    EKAT_REQUIRE_MSG (ncopies[i]<=1,
+        "Error! Found a GID with multiple owners.\n"
+        "  - gid: " + std::to_string(gids[i]) + "\n"
+        "  - owner 1: " + std::to_string(pids[i]) + "\n"
+        "  - num owners: " + std::to_string(ncopies[i]) + "\n");
+    num_found += ncopies[i];
   }
-  EKAT_REQUIRE_MSG (num_found==static_cast<int>(owners.size()),
+  EKAT_REQUIRE_MSG (num_found==num_gids_in,
       "Error! Could not locate the owner of one of the input GIDs.\n"
       "  - rank: " + std::to_string(comm.rank()) + "\n"
       "  - num found: " + std::to_string(num_found) + "\n"
       "  - num gids in: " + std::to_string(num_gids_in) + "\n");
+}
 
+int AbstractGrid::gid_home_rank (const gid_type gid) const
+{
+  // Fibonacci hashing: spreads contiguous as well as strided ranges
+  // of gids evenly across ranks.
+  const std::uint64_t h = static_cast<std::uint64_t>(gid)*11400714819323198485ull;
+  return static_cast<int>((h >> 32) % static_cast<std::uint64_t>(m_comm.size()));
+}
 
-  // Now create and fill output view
-  std::vector<int> result(num_gids_in);
-  for (int i=0; i<num_gids_in; ++i) {
-    result[i] = owners.at(gids[i]);
+void AbstractGrid::reset_gid_directory ()
+{
+  m_gid_directory.clear();
+  m_gid_directory_built = false;
+  m_is_unique_computed = false;
+}
+
+void AbstractGrid::build_gid_directory () const
+{
+  if (m_gid_directory_built) {
+    return;
   }
 
-  return result;
+  // Send (gid,lid) of each local dof to the gid home rank
+  auto dofs_gids_h = m_dofs_gids.get_view<const gid_type*,Host>();
+  std::vector<std::vector<gid_type>> send(m_comm.size());
+  for (int i=0; i<m_num_local_dofs; ++i) {
+    auto& s = send[gid_home_rank(dofs_gids_h[i])];
+    s.push_back(dofs_gids_h[i]);
+    s.push_back(i);
+  }
+  std::vector<int> offsets;
+  const auto recv = all_to_all_v(send,offsets,m_comm);
+
+  // Since we process ranks in order, the copies of each gid are sorted by pid
+  m_gid_directory.clear();
+  for (int pid=0; pid<m_comm.size(); ++pid) {
+    for (int k=offsets[pid]; k<offsets[pid+1]; k+=2) {
+      m_gid_directory[recv[k]].emplace_back(pid,recv[k+1]);
+    }
+  }
+  m_gid_directory_built = true;
 }
 
 void AbstractGrid::
-get_remote_pids_and_lids (const gid_view_h& gids,
-                          std::vector<int>& pids,
-                          std::vector<int>& lids) const
+query_gid_directory (const gid_view_h& gids,
+                     std::vector<int>& pids,
+                     std::vector<int>& lids,
+                     std::vector<int>& ncopies) const
 {
-  const auto& comm = get_comm();
-  int num_gids_in = gids.size();
-
-  pids.resize(num_gids_in,-1);
-  lids.resize(num_gids_in,-1);
+  build_gid_directory();
 
-  int num_found = 0;
+  const int nranks = m_comm.size();
+  const int num_gids_in = gids.size();
 
-  // We may have repeated gids. In that case, we want to update
-  // the pids/lids arrays at all indices corresponding to the same gid
-  std::map<gid_type,std::vector<int>> gid2idx;
+  // Send the queries to the gids home ranks, keeping track of where each
+  // query went, so we can match the replies (which come back in the same order)
+  std::vector<std::vector<gid_type>> queries(nranks);
+  std::vector<std::vector<int>> query_idx(nranks);
   for (int i=0; i<num_gids_in; ++i) {
-    gid2idx[gids[i]].push_back(i);
+    const int home = gid_home_rank(gids[i]);
+    queries[home].push_back(gids[i]);
+    query_idx[home].push_back(i);
   }
-  int num_unique_gids = gid2idx.size();
-
-  // Let each rank bcast its owned gids, so that other procs can
-  // check against their input list
-  // Note: we can't use a view of const, since the view ptr needs to be passed
-  //       to MPI bcast routines, which expect pointer to nonconst. It's an
-  //       innocuous issue though, since only the send rank will use the ptr
-  //       from the view, and it's not writing in it.
-  auto my_gids_h = m_dofs_gids.get_view<gid_type*,Host>();
-  gid_type* data;
-  std::vector<gid_type> pid_gids;
-  for (int pid=0; pid<comm.size(); ++pid) {
-    // Bcast gids count for this pid
-    int num_gids_pid = my_gids_h.size();
-    comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==comm.rank()) {
-      data = my_gids_h.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of the input pids is in this list
-    for (int i=0; i<num_gids_pid; ++i) {
-      auto it = gid2idx.find(data[i]);
-      if (it!=gid2idx.end()) {
-        for (auto idx : it->second) {
-          EKAT_REQUIRE_MSG (pids[idx]==-1,
-              "Error! Found a GID with multiple owners.\n"
-              "  - owner 1: " + std::to_string(pids[idx]) + "\n"
-              "  - owner 2: " + std::to_string(pid) + "\n");
-          pids[idx] = pid;
-          lids[idx] = i;
-        }
-        ++num_found;
+  std::vector<int> offsets;
+  const auto recv_queries = all_to_all_v(queries,offsets,m_comm);
+
+  // Reply with (pid,lid,ncopies) for each query
+  std::vector<std::vector<int>> replies(nranks);
+  for (int pid=0; pid<nranks; ++pid) {
+    auto& r = replies[pid];
+    r.reserve(3*(offsets[pid+1]-offsets[pid]));
+    for (int k=offsets[pid]; k<offsets[pid+1]; ++k) {
+      auto it = m_gid_directory.find(recv_queries[k]);
+      if (it==m_gid_directory.end()) {
+        r.insert(r.end(),{-1,-1,0});
+      } else {
+        const auto& copies = it->second;
+        r.insert(r.end(),{copies[0].first,copies[0].second,static_cast<int>(copies.size())});
       }
     }
   }
-  EKAT_REQUIRE_MSG (num_found==num_unique_gids,
-      "Error! Could not locate the owner of one of the input GIDs.\n"
-      "  - rank: " + std::to_string(comm.rank()) + "\n"
-      "  - num found: " + std::to_string(num_found) + "\n"
-      "  - num unique gids in: " + std::to_string(num_unique_gids) + "\n");
+  const auto recv_replies = all_to_all_v(replies,offsets,m_comm);
+
+  pids.assign(num_gids_in,-1);
+  lids.assign(num_gids_in,-1);
+  ncopies.assign(num_gids_in,0);
+  for (int home=0; home<nranks; ++home) {
+    const auto& idx = query_idx[home];
+    for (size_t k=0; k<idx.size(); ++k) {
+      const int pos = offsets[home] + 3*k;
+      pids[idx[k]]    = recv_replies[pos];
+      lids[idx[k]]    = recv_replies[pos+1];
+      ncopies[idx[k]] = recv_replies[pos+2];
+    }
+  }
 }
 
 void AbstractGrid::create_dof_fields (const int scalar2d_layout_rank)
@@ -587,6 +528,8 @@ void AbstractGrid::copy_data (const AbstractGrid& src, const bool shallow)
   m_global_min_dof_gid = src.m_global_min_dof_gid;
   m_is_unique = src.m_is_unique;
   m_is_unique_computed = src.m_is_unique_computed;
+  m_gid_directory = src.m_gid_directory;
+  m_gid_directory_built = src.m_gid_directory_built;
 }
 
 } // namespace scream
@@ -11,6 +11,8 @@
 #include <map>
 #include <list>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace scream
 {
@@ -119,9 +121,17 @@ public:
   gid_type get_global_max_partitioned_dim_gid () const;
 
   // Get a Field storing 1d data (the dof gids)
+  // NOTE: the non-const getter drops the cached gid directory (see reset_gid_directory).
+  //       If the gids are modified after a later owners/uniqueness query, all
+  //       ranks must call reset_gid_directory before the next query.
   Field get_dofs_gids () const;
   Field get_dofs_gids ();
 
+  // Drop the cached gid directory (and uniqueness), so that they are recomputed
+  // at the next query. Since the directory is built collectively, all ranks
+  // of the grid comm must drop it, or none.
+  void reset_gid_directory ();
+
   // Get Field storing the gids that this process owns along the partitioned dim
   // NOTE: for some grids, this is the same as get_dofs_gids. The SEGrid is a counterexample:
   //       the dofs are the GLL dofs, but the partitioned dim is the element dimension
@@ -211,6 +221,22 @@ protected:
 
   void copy_data (const AbstractGrid& src, const bool shallow = true);
 
+  // A distributed directory of the dofs gids: each gid is assigned a home rank
+  // (via a hash of the gid), which stores the (pid,lid) of all the copies of
+  // that gid across the grid comm, sorted by pid. This allows to locate gids
+  // with O(1) all-to-all-v rounds, rather than having each rank bcast its gids.
+  // The directory is built (collectively) at the first query, and then cached.
+  int gid_home_rank (const gid_type gid) const;
+  void build_gid_directory () const;
+
+  // For each input gid, retrieve (pid,lid) of its first copy (i.e., the one on
+  // the lowest rank), as well as the number of copies. If ncopies[i]==0, the
+  // gid was not found, and pids[i]=lids[i]=-1. This method is collective.
+  void query_gid_directory (const gid_view_h& gids,
+                            std::vector<int>& pids,
+                            std::vector<int>& lids,
+                            std::vector<int>& ncopies) const;
+
   // Note: this method must be called from the derived classes,
   //       since it calls get_2d_scalar_layout.
   void create_dof_fields (const int scalar2d_layout_rank);
@@ -250,6 +276,10 @@ protected:
   // The map lid->idx
   Field     m_lid_to_idx;
 
+  // The gids directory entries for the gids whose home is this rank
+  mutable std::unordered_map<gid_type,std::vector<std::pair<int,int>>> m_gid_directory;
+  mutable bool m_gid_directory_built = false;
+
   mutable std::map<std::string,Field>  m_geo_fields;
 
   // The MPI comm containing the ranks across which the global mesh is partitioned
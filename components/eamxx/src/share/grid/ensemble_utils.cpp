@@ -0,0 +1,252 @@
+#include "share/grid/ensemble_utils.hpp"
+
+#include "share/grid/point_grid.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+namespace scream
+{
+
+namespace impl {
+
+// Copy the member columns from/to the ensemble field. The copy runs over
+// the member columns times the entries of each column.
+template<bool ToEnsemble>
+void copy_member_columns (const Field& ens, const Field& mem, const int col_offset)
+{
+  using namespace ShortFieldTagsNames;
+  using RangePolicy = typename KokkosTypes<DefaultDevice>::RangePolicy;
+  using EnsRT = std::conditional_t<ToEnsemble,Real,const Real>;
+  using MemRT = std::conditional_t<ToEnsemble,const Real,Real>;
+
+  const auto& ens_fl = ens.get_header().get_identifier().get_layout();
+  const auto& mem_fl = mem.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (ens_fl.rank()>=1 and ens_fl.tag(0)==COL and mem_fl.tag(0)==COL and
+                    ens_fl.clone().strip_dim(0).congruent(mem_fl.clone().strip_dim(0)) and
+                    col_offset+mem_fl.dim(0)<=ens_fl.dim(0),
+      "Error! Incompatible ensemble and member fields.\n"
+      "  - ensemble field: " + ens.name() + ", layout: " + ens_fl.to_string() + "\n"
+      "  - member field  : " + mem.name() + ", layout: " + mem_fl.to_string() + "\n");
+  EKAT_REQUIRE_MSG (ens.data_type()==get_data_type<Real>() and mem.data_type()==get_data_type<Real>(),
+      "Error! Ensemble copies are only supported for Real fields.\n"
+      "  - ensemble field: " + ens.name() + "\n");
+
+  const int ncols = mem_fl.dim(0);
+  switch (ens_fl.rank()) {
+    case 1:
+    {
+      auto e = ens.get_strided_view<EnsRT*>();
+      auto m = mem.get_strided_view<MemRT*>();
+      Kokkos::parallel_for(RangePolicy(0,ncols),KOKKOS_LAMBDA(const int icol) {
+        if constexpr (ToEnsemble) {
+          e(col_offset+icol) = m(icol);
+        } else {
+          m(icol) = e(col_offset+icol);
+        }
+      });
+      break;
+    }
+    case 2:
+    {
+      auto e = ens.get_strided_view<EnsRT**>();
+      auto m = mem.get_strided_view<MemRT**>();
+      const int d1 = ens_fl.dim(1);
+      Kokkos::parallel_for(RangePolicy(0,ncols*d1),KOKKOS_LAMBDA(const int idx) {
+        const int icol = idx / d1;
+        const int j    = idx % d1;
+        if constexpr (ToEnsemble) {
+          e(col_offset+icol,j) = m(icol,j);
+        } else {
+          m(icol,j) = e(col_offset+icol,j);
+        }
+      });
+      break;
+    }
+    case 3:
+    {
+      auto e = ens.get_strided_view<EnsRT***>();
+      auto m = mem.get_strided_view<MemRT***>();
+      const int d1 = ens_fl.dim(1);
+      const int d2 = ens_fl.dim(2);
+      Kokkos::parallel_for(RangePolicy(0,ncols*d1*d2),KOKKOS_LAMBDA(const int idx) {
+        const int icol = idx / (d1*d2);
+        const int j    = (idx / d2) % d1;
+        const int k    = idx % d2;
+        if constexpr (ToEnsemble) {
+          e(col_offset+icol,j,k) = m(icol,j,k);
+        } else {
+          m(icol,j,k) = e(col_offset+icol,j,k);
+        }
+      });
+      break;
+    }
+    case 4:
+    {
+      auto e = ens.get_strided_view<EnsRT****>();
+      auto m = mem.get_strided_view<MemRT****>();
+      const int d1 = ens_fl.dim(1);
+      const int d2 = ens_fl.dim(2);
+      const int d3 = ens_fl.dim(3);
+      Kokkos::parallel_for(RangePolicy(0,ncols*d1*d2*d3),KOKKOS_LAMBDA(const int idx) {
+        const int icol = idx / (d1*d2*d3);
+        const int j    = (idx / (d2*d3)) % d1;
+        const int k    = (idx / d3) % d2;
+        const int l    = idx % d3;
+        if constexpr (ToEnsemble) {
+          e(col_offset+icol,j,k,l) = m(icol,j,k,l);
+        } else {
+          m(icol,j,k,l) = e(col_offset+icol,j,k,l);
+        }
+      });
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Error! Unsupported field rank for ensemble copies.\n"
+          "  - field name: " + ens.name() + "\n"
+          "  - field rank: " + std::to_string(ens_fl.rank()) + "\n");
+  }
+  Kokkos::fence();
+}
+
+} // namespace impl
+
+std::shared_ptr<AbstractGrid>
+create_ensemble_grid (const std::shared_ptr<const AbstractGrid>& member_grid,
+                      const int nmembers)
+{
+  using gid_type = AbstractGrid::gid_type;
+  using namespace ShortFieldTagsNames;
+
+  EKAT_REQUIRE_MSG (member_grid->type()==GridType::Point,
+      "Error! Ensemble grids can only be built from point grids.\n"
+      "  - grid name: " + member_grid->name() + "\n");
+  EKAT_REQUIRE_MSG (nmembers>=1,
+      "Error! Invalid number of ensemble members: " + std::to_string(nmembers) + "\n");
+
+  const int nlcols = member_grid->get_num_local_dofs();
+  const int ngcols = member_grid->get_num_global_dofs();
+  auto grid = std::make_shared<PointGrid>(member_grid->name(),nmembers*nlcols,
+                                          member_grid->get_num_vertical_levels(),
+                                          member_grid->get_comm());
+  grid->setSelfPointer(grid);
+  grid->m_short_name = member_grid->m_short_name;
+
+  const auto mem_gids = member_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto dofs_gids = grid->get_dofs_gids();
+  auto gids = dofs_gids.get_view<gid_type*,Host>();
+  for (int m=0; m<nmembers; ++m) {
+    for (int icol=0; icol<nlcols; ++icol) {
+      gids(m*nlcols+icol) = m*ngcols + mem_gids(icol);
+    }
+  }
+  dofs_gids.sync_to_dev();
+
+  // Replicate the member geometry data
+  for (const auto& name : member_grid->get_geometry_data_names()) {
+    const auto src = member_grid->get_geometry_data(name);
+    const auto& fid = src.get_header().get_identifier();
+    auto layout = fid.get_layout().clone();
+    const bool has_cols = layout.rank()>0 and layout.tag(0)==COL;
+    if (has_cols) {
+      layout.reset_dim(0,nmembers*nlcols);
+    }
+    auto tgt = grid->create_geometry_data(FieldIdentifier(name,layout,fid.get_units(),
+                                                          grid->name(),fid.data_type()));
+    if (has_cols) {
+      for (int m=0; m<nmembers; ++m) {
+        copy_to_ensemble(src,tgt,nmembers,m);
+      }
+    } else {
+      tgt.deep_copy(src);
+    }
+    tgt.sync_to_host();
+  }
+
+  return grid;
+}
+
+std::shared_ptr<AbstractGrid>
+create_ensemble_member_grid (const std::shared_ptr<const AbstractGrid>& ensemble_grid,
+                             const int nmembers, const int member)
+{
+  using gid_type = AbstractGrid::gid_type;
+  using namespace ShortFieldTagsNames;
+
+  const int nlcols = ensemble_grid->get_num_local_dofs() / nmembers;
+  const int ngcols = ensemble_grid->get_num_global_dofs() / nmembers;
+  EKAT_REQUIRE_MSG (member>=0 and member<nmembers and
+                    nlcols*nmembers==ensemble_grid->get_num_local_dofs(),
+      "Error! Invalid ensemble member or number of members.\n"
+      "  - grid name: " + ensemble_grid->name() + "\n"
+      "  - num members: " + std::to_string(nmembers) + "\n"
+      "  - member: " + std::to_string(member) + "\n");
+
+  auto grid = std::make_shared<PointGrid>(ensemble_grid->name(),nlcols,
+                                          ensemble_grid->get_num_vertical_levels(),
+                                          ensemble_grid->get_comm());
+  grid->setSelfPointer(grid);
+  grid->m_short_name = ensemble_grid->m_short_name;
+
+  const auto ens_gids = ensemble_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto dofs_gids = grid->get_dofs_gids();
+  auto gids = dofs_gids.get_view<gid_type*,Host>();
+  for (int icol=0; icol<nlcols; ++icol) {
+    gids(icol) = ens_gids(member*nlcols+icol) - member*ngcols;
+  }
+  dofs_gids.sync_to_dev();
+
+  for (const auto& name : ensemble_grid->get_geometry_data_names()) {
+    const auto src = ensemble_grid->get_geometry_data(name);
+    const auto& fid = src.get_header().get_identifier();
+    auto layout = fid.get_layout().clone();
+    const bool has_cols = layout.rank()>0 and layout.tag(0)==COL;
+    if (has_cols) {
+      layout.reset_dim(0,nlcols);
+    }
+    auto tgt = grid->create_geometry_data(FieldIdentifier(name,layout,fid.get_units(),
+                                                          grid->name(),fid.data_type()));
+    if (has_cols) {
+      copy_from_ensemble(src,tgt,nmembers,member);
+    } else {
+      tgt.deep_copy(src);
+    }
+    tgt.sync_to_host();
+  }
+
+  return grid;
+}
+
+void copy_to_ensemble (const Field& member_field, const Field& ensemble_field,
+                       const int nmembers, const int member)
+{
+  const int ncols = ensemble_field.get_header().get_identifier().get_layout().dim(0) / nmembers;
+  impl::copy_member_columns<true>(ensemble_field,member_field,member*ncols);
+}
+
+void copy_from_ensemble (const Field& ensemble_field, const Field& member_field,
+                         const int nmembers, const int member)
+{
+  const int ncols = ensemble_field.get_header().get_identifier().get_layout().dim(0) / nmembers;
+  impl::copy_member_columns<false>(ensemble_field,member_field,member*ncols);
+}
+
+EnsembleMemberGridsManager::
+EnsembleMemberGridsManager (const std::shared_ptr<const GridsManager>& ensemble_gm,
+                            const int nmembers, const int member)
+{
+  for (const auto& it : ensemble_gm->get_repo()) {
+    add_grid(create_ensemble_member_grid(it.second,nmembers,member));
+  }
+}
+
+auto EnsembleMemberGridsManager::
+do_create_remapper (const grid_ptr_type from_grid,
+                    const grid_ptr_type to_grid) const
+ -> remapper_ptr_type
+{
+  EKAT_ERROR_MSG ("Error! Remappers are not available for ensemble member grids.\n"
+      "  - from grid: " + from_grid->name() + "\n"
+      "  - to grid  : " + to_grid->name() + "\n");
+}
+
+} // namespace scream
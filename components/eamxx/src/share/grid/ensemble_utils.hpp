@@ -0,0 +1,67 @@
+#ifndef EAMXX_ENSEMBLE_UTILS_HPP
+#define EAMXX_ENSEMBLE_UTILS_HPP
+
+#include "share/grid/abstract_grid.hpp"
+#include "share/grid/grids_manager.hpp"
+#include "share/field/field.hpp"
+
+#include <memory>
+
+namespace scream
+{
+
+/*
+ * Utilities for ensemble runs of (standalone) physics.
+ *
+ * In an ensemble run, N members are stacked along the column dimension of
+ * a single point grid, so that one instance of each atm process (and one
+ * kernel launch) handles all members at once. On each rank, the ensemble
+ * grid owns the same member columns of all members, stored member-major:
+ *
+ *   ensemble lid = member*num_member_local_cols + member lid
+ *   ensemble gid = member*num_member_global_cols + member gid
+ *
+ * so that a member corresponds to a contiguous range of local columns, and
+ * moving data between ensemble and member grids requires no communication.
+ */
+
+// Create a grid stacking nmembers copies of the (point) member grid along
+// the column dimension. The member grid geometry data is replicated too.
+std::shared_ptr<AbstractGrid>
+create_ensemble_grid (const std::shared_ptr<const AbstractGrid>& member_grid,
+                      const int nmembers);
+
+// Extract the grid of a member from an ensemble grid (with its geometry data).
+// The member grid has the same name as the ensemble grid.
+std::shared_ptr<AbstractGrid>
+create_ensemble_member_grid (const std::shared_ptr<const AbstractGrid>& ensemble_grid,
+                             const int nmembers, const int member);
+
+// Copy the member columns between a field on a member grid and a field on the
+// ensemble grid. Fields must have COL as first dimension, and Real data type.
+void copy_to_ensemble (const Field& member_field, const Field& ensemble_field,
+                       const int nmembers, const int member);
+void copy_from_ensemble (const Field& ensemble_field, const Field& member_field,
+                         const int nmembers, const int member);
+
+// A grids manager storing the member grids of all the grids of an ensemble
+// grids manager. Remappers between different grids are not available.
+class EnsembleMemberGridsManager : public GridsManager
+{
+public:
+  EnsembleMemberGridsManager (const std::shared_ptr<const GridsManager>& ensemble_gm,
+                              const int nmembers, const int member);
+
+  std::string name () const override { return "EnsembleMemberGridsManager"; }
+
+  void build_grids () override {}
+
+protected:
+  remapper_ptr_type
+  do_create_remapper (const grid_ptr_type from_grid,
+                      const grid_ptr_type to_grid) const override;
+};
+
+} // namespace scream
+
+#endif // EAMXX_ENSEMBLE_UTILS_HPP
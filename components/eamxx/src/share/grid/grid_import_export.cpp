@@ -2,6 +2,9 @@
 
 #include "share/field/field_utils.hpp"
 
+#include <algorithm>
+#include <numeric>
+
 namespace scream
 {
 
@@ -21,75 +24,37 @@ GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
   m_overlapped = overlapped;
   m_comm = unique->get_comm();
 
-  // Note: we can't use the gids views from the grids, since we need to pass pointers
-  //       to MPI bcast routines, which require pointers to nonconst data.
-  //       Hence, create a clone, and grab a non-const pointer from it.
-  const auto unique_gids_f = unique->get_dofs_gids().clone();
-  const auto overlap_gids_f = overlapped->get_dofs_gids().clone();
-  const auto    gids = unique_gids_f.get_view<gid_type*,Host>();
-  const auto ov_gids = overlap_gids_f.get_view<gid_type*,Host>();
-
+  const auto ov_gids = overlapped->get_dofs_gids().get_view<const gid_type*,Host>();
   int num_ov_gids = ov_gids.size();
 
-  gid_type* data;
-  std::vector<gid_type> pid_gids;
-  std::map<int,std::vector<int>> pid2lids;
-
   // ------------------ Create import structures ----------------------- //
 
+  // Locate owner pid and remote lid of each overlapped gid, via the
+  // unique grid gids directory.
+  std::vector<int> remote_pids, remote_lids;
+  unique->get_remote_pids_and_lids(ov_gids,remote_pids,remote_lids);
+
   // Resize output
   m_import_lids = decltype(m_import_lids)("",num_ov_gids);
   m_import_pids = decltype(m_import_pids)("",num_ov_gids);
 
   m_import_lids_h = Kokkos::create_mirror_view(m_import_lids);
   m_import_pids_h = Kokkos::create_mirror_view(m_import_pids);
-  Kokkos::deep_copy(m_import_pids_h,-1);
-
-  // We may have repeated gids. In that case, we want to update
-  // the pids/lids arrays at all indices corresponding to the same gid
-  // std::map<gid_type,std::vector<int>> gid2idx;
-  // for (int i=0; i<num_ov_gids; ++i) {
-  //   gid2idx[ov_gids[i]].push_back(i);
-  // }
-  auto ov_gid2lid = overlapped->get_gid2lid_map();
-
-  // Let each rank bcast its src gids, so that other procs can
-  // check against their dst grid
-  int num_imports = 0;
-  for (int pid=0; pid<m_comm.size(); ++pid) {
-    // Bcast dst gids count for this pid
-    int num_gids_pid = gids.size();
-    m_comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==m_comm.rank()) {
-      data = gids.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    m_comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of this pid's gids in the dst gids list
-    for (int i=0; i<num_gids_pid; ++i) {
-      auto it = ov_gid2lid.find(data[i]);
-      if (it!=ov_gid2lid.end()) {
-        pid2lids[pid].push_back(it->second);
-        ++num_imports;
-      }
-    }
-  }
-  EKAT_REQUIRE_MSG (num_ov_gids==num_imports,
-      "Error! Could not locate the owner of one of the dst grid GIDs.\n"
-      "  - rank: " + std::to_string(m_comm.rank()) + "\n"
-      "  - num found: " + std::to_string(num_imports) + "\n"
-      "  - num dst gids: " + std::to_string(num_ov_gids) + "\n");
-  for (int pid=0,pos=0; pid<m_comm.size(); ++pid) {
-    const auto& lids = pid2lids[pid];
-    for (size_t i=0; i<lids.size(); ++i,++pos) {
-      m_import_lids_h(pos) = lids[i];
-      m_import_pids_h(pos) = pid;
-    }
+
+  // IMPORTANT! Within each PID, we order the list of imports according
+  // to the *remote* ordering, so that p2p messages are consistent with
+  // the exports list on the remote rank, which use the *local* ordering.
+  std::vector<int> import_order(num_ov_gids);
+  std::iota(import_order.begin(),import_order.end(),0);
+  std::sort(import_order.begin(),import_order.end(),
+            [&](const int i, const int j) {
+              return std::make_pair(remote_pids[i],remote_lids[i]) <
+                     std::make_pair(remote_pids[j],remote_lids[j]);
+            });
+  for (int pos=0; pos<num_ov_gids; ++pos) {
+    const int lid = import_order[pos];
+    m_import_lids_h(pos) = lid;
+    m_import_pids_h(pos) = remote_pids[lid];
   }
 
   Kokkos::deep_copy(m_import_lids,m_import_lids_h);
@@ -97,53 +62,25 @@ GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
 
   // ------------------ Create export structures ----------------------- //
 
-  auto gid2lid = unique->get_gid2lid_map();
-
-  // Let each rank bcast its src gids, so that other procs can
-  // check against their dst grid
-  // Note: we don't know a priori how many PIDs will need each
-  // of our dofs, so we cannot insert in the export pids/lids views yet,
-  // and must use a temporary map to store results
-  int num_exports = 0;
-  pid2lids.clear();
-  for (int pid=0; pid<m_comm.size(); ++pid) {
-    // Bcast dst gids count for this pid
-    int num_gids_pid = ov_gids.size();
-    m_comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==m_comm.rank()) {
-      data = ov_gids.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    m_comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of the src lids is in the list of needs of this pid
-    for (int i=0; i<num_gids_pid; ++i) {
-      auto it = gid2lid.find(data[i]);
-      if (it!=gid2lid.end()) {
-        pid2lids[pid].push_back(it->second);
-        ++num_exports;
-      }
-    }
-
-    // IMPORTANT! When building the import data, within each PID, we order
-    // the list of imports according to the *remote* ordering. In order for
-    // p2p messages to be consistent, the export data must order the
-    // list of exports according to the *local* ordring.
-    std::sort(pid2lids[pid].begin(),pid2lids[pid].end());
+  // Tell each owner which of its lids we need. Since we already know the
+  // remote lids, the owner does not need to look up the gids.
+  std::vector<std::vector<int>> needed_lids(m_comm.size());
+  for (int pos=0; pos<num_ov_gids; ++pos) {
+    needed_lids[m_import_pids_h(pos)].push_back(remote_lids[import_order[pos]]);
   }
+  std::vector<int> offsets;
+  auto export_lids = all_to_all_v(needed_lids,offsets,m_comm);
+  const int num_exports = export_lids.size();
 
+  // Imports within each pid are sorted by remote lid, so the lids we
+  // received are already sorted by local lid.
   m_export_pids = view_1d<int>("",num_exports);
   m_export_lids = view_1d<int>("",num_exports);
   m_export_lids_h = Kokkos::create_mirror_view(m_export_lids);
   m_export_pids_h = Kokkos::create_mirror_view(m_export_pids);
-  for (int pid=0,pos=0; pid<m_comm.size(); ++pid) {
-    const auto& lids = pid2lids[pid];
-    for (size_t i=0; i<lids.size(); ++i,++pos) {
-      m_export_lids_h(pos) = lids[i];
+  for (int pid=0; pid<m_comm.size(); ++pid) {
+    for (int pos=offsets[pid]; pos<offsets[pid+1]; ++pos) {
+      m_export_lids_h(pos) = export_lids[pos];
       m_export_pids_h(pos) = pid;
     }
   }
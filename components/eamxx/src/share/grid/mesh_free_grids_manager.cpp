@@ -1,6 +1,7 @@
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/grid/se_grid.hpp"
+#include "share/grid/ensemble_utils.hpp"
 #include "share/grid/remap/do_nothing_remapper.hpp"
 #include "share/property_checks/field_nan_check.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
@@ -131,7 +132,13 @@ build_point_grid (const std::string& name, ekat::ParameterList& params)
   add_geo_data(pt_grid);
   pt_grid->m_short_name = "pt";
 
-  add_grid(pt_grid);
+  // For ensemble runs, stack the members along the column dimension
+  const int num_members = params.get<int>("number_of_ensemble_members",1);
+  if (num_members>1) {
+    add_grid(create_ensemble_grid(pt_grid,num_members));
+  } else {
+    add_grid(pt_grid);
+  }
 }
 
 void MeshFreeGridsManager::
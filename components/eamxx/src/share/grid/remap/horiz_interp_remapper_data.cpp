@@ -67,8 +67,9 @@ get_my_triplets (const std::string& map_file) const
       " - map file n_a: " + std::to_string(n_a) + "\n"
       " - map file n_b: " + std::to_string(n_b) + "\n"
       " - fine grid ncols: " + std::to_string(ncols_fine) + "\n");
+  // A square map (e.g., a 1:1 map) can be used in either direction
   const bool map_is_coarsening = n_a==ncols_fine;
-  EKAT_REQUIRE_MSG (map_is_coarsening==(type==InterpType::Coarsen),
+  EKAT_REQUIRE_MSG (n_a==n_b or map_is_coarsening==(type==InterpType::Coarsen),
       "Error! The input map seems incompatible with the remapper type.\n"
       " - map file: " + map_file + "\n"
       " - map file n_a: " + std::to_string(n_a) + "\n"
@@ -158,6 +158,7 @@ set_field_manager (const std::shared_ptr<const fm_type>& field_mgr)
 
     // Store the layout
     m_layouts.emplace(name,fl);
+    m_read_buffers.erase(name);
 
     // If we can alias the field's host view, do it.
     // Otherwise, create a temporary.
@@ -167,8 +168,13 @@ set_field_manager (const std::shared_ptr<const fm_type>& field_mgr)
       m_host_views_1d[name] = view_1d_host(data,fl.size());
     } else {
       // We have padding, or the field is a subfield (or both).
-      // Either way, we need a temporary view.
-      m_host_views_1d[name] = view_1d_host("",fl.size());
+      // Either way, we need a temporary. We use a contiguous field with the
+      // same layout, so we can copy it into f on device (see read_variables).
+      Field buf (fid);
+      buf.allocate_view();
+      m_read_buffers[name] = buf;
+      auto data = buf.get_internal_view_data<Real,Host>();
+      m_host_views_1d[name] = view_1d_host(data,fl.size());
     }
   }
 }
@@ -216,113 +222,31 @@ void AtmosphereInput::read_variables (const int time_index)
   EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
       "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
+  // Read all the variables first, so that the (possibly slow) file reads
+  // are not interleaved with host-device transfers and kernel launches.
   for (auto const& name : m_fields_names) {
-
-    // Read the data
     auto v1d = m_host_views_1d.at(name);
     scorpio::read_var(m_filename,name,v1d.data(),time_index);
+  }
 
-    // If we have a field manager, make sure the data is correctly
-    // synced to both host and device views of the field.
-    if (m_field_mgr) {
-
+  // If we have a field manager, make sure the data is correctly
+  // synced to both host and device views of the field.
+  if (m_field_mgr) {
+    for (auto const& name : m_fields_names) {
       auto f = m_field_mgr->get_field(name);
-      const auto& fh  = f.get_header();
-      const auto& fl  = fh.get_identifier().get_layout();
-      const auto& fap = fh.get_alloc_properties();
-
-      // Check if the stored 1d view is sharing the data ptr with the field
-      const bool can_alias_field_view = fh.get_parent().expired() && fap.get_padding()==0;
-
-      // If the 1d view is a simple reshape of the field's Host view data,
-      // then we're already done. Otherwise, we need to manually copy.
-      if (not can_alias_field_view) {
-        // Get the host view of the field properly reshaped, and deep copy
-        // from temp_view (properly reshaped as well).
-        auto rank = fl.rank();
-        auto view_1d = m_host_views_1d.at(name);
-        switch (rank) {
-          case 1:
-            {
-              // No reshape needed, simply copy
-              auto dst = f.get_view<Real*,Host>();
-              for (int i=0; i<fl.dim(0); ++i) {
-                dst(i) = view_1d(i);
-              }
-              break;
-            }
-          case 2:
-            {
-              // Reshape temp_view to a 2d view, then copy
-              auto dst = f.get_view<Real**,Host>();
-              auto src = view_Nd_host<2>(view_1d.data(),fl.dim(0),fl.dim(1));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  dst(i,j) = src(i,j);
-              }}
-              break;
-            }
-          case 3:
-            {
-              // Reshape temp_view to a 3d view, then copy
-              auto dst = f.get_view<Real***,Host>();
-              auto src = view_Nd_host<3>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    dst(i,j,k) = src(i,j,k);
-              }}}
-              break;
-            }
-          case 4:
-            {
-              // Reshape temp_view to a 4d view, then copy
-              auto dst = f.get_view<Real****,Host>();
-              auto src = view_Nd_host<4>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      dst(i,j,k,l) = src(i,j,k,l);
-              }}}}
-              break;
-            }
-          case 5:
-            {
-              // Reshape temp_view to a 5d view, then copy
-              auto dst = f.get_view<Real*****,Host>();
-              auto src = view_Nd_host<5>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      for (int m=0; m<fl.dim(4); ++m) {
-                        dst(i,j,k,l,m) = src(i,j,k,l,m);
-              }}}}}
-              break;
-            }
-          case 6:
-            {
-              // Reshape temp_view to a 6d view, then copy
-              auto dst = f.get_view<Real******,Host>();
-              auto src = view_Nd_host<6>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4),fl.dim(5));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      for (int m=0; m<fl.dim(4); ++m) {
-                        for (int n=0; n<fl.dim(5); ++n) {
-                          dst(i,j,k,l,m,n) = src(i,j,k,l,m,n);
-              }}}}}}
-              break;
-            }
-          default:
-            EKAT_ERROR_MSG ("Error! Unexpected field rank (" + std::to_string(rank) + ").\n");
-        }
+      auto it = m_read_buffers.find(name);
+      if (it==m_read_buffers.end()) {
+        // The 1d view is a simple reshape of the field's Host view data,
+        // so we only need to sync to device
+        f.sync_to_dev();
+      } else {
+        // Upload the contiguous buffer as a whole, then let the device
+        // handle reshaping into the padded/strided field
+        auto& buf = it->second;
+        buf.sync_to_dev();
+        f.deep_copy(buf);
+        f.sync_to_host();
       }
-
-      // Sync to device
-      f.sync_to_dev();
     }
   }
   auto func_finish = std::chrono::steady_clock::now();
@@ -341,6 +265,7 @@ void AtmosphereInput::finalize()
   m_io_grid   = nullptr;
 
   m_host_views_1d.clear();
+  m_read_buffers.clear();
   m_layouts.clear();
 
   m_inited_with_views = false;
@@ -139,6 +139,8 @@ protected:
   std::shared_ptr<const AbstractGrid>   m_io_grid;
 
   std::map<std::string, view_1d_host>   m_host_views_1d;
+  // Contiguous copies of padded fields and subfields, where data is read into
+  std::map<std::string, Field>          m_read_buffers;
   std::map<std::string, FieldLayout>    m_layouts;
   
   std::string               m_filename;
@@ -113,12 +113,19 @@ AtmosphereOutput (const ekat::Comm& comm,
 AtmosphereOutput::
 AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
                   const std::shared_ptr<const fm_type>& field_mgr,
-                  const std::shared_ptr<const gm_type>& grids_mgr)
+                  const std::shared_ptr<const gm_type>& grids_mgr,
+                  const std::shared_ptr<OutputDiagnosticsCache>& diags_cache)
  : m_comm         (comm)
+ , m_diags_cache  (diags_cache)
  , m_add_time_dim (true)
 {
   using vos_t = std::vector<std::string>;
 
+  // If no cache is shared with other streams, use a private one
+  if (m_diags_cache==nullptr) {
+    m_diags_cache = std::make_shared<OutputDiagnosticsCache>();
+  }
+
   // Figure out what kind of averaging is requested
   auto avg_type = params.get<std::string>("Averaging Type");
   m_avg_type = str2avg(avg_type);
@@ -648,6 +655,32 @@ run (const std::string& filename,
   }
 } // run
 
+std::set<std::string> AtmosphereOutput::
+get_sim_fields_names () const
+{
+  const auto sim_field_mgr = get_field_manager("sim");
+  std::set<std::string> names;
+  auto add = [&](const std::string& name) {
+    // Diagnostics inputs may be other diagnostics, which are not in the field manager
+    if (sim_field_mgr->has_field(name)) {
+      names.insert(name);
+    }
+  };
+  for (const auto& fname : m_fields_names) {
+    add(fname);
+  }
+  for (const auto& it : m_diagnostics) {
+    for (const auto& f : it.second->get_fields_in()) {
+      add(f.name());
+    }
+  }
+  if (m_vert_remapper) {
+    add("p_mid");
+    add("p_int");
+  }
+  return names;
+}
+
 long long AtmosphereOutput::
 res_dep_memory_footprint () const {
   long long rdmf = 0;
@@ -1215,15 +1248,26 @@ compute_diagnostic(const std::string& name, const bool allow_invalid_fields)
   }
 
   m_diag_computed[name] = true;
-  if (allow_invalid_fields) {
-    // If any input is invalid, fill the diagnostic with invalid data
-    for (auto f : diag->get_fields_in()) {
-      if (not f.get_header().get_tracking().get_time_stamp().is_valid()) {
-        // Fill diag with invalid data and return
-        diag->get_diagnostic().deep_copy(m_fill_value);
-        return;
-      }
-    }
+
+  // The diag may be shared with other streams, which may have already evaluated
+  // it for the current values of its inputs. If so, there is nothing to do.
+  auto& entry = m_diags_cache->entries.at(m_diag_cache_keys.at(name));
+  std::vector<util::TimeStamp> inputs_ts;
+  bool inputs_valid = true;
+  for (const auto& f : diag->get_fields_in()) {
+    const auto& ts = f.get_header().get_tracking().get_time_stamp();
+    inputs_valid = inputs_valid and ts.is_valid();
+    inputs_ts.push_back(ts);
+  }
+  if (inputs_valid and inputs_ts.size()>0 and inputs_ts==entry.inputs_ts) {
+    return;
+  }
+  entry.inputs_ts.clear();
+
+  if (allow_invalid_fields and not inputs_valid) {
+    // Fill diag with invalid data and return
+    diag->get_diagnostic().deep_copy(m_fill_value);
+    return;
   }
 
   // Either allow_invalid_fields=false, or all inputs are valid. Proceed.
@@ -1231,11 +1275,14 @@ compute_diagnostic(const std::string& name, const bool allow_invalid_fields)
 
   // The diag may have failed to compute (e.g., t=0 output with a flux-like diag).
   // If we're allowing invalid fields, then we should simply set diag=m_fill_value
-  if (allow_invalid_fields) {
-    auto d = diag->get_diagnostic();
-    if (not d.get_header().get_tracking().get_time_stamp().is_valid()) {
+  auto d = diag->get_diagnostic();
+  if (not d.get_header().get_tracking().get_time_stamp().is_valid()) {
+    if (allow_invalid_fields) {
       d.deep_copy(m_fill_value);
     }
+  } else if (inputs_valid) {
+    // Only a valid evaluation from valid inputs can be reused by other streams
+    entry.inputs_ts = inputs_ts;
   }
 }
 /* ---------------------------------------------------------- */
@@ -1294,7 +1341,8 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
     //  - ${field_name}_at_model_bot
     //  - ${field_name}_at_model_top
     //  - ${field_name}_at_${M}X
-    // where M/N are numbers (N integer), X=Pa, hPa, mb, or m
+    //  - ${field_name}_at_plevs_${M1}_${M2}_..._${Mk}X
+    // where M/N are numbers (N integer), X=Pa, hPa, mb, or m (only pressure units for plevs)
     auto tokens = ekat::split(diag_field_name,"_at_");
     EKAT_REQUIRE_MSG (tokens.size()==2,
         "Error! Unexpected diagnostic name: " + diag_field_name + "\n");
@@ -1310,7 +1358,14 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
     // FieldAtLevel        : var_at_lev_N, var_at_model_top, var_at_model_bot
     // FieldAtPressureLevel: var_at_Nx, with x=mb,Pa,hPa
     // FieldAtHeight       : var_at_Nm_above_Y (Y=sealevel or surface)
-    if (tokens[1].find_first_of("0123456789.")==0) {
+    // FieldAtPressureLevels: var_at_plevs_N1_N2_..._Nkx, with x=mb,Pa,hPa
+    if (tokens[1].rfind("plevs_",0)==0) {
+      diag_name = "FieldAtPressureLevels";
+      diag_avg_cnt_name = "_" + tokens[1]; // Set avg_cnt tracking for this specific set of slices
+      // If we have 2D slices we need to be tracking the average count,
+      // if m_avg_type is not Instant
+      m_track_avg_cnt = m_track_avg_cnt || m_avg_type!=OutputAvgType::Instant;
+    } else if (tokens[1].find_first_of("0123456789.")==0) {
       auto units_start = tokens[1].find_first_not_of("0123456789.");
       auto units = tokens[1].substr(units_start);
       if (units.find("_above_") != std::string::npos) {
@@ -1399,15 +1454,23 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
     params.set<std::string>("diag_name", diag_name);
   }
 
-  // Create the diagnostic
-  auto diag = diag_factory.create(diag_name,m_comm,params);
-  diag->set_grids(m_grids_manager);
+  // Create the diagnostic, unless another stream sharing our cache already did
+  const auto sim_field_mgr = get_field_manager("sim");
+  const auto cache_key = diag_field_name + "@" + sim_field_mgr->get_grid()->name()
+                       + "@" + std::to_string(m_fill_value);
+  auto& entry = m_diags_cache->entries[cache_key];
+  const bool is_cached = entry.diag!=nullptr;
+  if (not is_cached) {
+    entry.diag = diag_factory.create(diag_name,m_comm,params);
+    entry.diag->set_shared_data(m_diags_cache->shared_data);
+    entry.diag->set_grids(m_grids_manager);
+  }
+  auto diag = entry.diag;
 
   // Ensure there's an entry in the map for this diag, so .at(diag_name) always works
   auto& deps = m_diag_depends_on_diags[diag->name()];
 
   // Initialize the diagnostic
-  const auto sim_field_mgr = get_field_manager("sim");
   for (const auto& freq : diag->get_required_field_requests()) {
     const auto& fname = freq.fid.name();
     if (!sim_field_mgr->has_field(fname)) {
@@ -1415,12 +1478,16 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
       if (m_diagnostics.count(fname)==0) {
         m_diagnostics[fname] = create_diagnostic(fname);
       }
-      auto dep = m_diagnostics.at(fname);
       deps.push_back(fname);
     }
-    diag->set_required_field (get_field(fname,"sim"));
+    if (not is_cached) {
+      diag->set_required_field (get_field(fname,"sim"));
+    }
+  }
+  if (not is_cached) {
+    diag->initialize(util::TimeStamp(),RunType::Initial);
   }
-  diag->initialize(util::TimeStamp(),RunType::Initial);
+  m_diag_cache_keys[diag->get_diagnostic().name()] = cache_key;
   // If specified, set avg_cnt tracking for this diagnostic.
   if (m_track_avg_cnt) {
     const auto diag_field = diag->get_diagnostic();
@@ -11,6 +11,9 @@
 
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
+
+#include <set>
+
 /*  The AtmosphereOutput class handles an output stream in SCREAM.
  *  Typical usage is to register an AtmosphereOutput object with the OutputManager (see scream_output_manager.hpp
  *
@@ -103,6 +106,34 @@
 namespace scream
 {
 
+/*
+ * A registry of the diagnostics created by output streams.
+ *
+ * Output streams constructed with the same registry share the diagnostics that
+ * have the same name, grid, and mask value, so that a diagnostic requested by
+ * several streams is created and initialized only once. Moreover, a shared
+ * diagnostic is evaluated again only if the time stamps of its inputs changed
+ * since its last evaluation, so that it is computed at most once per time step.
+ *
+ * The registry should be owned by whoever builds the output streams (e.g., the
+ * AtmosphereDriver), and must be destroyed before Kokkos is finalized.
+ */
+struct OutputDiagnosticsCache
+{
+  struct Entry {
+    std::shared_ptr<AtmosphereDiagnostic> diag;
+
+    // Time stamps of the diag inputs at its last (valid) evaluation.
+    // Empty if the diag must be evaluated at the next request.
+    std::vector<util::TimeStamp>          inputs_ts;
+  };
+
+  std::map<std::string,Entry> entries;
+
+  // Data that the diagnostics in the registry can share with each other
+  std::shared_ptr<DiagnosticsSharedData> shared_data = std::make_shared<DiagnosticsSharedData>();
+};
+
 class AtmosphereOutput
 {
 public:
@@ -126,7 +157,8 @@ public:
   // Constructor
   AtmosphereOutput(const ekat::Comm& comm, const ekat::ParameterList& params,
                    const std::shared_ptr<const fm_type>& field_mgr,
-                   const std::shared_ptr<const gm_type>& grids_mgr);
+                   const std::shared_ptr<const gm_type>& grids_mgr,
+                   const std::shared_ptr<OutputDiagnosticsCache>& diags_cache = nullptr);
 
   // Short version for outputing a list of fields (no remapping supported)
   AtmosphereOutput(const ekat::Comm& comm,
@@ -148,6 +180,14 @@ public:
 
   long long res_dep_memory_footprint () const;
 
+  // Names of the fields of the simulation field manager that this stream reads
+  // when it runs: output fields, inputs of the diagnostics, and the pressure
+  // fields used by the vertical remapper (if any).
+  std::set<std::string> get_sim_fields_names () const;
+  std::string get_sim_grid_name () const {
+    return get_field_manager("sim")->get_grid()->name();
+  }
+
   std::shared_ptr<const AbstractGrid> get_io_grid () const {
     return m_io_grid;
   }
@@ -206,6 +246,8 @@ protected:
   std::map<std::string,std::shared_ptr<atm_diag_type>>  m_diagnostics;
   std::map<std::string,std::vector<std::string>>        m_diag_depends_on_diags;
   std::map<std::string,bool>                            m_diag_computed;
+  std::map<std::string,std::string>                     m_diag_cache_keys;
+  std::shared_ptr<OutputDiagnosticsCache>               m_diags_cache;
   LongNames                                             m_longnames;
 
   // Use float, so that if output fp_precision=float, this is a representable value.
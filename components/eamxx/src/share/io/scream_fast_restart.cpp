@@ -0,0 +1,282 @@
+#include "share/io/scream_fast_restart.hpp"
+
+#include "share/util/scream_utils.hpp"
+
+#include <ekat/util/ekat_string_utils.hpp>
+#include <ekat/ekat_assert.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace scream
+{
+
+namespace {
+
+using HashType = std::uint64_t;
+
+constexpr char fast_restart_magic[8] = {'E','A','M','X','X','F','R','1'};
+
+// FNV-1a hash, processing 8 bytes at a time (and the remainder byte by byte)
+HashType checksum (const char* data, const long long nbytes)
+{
+  constexpr HashType prime = 1099511628211ULL;
+  HashType h = 14695981039346656037ULL;
+  const long long nwords = nbytes / sizeof(HashType);
+  for (long long i=0; i<nwords; ++i) {
+    HashType w;
+    std::memcpy(&w,data+i*sizeof(HashType),sizeof(HashType));
+    h ^= w;
+    h *= prime;
+  }
+  for (long long i=nwords*sizeof(HashType); i<nbytes; ++i) {
+    h ^= static_cast<unsigned char>(data[i]);
+    h *= prime;
+  }
+  return h;
+}
+
+std::string manifest_filename (const std::string& restart_filename)
+{
+  return restart_filename + ".fast_restart";
+}
+
+std::string rank_filename (const std::string& directory,
+                           const std::string& restart_filename,
+                           const std::string& grid_name,
+                           const int rank)
+{
+  auto base = restart_filename;
+  if (directory!="") {
+    base = directory + "/" + ekat::split(restart_filename,"/").back();
+  }
+  auto gname = grid_name;
+  std::replace(gname.begin(),gname.end(),' ','_');
+  return base + "." + gname + ".rank" + std::to_string(rank) + ".bin";
+}
+
+HashType gids_hash (const AbstractGrid& grid)
+{
+  using gid_type = AbstractGrid::gid_type;
+  const auto gids = grid.get_dofs_gids();
+  const auto data = gids.get_internal_view_data<const gid_type,Host>();
+  return checksum(reinterpret_cast<const char*>(data),grid.get_num_local_dofs()*sizeof(gid_type));
+}
+
+// We dump/load the whole allocation of each field. Subfields do not own their
+// allocation, so we go through a (contiguous) copy
+Field get_io_field (const Field& f)
+{
+  return f.get_header().get_alloc_properties().is_subfield() ? f.clone() : f;
+}
+
+long long alloc_size (const Field& f)
+{
+  return f.get_header().get_alloc_properties().get_alloc_size();
+}
+
+template<typename T>
+void write_value (std::ofstream& ofile, const T& v)
+{
+  ofile.write(reinterpret_cast<const char*>(&v),sizeof(T));
+}
+
+template<typename T>
+bool read_value (std::ifstream& ifile, T& v)
+{
+  ifile.read(reinterpret_cast<char*>(&v),sizeof(T));
+  return ifile.good();
+}
+
+struct RankFileHeader {
+  int nranks;
+  int num_local_dofs;
+  HashType gids_hash;
+  std::vector<std::string> names;
+  std::vector<long long>   sizes;
+  std::vector<HashType>    checksums;
+};
+
+bool read_header (std::ifstream& ifile, RankFileHeader& h)
+{
+  char magic[sizeof(fast_restart_magic)];
+  ifile.read(magic,sizeof(magic));
+  if (not ifile.good() or std::memcmp(magic,fast_restart_magic,sizeof(magic))!=0) {
+    return false;
+  }
+  int nfields;
+  if (not (read_value(ifile,h.nranks) and read_value(ifile,h.num_local_dofs) and
+           read_value(ifile,h.gids_hash) and read_value(ifile,nfields))) {
+    return false;
+  }
+  for (int i=0; i<nfields; ++i) {
+    int len;
+    if (not read_value(ifile,len) or len<0) {
+      return false;
+    }
+    std::string name(len,' ');
+    ifile.read(&name[0],len);
+    long long size;
+    HashType cs;
+    if (not (ifile.good() and read_value(ifile,size) and read_value(ifile,cs))) {
+      return false;
+    }
+    h.names.push_back(name);
+    h.sizes.push_back(size);
+    h.checksums.push_back(cs);
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+void write_fast_restart_files (const std::string& restart_filename,
+                               const std::string& directory,
+                               const std::vector<Field>& fields,
+                               const std::shared_ptr<const AbstractGrid>& grid,
+                               const ekat::Comm& comm)
+{
+  const auto fname = rank_filename(directory,restart_filename,grid->name(),comm.rank());
+  std::ofstream ofile (fname,std::ios::binary | std::ios::trunc);
+  EKAT_REQUIRE_MSG (ofile.good(),
+      "Error! Could not open fast restart file for writing.\n"
+      " - file name: " + fname + "\n");
+
+  std::vector<Field> io_fields;
+  for (const auto& f : fields) {
+    io_fields.push_back(get_io_field(f));
+  }
+  Kokkos::fence();
+
+  // Write straight from the device views if the host can access them. Otherwise,
+  // stage one field at a time in a host buffer, so that the fields host views
+  // (and their sync state) are not touched.
+  using dev_mem_space = typename Field::device_t::memory_space;
+  constexpr bool dev_accessible = Kokkos::SpaceAccessibility<Kokkos::HostSpace,dev_mem_space>::accessible;
+  Kokkos::View<char*,Kokkos::HostSpace> buffer;
+  auto get_host_data = [&](const Field& f) -> const char* {
+    const auto data = f.get_internal_view_data<const char>();
+    if constexpr (dev_accessible) {
+      return data;
+    } else {
+      const auto size = alloc_size(f);
+      if (static_cast<long long>(buffer.size())<size) {
+        buffer = Kokkos::View<char*,Kokkos::HostSpace>("",size);
+      }
+      Kokkos::View<const char*,dev_mem_space,Kokkos::MemoryUnmanaged> dev_data(data,size);
+      Kokkos::deep_copy(Kokkos::subview(buffer,std::make_pair(0LL,size)),dev_data);
+      return buffer.data();
+    }
+  };
+
+  // Header. The checksums are computed while writing the data, so we reserve
+  // their spot here, and fill them in afterwards.
+  ofile.write(fast_restart_magic,sizeof(fast_restart_magic));
+  write_value(ofile,comm.size());
+  write_value(ofile,grid->get_num_local_dofs());
+  write_value(ofile,gids_hash(*grid));
+  write_value(ofile,static_cast<int>(fields.size()));
+  std::vector<std::streampos> checksums_pos;
+  for (size_t i=0; i<fields.size(); ++i) {
+    const auto& name = fields[i].name();
+    write_value(ofile,static_cast<int>(name.size()));
+    ofile.write(name.data(),name.size());
+    write_value(ofile,alloc_size(io_fields[i]));
+    checksums_pos.push_back(ofile.tellp());
+    write_value(ofile,HashType(0));
+  }
+
+  // Data
+  std::vector<HashType> checksums;
+  for (const auto& f : io_fields) {
+    const auto data = get_host_data(f);
+    ofile.write(data,alloc_size(f));
+    checksums.push_back(checksum(data,alloc_size(f)));
+  }
+  for (size_t i=0; i<fields.size(); ++i) {
+    ofile.seekp(checksums_pos[i]);
+    write_value(ofile,checksums[i]);
+  }
+  EKAT_REQUIRE_MSG (ofile.good(),
+      "Error! Something went wrong while writing fast restart file.\n"
+      " - file name: " + fname + "\n");
+  ofile.close();
+
+  if (comm.am_i_root()) {
+    std::ofstream manifest (manifest_filename(restart_filename));
+    manifest << "nranks " << comm.size() << "\n";
+    manifest << "directory " << directory << "\n";
+  }
+}
+
+bool read_fast_restart_files (const std::string& restart_filename,
+                              const std::vector<Field>& fields,
+                              const std::shared_ptr<const AbstractGrid>& grid,
+                              const ekat::Comm& comm)
+{
+  // Check the manifest on root, and broadcast the directory of the rank files
+  int ok = 0;
+  std::string directory;
+  if (comm.am_i_root()) {
+    std::ifstream manifest (manifest_filename(restart_filename));
+    std::string key;
+    int nranks = -1;
+    if (manifest >> key >> nranks and key=="nranks" and nranks==comm.size() and
+        manifest >> key and key=="directory") {
+      // The directory may be empty, so read the rest of the line (minus the separator)
+      std::getline(manifest,directory);
+      if (directory.size()>0 and directory[0]==' ') {
+        directory.erase(0,1);
+      }
+      ok = 1;
+    }
+  }
+  comm.broadcast(&ok,1,comm.root_rank());
+  if (not ok) {
+    return false;
+  }
+  broadcast_string(directory,comm,comm.root_rank());
+
+  std::vector<Field> io_fields;
+  for (const auto& f : fields) {
+    io_fields.push_back(get_io_field(f));
+  }
+
+  // Read in the host views, and check that all data matches the current run.
+  // Only touch the fields device views once all ranks are done and happy.
+  std::ifstream ifile (rank_filename(directory,restart_filename,grid->name(),comm.rank()),std::ios::binary);
+  RankFileHeader h;
+  ok = ifile.good() and read_header(ifile,h) and
+       h.nranks==comm.size() and
+       h.num_local_dofs==grid->get_num_local_dofs() and
+       h.gids_hash==gids_hash(*grid) and
+       h.names.size()==fields.size();
+  for (size_t i=0; ok and i<fields.size(); ++i) {
+    const auto& f = io_fields[i];
+    const auto data = f.get_internal_view_data<char,Host>();
+    ok = h.names[i]==fields[i].name() and h.sizes[i]==alloc_size(f);
+    if (ok) {
+      ifile.read(data,alloc_size(f));
+      ok = ifile.good() and checksum(data,alloc_size(f))==h.checksums[i];
+    }
+  }
+
+  int all_ok;
+  comm.all_reduce(&ok,&all_ok,1,MPI_MIN);
+  if (not all_ok) {
+    return false;
+  }
+
+  for (size_t i=0; i<fields.size(); ++i) {
+    io_fields[i].sync_to_dev();
+    if (fields[i].get_header().get_alloc_properties().is_subfield()) {
+      auto f = fields[i];
+      f.deep_copy(io_fields[i]);
+    }
+  }
+  return true;
+}
+
+} // namespace scream
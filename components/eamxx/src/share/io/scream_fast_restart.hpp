@@ -0,0 +1,55 @@
+#ifndef SCREAM_FAST_RESTART_HPP
+#define SCREAM_FAST_RESTART_HPP
+
+#include "share/grid/abstract_grid.hpp"
+#include "share/field/field.hpp"
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * Fast model restart files.
+ *
+ * Besides the (PIO) model restart file, the model restart data can also be saved
+ * in raw binary form, with each rank dumping its local data in a separate file:
+ *
+ *   <dir>/<basename(restart file)>.<grid name>.rank<R>.bin
+ *
+ * Each rank file starts with a header, storing the number of ranks, a hash of
+ * the rank's dofs gids, and, for each field, its name, size and checksum. A small
+ * text manifest, <restart file>.fast_restart, stores the number of ranks and the
+ * directory of the rank files. Writing/reading these files does not involve any
+ * data movement across ranks, so it is much faster than PIO, but it can only be
+ * used if the restarted run has the same decomposition as the original one.
+ *
+ * Restarts should try the fast files first, and read the PIO file if the former
+ * cannot be used (files missing, different decomposition or fields, bad checksums).
+ */
+
+// Write the fast restart files of the given fields, all defined on the given grid.
+// The fields device data is written, and their host views are not used.
+// The manifest is (re)written by the root rank. Must be called by all ranks.
+void write_fast_restart_files (const std::string& restart_filename,
+                               const std::string& directory,
+                               const std::vector<Field>& fields,
+                               const std::shared_ptr<const AbstractGrid>& grid,
+                               const ekat::Comm& comm);
+
+// Read the fast restart files of the given fields. Returns true if the files were
+// usable on all ranks, in which case the fields (device data) are updated. If false
+// is returned, the fields device data is untouched, and the caller should read the
+// PIO restart file instead. Must be called by all ranks.
+bool read_fast_restart_files (const std::string& restart_filename,
+                              const std::vector<Field>& fields,
+                              const std::shared_ptr<const AbstractGrid>& grid,
+                              const ekat::Comm& comm);
+
+} // namespace scream
+
+#endif // SCREAM_FAST_RESTART_HPP
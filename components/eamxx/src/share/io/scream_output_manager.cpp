@@ -1,6 +1,7 @@
 #include "scream_output_manager.hpp"
 
 #include "share/io/scorpio_input.hpp"
+#include "share/io/scream_fast_restart.hpp"
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/util/scream_timing.hpp"
 #include "share/scream_config.hpp"
@@ -72,9 +73,14 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
     if (*it == "Physics PG2") pg2_grid_in_io_streams = true;
   }
 
+  // If no registry was provided, diags are shared only among this manager's streams
+  if (m_diags_cache==nullptr) {
+    m_diags_cache = std::make_shared<OutputDiagnosticsCache>();
+  }
+
   // For each grid, create a separate output stream.
   if (field_mgrs.size()==1) {
-    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr);
+    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr,m_diags_cache);
     output->set_logger(m_atm_logger);
     m_output_streams.push_back(output);
   } else {
@@ -107,7 +113,7 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
       EKAT_REQUIRE_MSG (field_mgrs.find(gname)!=field_mgrs.end(),
           "Error! Output requested on grid '" + gname + "', but no field manager is available for such grid.\n");
 
-      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr);
+      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr,m_diags_cache);
       output->set_logger(m_atm_logger);
       m_output_streams.push_back(output);
     }
@@ -361,6 +367,14 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   const bool is_full_checkpoint_step = is_checkpoint_step && has_checkpoint_data && not is_output_step;
   const bool is_write_step           = is_output_step || is_checkpoint_step;
 
+  // With fast restart, the restart fields are only written in the nc file every
+  // few restart writes (see scream_output_manager.hpp)
+  if (m_fast_restart and is_output_step) {
+    ++m_num_fast_restart_writes;
+    m_write_pio_restart_fields = m_fast_restart_pio_frequency>0 and
+                                 m_num_fast_restart_writes % m_fast_restart_pio_frequency == 0;
+  }
+
   // Create and setup output/checkpoint file(s), if necessary
   start_timer(timer_root+"::get_new_file");
   auto setup_output_file = [&](IOControl& control, IOFileSpecs& filespecs) {
@@ -444,6 +458,9 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   start_timer(timer_root+"::run_output_streams");
   const auto& fields_write_filename = is_output_step ? m_output_file_specs.filename : m_checkpoint_file_specs.filename;
   for (auto& it : m_output_streams) {
+    if (is_output_step and not m_write_pio_restart_fields) {
+      break;
+    }
     // Note: filename only matters if is_output_step || is_full_checkpoint_step=true. In that case, it will definitely point to a valid file name.
     if (m_atm_logger) {
       m_atm_logger->debug("[OutputManager]: writing fields from grid " + it->get_io_grid()->name() + "...\n");
@@ -452,6 +469,15 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   }
   stop_timer(timer_root+"::run_output_streams");
 
+  if (m_fast_restart and is_output_step) {
+    start_timer(timer_root+"::fast_restart");
+    for (const auto& it : m_fast_restart_fields) {
+      write_fast_restart_files(m_output_file_specs.filename,m_fast_restart_directory,
+                               it.second,m_fast_restart_grids.at(it.first),m_io_comm);
+    }
+    stop_timer(timer_root+"::fast_restart");
+  }
+
   if (is_write_step) {
     if (m_time_bnds.size()>0) {
       m_time_bnds[1] = timestamp.days_from(m_case_t0);
@@ -477,6 +503,7 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       if (m_is_model_restart_output) {
         // Only write nsteps on model restart
         set_attribute(filespecs.filename,"GLOBAL","nsteps",timestamp.get_num_steps());
+        set_attribute(filespecs.filename,"GLOBAL","has_restart_fields",static_cast<int>(m_write_pio_restart_fields));
       } else {
         if (filespecs.ftype==FileType::HistoryRestart) {
           // Update the date of last write and sample size
@@ -572,6 +599,7 @@ void OutputManager::finalize()
   //       which in turns calls finalize, causing endless recursion.
   m_output_streams = {};
   m_geo_data_streams = {};
+  m_diags_cache = nullptr;
   m_globals.clear();
   m_io_comm = {};
   m_params  = {};
@@ -585,6 +613,8 @@ void OutputManager::finalize()
   m_case_t0 = {};
   m_run_t0 = {};
   m_atm_logger = {};
+  m_fast_restart_fields.clear();
+  m_fast_restart_grids.clear();
 }
 
 long long OutputManager::res_dep_memory_footprint () const {
@@ -596,6 +626,27 @@ long long OutputManager::res_dep_memory_footprint () const {
   return mf;
 }
 
+bool OutputManager::is_sampling_step (const util::TimeStamp& ts) const
+{
+  if (not m_output_control.output_enabled()) {
+    return false;
+  }
+  return m_avg_type!=OutputAvgType::Instant or
+         m_output_control.is_write_step(ts) or ts==m_case_t0;
+}
+
+std::map<std::string,std::set<std::string>>
+OutputManager::get_sim_fields_names () const
+{
+  std::map<std::string,std::set<std::string>> names;
+  for (const auto& os : m_output_streams) {
+    const auto& grid_name = os->get_sim_grid_name();
+    const auto os_names = os->get_sim_fields_names();
+    names[grid_name].insert(os_names.begin(),os_names.end());
+  }
+  return names;
+}
+
 std::string OutputManager::
 compute_filename (const IOControl& control,
                   const IOFileSpecs& file_specs,
@@ -659,9 +710,22 @@ set_params (const ekat::ParameterList& params,
         }
       }
       fields_pl.sublist(it.first).set("Field Names",fnames);
+
+      if (fnames.size()>0) {
+        auto& fields = m_fast_restart_fields[it.first];
+        for (const auto& n : fnames) {
+          fields.push_back(fm->get_field(n));
+        }
+        m_fast_restart_grids[it.first] = fm->get_grid();
+      }
     }
     m_filename_prefix = m_params.get<std::string>("filename_prefix");
 
+    // Optionally, also write restart fields in per-rank binary files
+    m_fast_restart = m_params.get("fast_restart",false);
+    m_fast_restart_directory = m_params.get<std::string>("fast_restart_directory","");
+    m_fast_restart_pio_frequency = m_params.get<int>("fast_restart_pio_frequency",0);
+
     // Hard code some parameters in case we access them later
     m_params.set("MPI Ranks in Filename",false);
     m_params.set<std::string>("Floating Point Precision","real");
@@ -816,9 +880,12 @@ setup_file (      IOFileSpecs& filespecs,
     set_file_header(filespecs);
   }
 
-  // Make all output streams register their dims/vars
-  for (auto& it : m_output_streams) {
-    it->setup_output_file(filename,fp_precision,mode);
+  // Make all output streams register their dims/vars (unless the restart fields
+  // are only written in the fast restart files)
+  if (m_write_pio_restart_fields) {
+    for (auto& it : m_output_streams) {
+      it->setup_output_file(filename,fp_precision,mode);
+    }
   }
 
   // If grid data is needed,  also register geo data fields. Skip if file is resumed,
@@ -111,6 +111,11 @@ public:
   void set_logger(const std::shared_ptr<ekat::logger::LoggerBase>& atm_logger) {
       m_atm_logger = atm_logger;
   }
+  // Set a diagnostics registry, to be shared with other managers. Must be called
+  // before setup. If not set, diagnostics are only shared among this manager's streams.
+  void set_diagnostics_cache (const std::shared_ptr<OutputDiagnosticsCache>& diags_cache) {
+    m_diags_cache = diags_cache;
+  }
   void add_global (const std::string& name, const ekat::any& global);
 
   void init_timestep (const util::TimeStamp& start_of_step, const Real dt);
@@ -118,6 +123,13 @@ public:
   void finalize();
 
   long long res_dep_memory_footprint () const;
+
+  // Whether run(ts) reads the fields, that is, whether ts is an output step,
+  // or the output is not Instant (so fields are accumulated at every step)
+  bool is_sampling_step (const util::TimeStamp& ts) const;
+
+  // Names of the fields read by the output streams, for each grid
+  std::map<std::string,std::set<std::string>> get_sim_fields_names () const;
 protected:
 
   std::string compute_filename (const IOControl& control,
@@ -142,6 +154,9 @@ protected:
   std::vector<output_ptr_type>   m_output_streams;
   std::vector<output_ptr_type>   m_geo_data_streams;
 
+  // Diagnostics created by the output streams, possibly shared with other managers
+  std::shared_ptr<OutputDiagnosticsCache> m_diags_cache;
+
   globals_map_t                  m_globals;
 
   ekat::Comm                     m_io_comm;
@@ -186,6 +201,23 @@ protected:
 
   // If true, we save grid data in output file
   bool m_save_grid_data;
+
+  // For model restart output, optionally dump the restart fields also in per-rank
+  // binary files (see scream_fast_restart.hpp), which can be read back much faster
+  // when restarting with the same decomposition. Since the fast restart files
+  // are enough to restart with the same decomposition, the restart fields are
+  // only written in the nc file every m_fast_restart_pio_frequency restart
+  // writes (never, if 0), and the nc file of the other writes only stores
+  // the restart globals (nsteps and restart extra data). The tradeoff is that
+  // restarting with a different decomposition (or if the fast files are lost)
+  // is only possible from a restart file with the fields.
+  bool m_fast_restart = false;
+  std::string m_fast_restart_directory;
+  int  m_fast_restart_pio_frequency = 0;
+  int  m_num_fast_restart_writes = 0;
+  bool m_write_pio_restart_fields = true;
+  std::map<std::string,std::vector<Field>>  m_fast_restart_fields;
+  std::map<std::string,std::shared_ptr<const AbstractGrid>> m_fast_restart_grids;
 };
 
 } // namespace scream
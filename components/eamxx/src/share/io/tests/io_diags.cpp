@@ -37,6 +37,9 @@ public:
 
   std::string name() const override { return "MyDiag"; }
 
+  // Number of evaluations of any MyDiag instance
+  static int num_evals;
+
   void set_grids (const std::shared_ptr<const GridsManager> gm) override {
     using namespace ekat::units;
     using namespace ShortFieldTagsNames;
@@ -78,6 +81,8 @@ protected:
 
     m_diagnostic_output.deep_copy(f_in);
     m_diagnostic_output.update(m_one,dt,2.0);
+
+    ++num_evals;
   }
 
   void initialize_impl (const RunType /* run_type */ ) override {
@@ -96,6 +101,8 @@ protected:
   Field m_one;
 };
 
+int MyDiag::num_evals = 0;
+
 util::TimeStamp get_t0 () {
   return util::TimeStamp({2023,2,17},{0,0,0});
 }
@@ -276,6 +283,59 @@ void read (const int seed, const ekat::Comm& comm)
   }
 }
 
+// Checks that output managers sharing a diags cache evaluate a diag only once
+void shared_diags (const int seed, const ekat::Comm& comm)
+{
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+
+  auto t0 = get_t0();
+  auto dt = get_dt();
+
+  auto fm = get_fm(grid,t0,seed);
+  std::vector<std::string> fnames;
+  for (auto it : *fm) {
+    fnames.push_back(it.second->name());
+  }
+  fnames.push_back("MyDiag");
+
+  auto diags_cache = std::make_shared<OutputDiagnosticsCache>();
+  std::vector<OutputManager> oms(2);
+  for (int i=0; i<2; ++i) {
+    ekat::ParameterList om_pl;
+    om_pl.set("MPI Ranks in Filename",true);
+    om_pl.set("filename_prefix",std::string("io_diags_shared_")+std::to_string(i));
+    om_pl.set("Field Names",fnames);
+    om_pl.set("Averaging Type", std::string("INSTANT"));
+    auto& ctrl_pl = om_pl.sublist("output_control");
+    ctrl_pl.set("frequency_units",std::string("nsteps"));
+    ctrl_pl.set("Frequency",1);
+    ctrl_pl.set("save_grid_data",false);
+
+    oms[i].set_diagnostics_cache(diags_cache);
+    oms[i].setup(comm,om_pl,fm,gm,t0,t0,false);
+  }
+
+  // Only one diag must have been created
+  REQUIRE (diags_cache->entries.size()==1);
+
+  for (int n=1; n<=2; ++n) {
+    for (auto it : *fm) {
+      it.second->get_header().get_tracking().update_time_stamp(t0+n*dt);
+    }
+    MyDiag::num_evals = 0;
+    for (auto& om : oms) {
+      om.init_timestep(t0+(n-1)*dt,dt);
+      om.run(t0+n*dt);
+    }
+    REQUIRE (MyDiag::num_evals==1);
+  }
+
+  for (auto& om : oms) {
+    om.finalize();
+  }
+}
+
 TEST_CASE ("io_diags") {
   ekat::Comm comm(MPI_COMM_WORLD);
   scorpio::init_subsystem(comm);
@@ -300,6 +360,10 @@ TEST_CASE ("io_diags") {
   write(seed,comm);
   read(seed,comm);
   print(" PASS\n");
+
+  print ("-> Share diagnostics across output managers ", 40);
+  shared_diags(seed,comm);
+  print(" PASS\n");
   scorpio::finalize_subsystem();
 }
 
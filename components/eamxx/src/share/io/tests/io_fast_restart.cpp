@@ -0,0 +1,123 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_fast_restart.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <fstream>
+
+namespace scream {
+
+std::vector<Field>
+get_fields (const std::shared_ptr<const AbstractGrid>& grid)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+  const auto units = ekat::units::Units::nondimensional();
+
+  // Use a padded field and a subfield, to test non trivial allocations
+  Field f0 (FID("f_0",FL({COL},{nlcols}),units,grid->name()));
+  Field f1 (FID("f_1",FL({COL,LEV},{nlcols,nlevs}),units,grid->name()));
+  Field f2 (FID("f_2",FL({COL,CMP,ILEV},{nlcols,2,nlevs+1}),units,grid->name()));
+  f0.allocate_view();
+  f1.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+  f1.allocate_view();
+  f2.allocate_view();
+
+  return {f0,f1,f2.get_component(1)};
+}
+
+TEST_CASE ("fast_restart")
+{
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto engine = setup_random_test(&comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  RPDF pdf(0,1);
+
+  const int ngcols = 2*comm.size()+1;
+  const int nlevs = 4;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  const std::string restart_file = "fast_restart_test.np" + std::to_string(comm.size()) + ".r.nc";
+
+  // Write some random data
+  auto fields = get_fields(grid);
+  for (auto& f : fields) {
+    randomize(f,engine,pdf);
+  }
+  write_fast_restart_files(restart_file,"",fields,grid,comm);
+  comm.barrier();
+
+  SECTION ("same_decomposition") {
+    auto restarted = get_fields(grid);
+    REQUIRE (read_fast_restart_files(restart_file,restarted,grid,comm));
+    for (size_t i=0; i<fields.size(); ++i) {
+      REQUIRE (views_are_equal(fields[i],restarted[i]));
+    }
+  }
+
+  SECTION ("different_fields") {
+    auto restarted = get_fields(grid);
+    restarted.pop_back();
+    REQUIRE (not read_fast_restart_files(restart_file,restarted,grid,comm));
+  }
+
+  SECTION ("different_decomposition") {
+    // Shift the gids by one, so that no rank owns the same dofs as before
+    auto grid2 = grid->clone("Point Grid",false);
+    auto gids_h = grid2->get_dofs_gids().get_view<AbstractGrid::gid_type*,Host>();
+    for (int i=0; i<grid2->get_num_local_dofs(); ++i) {
+      gids_h(i) = (gids_h(i)+1) % ngcols;
+    }
+    grid2->get_dofs_gids().sync_to_dev();
+
+    auto restarted = get_fields(grid2);
+    for (auto& f : restarted) {
+      f.deep_copy(-1.0);
+    }
+    REQUIRE (not read_fast_restart_files(restart_file,restarted,grid2,comm));
+
+    // Fields are untouched
+    for (auto& f : restarted) {
+      REQUIRE (field_min<Real>(f)==-1.0);
+      REQUIRE (field_max<Real>(f)==-1.0);
+    }
+  }
+
+  SECTION ("corrupted_file") {
+    comm.barrier();
+    if (comm.am_i_root()) {
+      // Flip the last byte of the rank 0 file, which belongs to the data of the last field
+      const std::string rank_file = restart_file + ".Point_Grid.rank0.bin";
+      std::fstream f (rank_file,std::ios::in | std::ios::out | std::ios::binary);
+      f.seekg(-1,std::ios::end);
+      char c;
+      f.get(c);
+      f.seekp(-1,std::ios::end);
+      f.put(~c);
+    }
+    comm.barrier();
+
+    // Checksums are checked on all ranks, so all ranks must fail
+    auto restarted = get_fields(grid);
+    REQUIRE (not read_fast_restart_files(restart_file,restarted,grid,comm));
+  }
+}
+
+} // namespace scream
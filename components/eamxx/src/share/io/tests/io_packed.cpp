@@ -19,6 +19,7 @@
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/util/ekat_test_utils.hpp"
 
+#include <chrono>
 #include <iomanip>
 #include <memory>
 
@@ -37,9 +38,8 @@ util::TimeStamp get_t0 () {
 }
 
 std::shared_ptr<const GridsManager>
-get_gm (const ekat::Comm& comm)
+get_gm (const ekat::Comm& comm, const int nlcols = 3)
 {
-  const int nlcols = 3;
   const int nlevs = 16;
   const int ngcols = nlcols*comm.size();
   auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
@@ -95,10 +95,11 @@ get_fm (const std::shared_ptr<const AbstractGrid>& grid,
 }
 
 // Returns fields after initialization
-void write (const int freq, const int seed, const int ps, const ekat::Comm& comm)
+void write (const int freq, const int seed, const int ps, const ekat::Comm& comm,
+            const int nlcols = 3)
 {
   // Create grid
-  auto gm = get_gm(comm);
+  auto gm = get_gm(comm,nlcols);
   auto grid = gm->get_grid("Point Grid");
 
   // Time advance parameters
@@ -134,13 +135,15 @@ void write (const int freq, const int seed, const int ps, const ekat::Comm& comm
   om.finalize();
 }
 
-void read (const int freq, const int seed, const int ps_write, const int ps_read, const ekat::Comm& comm)
+// Returns the time spent in read_variables (in seconds)
+double read (const int freq, const int seed, const int ps_write, const int ps_read,
+             const ekat::Comm& comm, const int nlcols = 3)
 {
   // Time quantities
   auto t0 = get_t0();
 
   // Get gm
-  auto gm = get_gm (comm);
+  auto gm = get_gm (comm,nlcols);
   auto grid = gm->get_grid("Point Grid");
 
   // Get initial fields. Use wrong seed for fm, so fields are not
@@ -165,7 +168,10 @@ void read (const int freq, const int seed, const int ps_write, const int ps_read
   reader_pl.set("Field Names",fnames);
   AtmosphereInput reader(reader_pl,fm);
 
+  auto start = std::chrono::steady_clock::now();
   reader.read_variables();
+  Kokkos::fence();
+  auto finish = std::chrono::steady_clock::now();
   for (const auto& fn : fnames) {
     auto f0 = fm0->get_field(fn);
     auto f  = fm->get_field(fn);
@@ -175,6 +181,7 @@ void read (const int freq, const int seed, const int ps_write, const int ps_read
     }
     REQUIRE (views_are_equal(f,f0));
   }
+  return std::chrono::duration<double>(finish-start).count();
 }
 
 TEST_CASE ("io_packs") {
@@ -206,4 +213,38 @@ TEST_CASE ("io_packs") {
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE ("io_packs_read_throughput") {
+  // Not a correctness test per se (though answers are still checked), but rather
+  // a way to monitor the cost of reading padded fields, which are read in a
+  // contiguous buffer, and then copied into the field on device.
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  auto seed = get_random_test_seed(&comm);
+
+  const int freq = 5;
+  const int nlcols = 1000;
+  const int nreads = 5;
+  const int ps = SCREAM_PACK_SIZE>1 ? SCREAM_PACK_SIZE : 8;
+
+  write(freq,seed,1,comm,nlcols);
+
+  // Volume of data read (on all ranks), in MB
+  const int nlevs = get_gm(comm,nlcols)->get_grid("Point Grid")->get_num_vertical_levels();
+  const double mb = nlcols*comm.size()*(nlevs + 2*(nlevs+1))*sizeof(Real) / 1e6;
+
+  double elapsed = 0;
+  for (int i=0; i<nreads; ++i) {
+    elapsed += read(freq,seed,1,ps,comm,nlcols);
+  }
+  double max_elapsed;
+  comm.all_reduce(&elapsed,&max_elapsed,1,MPI_MAX);
+
+  if (comm.am_i_root()) {
+    std::cout << "  -> Read " << mb << " MB " << nreads << " times in "
+              << max_elapsed << " s (" << nreads*mb/max_elapsed << " MB/s)\n";
+  }
+  scorpio::finalize_subsystem();
+}
+
 } // anonymous namespace
@@ -334,6 +334,34 @@ protected:
   }
 };
 
+class Scratchy : public DummyProcess
+{
+public:
+  Scratchy (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const auto lt = grid->get_3d_scalar_layout (true);
+
+    add_field<Updated>("Field A",grid->get_2d_scalar_layout(),K,m_grid_name);
+
+    const auto lifetime = m_params.get<bool>("step_lifetime",false)
+                        ? ScratchLifetime::Step : ScratchLifetime::RunCall;
+    add_scratch_field(FieldIdentifier("tmp",lt,K,m_grid_name),lifetime,SCREAM_PACK_SIZE);
+  }
+
+  Field& get_tmp () { return get_scratch_field("tmp"); }
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -659,4 +687,128 @@ TEST_CASE ("diagnostics") {
   }
 }
 
+TEST_CASE ("buffer_arena") {
+  using namespace scream;
+
+  constexpr int end = ATMBufferManager::end_of_step;
+  const int n = 4*SCREAM_PACK_SIZE;
+  const size_t nbytes = n*sizeof(Real);
+
+  // a, b, and d are used in different run calls, c lives until the end of the step
+  ATMBufferManager bm;
+  bm.request_bytes(10*sizeof(Real));
+  auto a = bm.request_block("a",nbytes,0,0);
+  auto b = bm.request_block("b",nbytes,1,1);
+  auto c = bm.request_block("c",nbytes,1,end);
+  auto d = bm.request_block("d",nbytes,2,2);
+  bm.allocate();
+
+  REQUIRE (bm.blocks_naive_bytes()==4*nbytes);
+  REQUIRE (bm.blocks_packed_bytes()==2*nbytes);
+  REQUIRE (bm.allocated_bytes()>=10*sizeof(Real)+2*nbytes);
+
+  // Blocks do not overlap the shared buffer, nor blocks with overlapping lifetimes
+  REQUIRE (bm.get_block_memory(a)>=bm.get_memory()+10);
+  REQUIRE (bm.get_block_memory(a)==bm.get_block_memory(b));
+  REQUIRE (bm.get_block_memory(a)==bm.get_block_memory(d));
+  REQUIRE (std::abs(bm.get_block_memory(c)-bm.get_block_memory(b))>=n);
+  REQUIRE (std::abs(bm.get_block_memory(c)-bm.get_block_memory(d))>=n);
+
+  // Cannot request more memory after allocation
+  REQUIRE_THROWS (bm.request_block("e",nbytes,0,0));
+}
+
+TEST_CASE ("scratch_fields") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  ekat::ParameterList params;
+  params.set<std::string>("Grid Name", "Point Grid");
+
+  // One proc with a step scratch field, followed by two procs with run-call scratch fields
+  params.set("step_lifetime",true);
+  auto p0 = std::make_shared<Scratchy>(comm,params);
+  params.set("step_lifetime",false);
+  auto p1 = std::make_shared<Scratchy>(comm,params);
+  auto p2 = std::make_shared<Scratchy>(comm,params);
+
+  ATMBufferManager bm;
+  int slot = 0;
+  for (auto p : {p0,p1,p2}) {
+    p->set_grids(gm);
+    p->request_scratch_fields(bm,slot);
+  }
+  REQUIRE (slot==3);
+  bm.allocate();
+  for (auto p : {p0,p1,p2}) {
+    p->init_scratch_fields(bm);
+  }
+
+  // Run-call scratch fields of p1 and p2 share memory, while the step
+  // scratch field of p0 is still alive when p1 and p2 run
+  auto data = [](const Field& f) {
+    return f.get_internal_view_data<const Real>();
+  };
+  REQUIRE (bm.blocks_packed_bytes()==bm.blocks_naive_bytes()*2/3);
+  REQUIRE (data(p1->get_tmp())==data(p2->get_tmp()));
+  REQUIRE (data(p0->get_tmp())!=data(p1->get_tmp()));
+
+  // Scratch fields can be used as regular fields
+  const auto& fl = p0->get_tmp().get_header().get_identifier().get_layout();
+  p0->get_tmp().deep_copy(1.0);
+  p0->get_tmp().sync_to_host();
+  auto v = p0->get_tmp().get_view<const Real**,Host>();
+  for (int i=0; i<fl.dim(0); ++i) {
+    for (int j=0; j<fl.dim(1); ++j) {
+      REQUIRE (v(i,j)==1.0);
+    }
+  }
+
+  SECTION ("subcycled_group") {
+    using strvec_t = std::vector<std::string>;
+
+    auto& factory = AtmosphereProcessFactory::instance();
+    factory.register_product("Scratchy",&create_atmosphere_process<Scratchy>);
+
+    // A group subcycled twice, with a run-call scratch field in A and a step
+    // scratch field in B, followed by C, with a run-call scratch field.
+    ekat::ParameterList gparams("AB");
+    gparams.set<strvec_t>("atm_procs_list",{"A","B"});
+    gparams.set<std::string>("schedule_type","Sequential");
+    gparams.set<int>("number_of_subcycles",2);
+    for (std::string n : {"A","B"}) {
+      auto& pl = gparams.sublist(n);
+      pl.set<std::string>("Type","Scratchy");
+      pl.set<std::string>("Grid Name", "Point Grid");
+      pl.set("step_lifetime",n=="B");
+    }
+    auto group = std::make_shared<AtmosphereProcessGroup>(comm,gparams);
+    auto pc = std::make_shared<Scratchy>(comm,params);
+
+    ATMBufferManager bm_sub;
+    int slot_sub = 0;
+    group->set_grids(gm);
+    pc->set_grids(gm);
+    group->request_scratch_fields(bm_sub,slot_sub);
+    pc->request_scratch_fields(bm_sub,slot_sub);
+    REQUIRE (slot_sub==3);
+    bm_sub.allocate();
+    group->init_scratch_fields(bm_sub);
+    pc->init_scratch_fields(bm_sub);
+
+    // A runs again after B within the step, so they cannot share memory,
+    // while C can reuse A's memory, since the group is done when C runs
+    auto pa = std::dynamic_pointer_cast<Scratchy>(group->get_process_nonconst(0));
+    auto pb = std::dynamic_pointer_cast<Scratchy>(group->get_process_nonconst(1));
+    REQUIRE (data(pa->get_tmp())!=data(pb->get_tmp()));
+    REQUIRE (data(pc->get_tmp())==data(pa->get_tmp()));
+    REQUIRE (bm_sub.blocks_packed_bytes()==bm_sub.blocks_naive_bytes()*2/3);
+  }
+}
+
 } // empty namespace
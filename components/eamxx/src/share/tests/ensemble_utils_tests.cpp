@@ -0,0 +1,123 @@
+#include <catch2/catch.hpp>
+
+#include "share/grid/ensemble_utils.hpp"
+#include "share/grid/point_grid.hpp"
+#include "share/field/field.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+
+namespace {
+
+using namespace scream;
+using namespace scream::ShortFieldTagsNames;
+
+TEST_CASE ("ensemble_utils") {
+  using gid_type = AbstractGrid::gid_type;
+  using FID = FieldIdentifier;
+  using FL  = FieldLayout;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  const int nmembers = 3;
+  const int nlcols = 5;
+  const int ngcols = nlcols*comm.size();
+  const int nlevs  = 4;
+  const auto nondim = ekat::units::Units::nondimensional();
+
+  auto grid = create_point_grid("Physics",ngcols,nlevs,comm);
+  const auto gids = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+
+  auto lat = grid->create_geometry_data("lat",grid->get_2d_scalar_layout(),nondim);
+  auto hyam = grid->create_geometry_data("hyam",grid->get_vertical_layout(true),nondim);
+  auto lat_h = lat.get_view<Real*,Host>();
+  for (int icol=0; icol<nlcols; ++icol) {
+    lat_h(icol) = gids(icol);
+  }
+  lat.sync_to_dev();
+  hyam.deep_copy(1);
+  hyam.sync_to_host();
+
+  // Ensemble grid: members are stacked along the columns, member-major
+  auto egrid = create_ensemble_grid(grid,nmembers);
+  REQUIRE (egrid->name()==grid->name());
+  REQUIRE (egrid->get_num_local_dofs()==nmembers*nlcols);
+  REQUIRE (egrid->get_num_global_dofs()==nmembers*ngcols);
+  REQUIRE (egrid->is_unique());
+
+  const auto egids = egrid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto elat_h = egrid->get_geometry_data("lat").get_view<const Real*,Host>();
+  auto ehyam_h = egrid->get_geometry_data("hyam").get_view<const Real*,Host>();
+  for (int m=0; m<nmembers; ++m) {
+    for (int icol=0; icol<nlcols; ++icol) {
+      REQUIRE (egids(m*nlcols+icol)==m*ngcols+gids(icol));
+      REQUIRE (elat_h(m*nlcols+icol)==gids(icol));
+    }
+  }
+  for (int ilev=0; ilev<nlevs; ++ilev) {
+    REQUIRE (ehyam_h(ilev)==1);
+  }
+
+  // Member grids match the original grid
+  for (int m=0; m<nmembers; ++m) {
+    auto mgrid = create_ensemble_member_grid(egrid,nmembers,m);
+    REQUIRE (mgrid->get_num_local_dofs()==nlcols);
+    REQUIRE (mgrid->get_num_global_dofs()==ngcols);
+    const auto mgids = mgrid->get_dofs_gids().get_view<const gid_type*,Host>();
+    auto mlat_h = mgrid->get_geometry_data("lat").get_view<const Real*,Host>();
+    for (int icol=0; icol<nlcols; ++icol) {
+      REQUIRE (mgids(icol)==gids(icol));
+      REQUIRE (mlat_h(icol)==gids(icol));
+    }
+  }
+
+  // Copy fields to/from the ensemble
+  auto value = [](const int m, const int icol, const int icmp, const int ilev) {
+    return Real(1000*m + 100*icol + 10*icmp + ilev);
+  };
+  Field f (FID("f",FL({COL,CMP,LEV},{nlcols,2,nlevs}),nondim,grid->name()));
+  Field g (FID("f",FL({COL,CMP,LEV},{nmembers*nlcols,2,nlevs}),nondim,egrid->name()));
+  for (auto fld : {&f,&g}) {
+    fld->get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+    fld->allocate_view();
+  }
+  auto f_h = f.get_view<Real***,Host>();
+  for (int m=0; m<nmembers; ++m) {
+    for (int icol=0; icol<nlcols; ++icol) {
+      for (int icmp=0; icmp<2; ++icmp) {
+        for (int ilev=0; ilev<nlevs; ++ilev) {
+          f_h(icol,icmp,ilev) = value(m,icol,icmp,ilev);
+        }
+      }
+    }
+    f.sync_to_dev();
+    copy_to_ensemble(f,g,nmembers,m);
+  }
+
+  g.sync_to_host();
+  auto g_h = g.get_view<const Real***,Host>();
+  for (int m=0; m<nmembers; ++m) {
+    for (int icol=0; icol<nlcols; ++icol) {
+      for (int icmp=0; icmp<2; ++icmp) {
+        for (int ilev=0; ilev<nlevs; ++ilev) {
+          REQUIRE (g_h(m*nlcols+icol,icmp,ilev)==value(m,icol,icmp,ilev));
+        }
+      }
+    }
+  }
+
+  for (int m=0; m<nmembers; ++m) {
+    f.deep_copy(0);
+    copy_from_ensemble(g,f,nmembers,m);
+    f.sync_to_host();
+    for (int icol=0; icol<nlcols; ++icol) {
+      for (int icmp=0; icmp<2; ++icmp) {
+        for (int ilev=0; ilev<nlevs; ++ilev) {
+          REQUIRE (f_h(icol,icmp,ilev)==value(m,icol,icmp,ilev));
+        }
+      }
+    }
+  }
+}
+
+} // anonymous namespace
@@ -147,6 +147,46 @@ TEST_CASE ("get_owners") {
   }
 }
 
+TEST_CASE ("get_unique_gids") {
+  using gid_type = AbstractGrid::gid_type;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Each rank owns a contiguous block of gids, and all ranks
+  // but the first also have a copy of gid 0.
+  const int num_block_dofs = 10;
+  const int offset = num_block_dofs*comm.rank();
+  const int num_local_dofs = num_block_dofs + (comm.am_i_root() ? 0 : 1);
+  auto grid = std::make_shared<PointGrid>("grid",num_local_dofs,0,comm);
+  auto dofs = grid->get_dofs_gids();
+  auto dofs_h = dofs.get_view<gid_type*,Host>();
+  for (int i=0; i<num_block_dofs; ++i) {
+    dofs_h[i] = offset + i;
+  }
+  if (not comm.am_i_root()) {
+    dofs_h[num_block_dofs] = 0;
+  }
+  dofs.sync_to_dev();
+
+  REQUIRE (grid->is_unique()==(comm.size()==1));
+
+  // Gid 0 is kept by the root rank only
+  auto unique_gids = grid->get_unique_gids();
+  REQUIRE (unique_gids.size()==static_cast<size_t>(num_block_dofs));
+  for (int i=0; i<num_block_dofs; ++i) {
+    REQUIRE (unique_gids[i]==offset+i);
+  }
+
+  // Make the extra copies of gid 0 unique gids. The cached directory is
+  // stale until all ranks reset it.
+  if (not comm.am_i_root()) {
+    dofs_h[num_block_dofs] = num_block_dofs*comm.size() + comm.rank();
+  }
+  dofs.sync_to_dev();
+  grid->reset_gid_directory();
+  REQUIRE (grid->is_unique());
+}
+
 TEST_CASE ("gid2lid_map") {
   using gid_type = AbstractGrid::gid_type;
 
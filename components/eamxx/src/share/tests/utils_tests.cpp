@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include "share/util/scream_array_utils.hpp"
+#include "share/util/eamxx_column_chunks.hpp"
 #include "share/util/scream_universal_constants.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
@@ -250,3 +251,56 @@ TEST_CASE ("array_utils") {
     }
   }
 }
+
+TEST_CASE ("column_chunks") {
+  using namespace scream;
+
+  // Chunks must cover [0,ncols) with no gaps/overlaps, and not exceed the chunk size
+  auto check = [](const ColumnChunks& c, const int ncols) {
+    REQUIRE (static_cast<int>(c.beg.size())==c.num+1);
+    REQUIRE (c.beg.front()==0);
+    REQUIRE (c.beg.back()==ncols);
+    for (int i=0; i<c.num; ++i) {
+      REQUIRE (c.ncols(i)>=0);
+      REQUIRE (c.ncols(i)<=c.size);
+      REQUIRE (c.cols(i).second==c.beg[i+1]);
+    }
+  };
+
+  SECTION ("by_size") {
+    for (int ncols : {0,1,7,218}) {
+      for (int size : {-1,0,1,5,50,218,1000}) {
+        auto c = make_column_chunks(ncols,size);
+        check(c,ncols);
+        if (size<=0 or size>=ncols) {
+          REQUIRE (c.num==(ncols>0 ? 1 : 0));
+        } else {
+          REQUIRE (c.size==size);
+          REQUIRE (c.num==(ncols+size-1)/size);
+        }
+      }
+    }
+  }
+
+  SECTION ("by_number") {
+    for (int ncols : {0,3,7,218}) {
+      for (int num : {1,4,10}) {
+        auto c = make_column_chunks_by_number(ncols,num);
+        REQUIRE (c.num==num);
+        check(c,ncols);
+      }
+    }
+  }
+
+  SECTION ("chunk_views") {
+    Kokkos::View<int**> v("v",10,3);
+    auto c = make_column_chunks(10,4);
+    REQUIRE (c.num==3);
+    for (int i=0; i<c.num; ++i) {
+      auto vc = chunk(v,c.cols(i));
+      REQUIRE (static_cast<int>(vc.extent(0))==c.ncols(i));
+      REQUIRE (vc.extent(1)==v.extent(1));
+      REQUIRE (vc.data()==v.data()+c.beg[i]*v.extent(1));
+    }
+  }
+}
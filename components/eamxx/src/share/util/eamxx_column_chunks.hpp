@@ -0,0 +1,76 @@
+#ifndef EAMXX_COLUMN_CHUNKS_HPP
+#define EAMXX_COLUMN_CHUNKS_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * Utilities for processes that run on chunks of columns, so that their local
+ * views and workspace are sized by the chunk size, rather than by the number
+ * of local columns.
+ */
+
+struct ColumnChunks {
+  int size = 0;           // Max number of columns in a chunk
+  int num  = 0;           // Number of chunks
+  std::vector<int> beg;   // First column of each chunk, followed by the number of columns
+
+  int ncols (const int ichunk) const { return beg[ichunk+1] - beg[ichunk]; }
+
+  std::pair<int,int> cols (const int ichunk) const {
+    return std::make_pair(beg[ichunk],beg[ichunk+1]);
+  }
+};
+
+// Split ncols columns in chunks of chunk_size columns (the last chunk may be
+// smaller). A non-positive chunk_size, or one larger than ncols, means "all columns".
+inline ColumnChunks make_column_chunks (const int ncols, const int chunk_size)
+{
+  ColumnChunks chunks;
+  chunks.size = chunk_size<=0 or chunk_size>ncols ? ncols : chunk_size;
+  chunks.size = std::max(chunks.size,1);
+  chunks.num  = (ncols+chunks.size-1) / chunks.size;
+  chunks.beg.resize(chunks.num+1,0);
+  for (int i=0; i<chunks.num; ++i) {
+    chunks.beg[i+1] = std::min(ncols,chunks.beg[i]+chunks.size);
+  }
+  return chunks;
+}
+
+// Split ncols columns in num_chunks chunks of (almost) the same size. If
+// ncols<num_chunks, some chunks are empty.
+inline ColumnChunks make_column_chunks_by_number (const int ncols, const int num_chunks)
+{
+  ColumnChunks chunks;
+  chunks.num  = num_chunks;
+  chunks.size = std::max(1,(ncols+num_chunks-1) / num_chunks);
+  chunks.beg.resize(num_chunks+1);
+  for (int i=0; i<=num_chunks; ++i) {
+    chunks.beg[i] = (i*ncols) / num_chunks;
+  }
+  return chunks;
+}
+
+// Restrict a view to a range of columns (its leading dimension)
+template<typename ViewT>
+ViewT chunk (const ViewT& v, const std::pair<int,int>& cols)
+{
+  if constexpr (ViewT::rank==1) {
+    return Kokkos::subview(v,cols);
+  } else if constexpr (ViewT::rank==2) {
+    return Kokkos::subview(v,cols,Kokkos::ALL());
+  } else {
+    static_assert (ViewT::rank==3, "Error! Unsupported view rank in chunk.\n");
+    return Kokkos::subview(v,cols,Kokkos::ALL(),Kokkos::ALL());
+  }
+}
+
+} // namespace scream
+
+#endif // EAMXX_COLUMN_CHUNKS_HPP
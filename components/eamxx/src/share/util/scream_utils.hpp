@@ -12,6 +12,7 @@
 #include <algorithm>
 #include <map>
 #include <iostream>
+#include <vector>
 
 namespace scream {
 
@@ -348,6 +349,49 @@ check_mpi_call (int err, const std::string& context) {
       "  - context: " + context + "\n");
 }
 
+// Exchange variable-length lists of items among all the ranks of comm, with a
+// single all-to-all-v round. send[pid] is the list of items to send to rank pid.
+// On output, the items received from rank pid are stored in the returned vector,
+// in the range [recv_offsets[pid],recv_offsets[pid+1]).
+template<typename T>
+std::vector<T> all_to_all_v (const std::vector<std::vector<T>>& send,
+                             std::vector<int>& recv_offsets,
+                             const ekat::Comm& comm)
+{
+  const int nranks = comm.size();
+  EKAT_REQUIRE_MSG (static_cast<int>(send.size())==nranks,
+      "Error! Send lists must be provided for every rank in the comm.\n"
+      "  - comm size: " + std::to_string(nranks) + "\n"
+      "  - num send lists: " + std::to_string(send.size()) + "\n");
+
+  std::vector<int> send_counts(nranks), recv_counts(nranks);
+  std::vector<int> send_offsets(nranks+1,0);
+  for (int pid=0; pid<nranks; ++pid) {
+    send_counts[pid] = send[pid].size();
+    send_offsets[pid+1] = send_offsets[pid] + send_counts[pid];
+  }
+  check_mpi_call(MPI_Alltoall(send_counts.data(),1,MPI_INT,
+                              recv_counts.data(),1,MPI_INT,comm.mpi_comm()),
+                 "all_to_all_v: exchanging counts");
+
+  recv_offsets.assign(nranks+1,0);
+  for (int pid=0; pid<nranks; ++pid) {
+    recv_offsets[pid+1] = recv_offsets[pid] + recv_counts[pid];
+  }
+
+  std::vector<T> send_buf, recv_buf(recv_offsets[nranks]);
+  send_buf.reserve(send_offsets[nranks]);
+  for (const auto& items : send) {
+    send_buf.insert(send_buf.end(),items.begin(),items.end());
+  }
+  const auto mpi_t = ekat::get_mpi_type<T>();
+  check_mpi_call(MPI_Alltoallv(send_buf.data(),send_counts.data(),send_offsets.data(),mpi_t,
+                               recv_buf.data(),recv_counts.data(),recv_offsets.data(),mpi_t,
+                               comm.mpi_comm()),
+                 "all_to_all_v: exchanging items");
+  return recv_buf;
+}
+
 // Find the full filename list from patterns
 std::vector<std::string> filename_glob(const std::vector<std::string>& patterns);
 
@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include "control/atmosphere_driver.hpp"
+#include "physics/ml_correction/eamxx_ml_correction_process_interface.hpp"
 #include "physics/register_physics.hpp"
 #include "share/grid/mesh_free_grids_manager.hpp"
 
@@ -74,10 +75,38 @@ TEST_CASE("ml_correction-stand-alone", "") {
       py::array_t<Real, py::array::c_style | py::array::forcecast>(
           num_cols * num_levs, qv.data(), py::str{}),
       num_cols, num_levs, ML_model_tq, ML_model_uv);
-  py::gil_scoped_release no_gil;
-  ekat::enable_fpes(fpe_mask);
   REQUIRE(qv(1, 10) == reference);   // This is the one that is modified
   REQUIRE(qv(0, 10) != reference);  // This one should be unchanged
+
+  // Check the zero-copy handoff used by MLCorrection: qv is a subfield of the
+  // tracers group, so the numpy array must alias its strided data, and writes
+  // in python must land in the selected cols only.
+  const auto cols = Kokkos::make_pair(1,num_cols);
+  const auto levs = Kokkos::make_pair(0,num_levs);
+  const auto qv_sub = Kokkos::subview(qv,cols,levs);
+  auto qv_np = as_numpy_array(qv_sub);
+  REQUIRE(qv_np.data()==qv_sub.data());
+  REQUIRE(qv_np.ndim()==2);
+  REQUIRE(qv_np.shape(0)==num_cols-1);
+  REQUIRE(qv_np.shape(1)==num_levs);
+  REQUIRE(qv_np.strides(0)==static_cast<py::ssize_t>(qv.stride(0)*sizeof(Real)));
+  REQUIRE(qv_np.strides(1)==static_cast<py::ssize_t>(qv.stride(1)*sizeof(Real)));
+  std::vector<Real> qv_col0(num_levs);
+  for(int jlev = 0; jlev < num_levs; ++jlev) {
+    qv_col0[jlev] = qv(0, jlev);
+  }
+  const Real value = 2.0;
+  py_correction.attr("fill_in_place")(qv_np, value);
+  for(int jlev = 0; jlev < num_levs; ++jlev) {
+    REQUIRE(qv(0, jlev) == qv_col0[jlev]);
+  }
+  for(int icol = 1; icol < num_cols; ++icol) {
+    for(int jlev = 0; jlev < num_levs; ++jlev) {
+      REQUIRE(qv(icol, jlev) == value);
+    }
+  }
+  py::gil_scoped_release no_gil;
+  ekat::enable_fpes(fpe_mask);
   ad.finalize();
 }
 
@@ -44,3 +44,11 @@ def modify_view(data, Ncol, Nlev, model_tq, model_uv):
     data = np.reshape(data, (-1, Nlev))
     prediction = sample_ML_prediction(Nlev, data[1, :], model_tq, model_uv)
     data[1, :] = prediction
+
+
+def fill_in_place(data, value):
+    """
+    Set all the entries of the (possibly strided) array to value, without
+    reshaping or copying, so that the caller sees the change.
+    """
+    data[...] = value
@@ -0,0 +1,40 @@
+#include <catch2/catch.hpp>
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include <numeric>
+
+namespace {
+
+using namespace scream;
+
+// Create a 1:1 map file, which can be used both as a coarsening and refining map
+void create_identity_map (const int ncols, const std::string& filename)
+{
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  scorpio::register_file(filename, scorpio::FileMode::Write);
+  scorpio::define_dim(filename,"n_a", ncols);
+  scorpio::define_dim(filename,"n_b", ncols);
+  scorpio::define_dim(filename,"n_s", ncols);
+  scorpio::define_var(filename,"col",{"n_s"},"int");
+  scorpio::define_var(filename,"row",{"n_s"},"int");
+  scorpio::define_var(filename,"S"  ,{"n_s"},"double");
+  scorpio::enddef(filename);
+
+  std::vector<int> ids(ncols);
+  std::iota(ids.begin(),ids.end(),1);
+  std::vector<double> S(ncols,1.0);
+  scorpio::write_var(filename,"col",ids.data());
+  scorpio::write_var(filename,"row",ids.data());
+  scorpio::write_var(filename,"S"  ,S.data());
+  scorpio::release_file(filename);
+  scorpio::finalize_subsystem();
+}
+
+TEST_CASE("create_identity_map","create_identity_map")
+{
+  create_identity_map(218,"map_identity_218.nc");
+}
+
+} // anonymous namespace
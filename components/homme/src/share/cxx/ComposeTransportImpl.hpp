@@ -30,6 +30,7 @@
 #include "mpi/Connectivity.hpp"
 
 #include <cassert>
+#include <vector>
 
 namespace Homme {
 
@@ -55,7 +56,7 @@ struct ComposeTransportImpl {
   using DeparturePoints = ExecViewManaged<Real*[NUM_PHYSICAL_LEV][NP][NP][3]>;
 
   struct Data {
-    int nelemd, qsize, limiter_option, cdr_check, hv_q, hv_subcycle_q;
+    int nelemd, qsize, limiter_option, cdr_check, hv_q, hv_subcycle_q, hv_q_batch;
     int geometry_type; // 0: sphere, 1: plane
     Real nu_q, hv_scaling, dp_tol;
     bool independent_time_steps;
@@ -67,7 +68,7 @@ struct ComposeTransportImpl {
 
     Data ()
       : nelemd(-1), qsize(-1), limiter_option(9), cdr_check(0), hv_q(0),
-        hv_subcycle_q(0), geometry_type(0), nu_q(0), hv_scaling(0), dp_tol(-1),
+        hv_subcycle_q(0), hv_q_batch(0), geometry_type(0), nu_q(0), hv_scaling(0), dp_tol(-1),
         independent_time_steps(false)
     {}
   };
@@ -82,11 +83,27 @@ struct ComposeTransportImpl {
   int nslot;
   Data m_data;
 
-  TeamPolicy m_tp_ne, m_tp_ne_qsize, m_tp_ne_hv_q;
-  TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_qsize, m_tu_ne_hv_q;
+  TeamPolicy m_tp_ne, m_tp_ne_qsize;
+  TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_qsize;
 
   std::shared_ptr<BoundaryExchange>
-    m_qdp_dss_be[Q_NUM_TIME_LEVELS], m_v_dss_be[2], m_hv_dss_be[2];
+    m_qdp_dss_be[Q_NUM_TIME_LEVELS], m_v_dss_be[2];
+
+  // Tracer HV is done in batches of tracers q0:q0+nq-1 so that the DSS of one
+  // batch is in flight while the Laplacian of the next one is computed.
+  struct HvBatch {
+    int q0, nq;
+    TeamPolicy tp;
+    TeamUtils<ExecSpace> tu;
+    std::shared_ptr<BoundaryExchange> dss_be[2];
+
+    HvBatch (const int q0_, const int nq_, const TeamPolicy& tp_)
+      : q0(q0_), nq(nq_), tp(tp_), tu(tp_)
+    {}
+  };
+  std::vector<HvBatch> m_hv_batches;
+  // Consecutive batches alternate between the MPI_EXCHANGE buffers and these.
+  std::shared_ptr<MpiBuffersManager> m_hv_bm;
 
   ComposeTransportImpl();
   ComposeTransportImpl(const int num_elems);
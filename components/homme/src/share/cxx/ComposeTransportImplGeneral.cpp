@@ -10,6 +10,8 @@
 #include "ComposeTransportImpl.hpp"
 #include "compose_hommexx.hpp"
 
+#include <map>
+
 extern "C" void
 sl_get_params(double* nu_q, double* hv_scaling, int* hv_q, int* hv_subcycle_q,
               int* limiter_option, int* cdr_check, int* geometry_type);
@@ -22,16 +24,52 @@ static int calc_nslot (const int nelemd) {
   return std::min(nelemd, tu.get_num_ws_slots());
 }
 
+// Bytes one tracer adds to the largest message this rank sends to a single
+// neighbor in the tracer HV DSS. This mirrors how BoundaryExchange sizes its
+// per-pid messages: each shared connection to that pid contributes NP points
+// (edge) or 1 point (corner), each with NUM_LEV*VECTOR_SIZE values per 3d
+// field. The max is taken over all ranks so that every rank picks the same
+// batches.
+static Real calc_hv_q_message_bytes (const Connectivity& connectivity) {
+  const auto& h_ucon = connectivity.get_h_ucon();
+  const ConnectionHelpers helpers;
+  std::map<int,long long> pid_points;
+  for (int i = 0; i < int(h_ucon.extent(0)); ++i) {
+    const auto& info = h_ucon(i);
+    if (info.sharing != etoi(ConnectionSharing::SHARED)) continue;
+    pid_points[info.remote_pid] += helpers.CONNECTION_SIZE[info.kind];
+  }
+  long long max_points = 0;
+  for (const auto& it : pid_points) max_points = std::max(max_points, it.second);
+  long long gmax_points;
+  MPI_Allreduce(&max_points, &gmax_points, 1, MPI_LONG_LONG_INT, MPI_MAX,
+                connectivity.get_comm().mpi_comm());
+  return Real(gmax_points)*NUM_LEV*VECTOR_SIZE*sizeof(Real);
+}
+
+// Number of tracers per batch in the tracer HV. Each batch pays the message
+// latency of a full DSS, so split the tracers only when the largest per-neighbor
+// message would exceed max_message_bytes, and then into the fewest batches that
+// keep every message within that size.
+static int calc_hv_q_batch (const Real q_message_bytes, const int hv_q) {
+  const Real max_message_bytes = 1 << 20;
+  if (q_message_bytes <= 0 || hv_q*q_message_bytes <= max_message_bytes)
+    return std::max(1, hv_q);
+  const int nq_max = std::max(1, int(max_message_bytes/q_message_bytes));
+  const int nbatch = (hv_q + nq_max - 1)/nq_max;
+  return (hv_q + nbatch - 1)/nbatch;
+}
+
 ComposeTransportImpl::ComposeTransportImpl ()
-  : m_tp_ne(1,1,1), m_tp_ne_qsize(1,1,1), m_tp_ne_hv_q(1,1,1), // throwaway settings
-    m_tu_ne(m_tp_ne), m_tu_ne_qsize(m_tp_ne_qsize), m_tu_ne_hv_q(m_tp_ne_hv_q)
+  : m_tp_ne(1,1,1), m_tp_ne_qsize(1,1,1), // throwaway settings
+    m_tu_ne(m_tp_ne), m_tu_ne_qsize(m_tp_ne_qsize)
 {
   setup();
 }
 
 ComposeTransportImpl::ComposeTransportImpl (const int num_elems)
-  : m_tp_ne(1,1,1), m_tp_ne_qsize(1,1,1), m_tp_ne_hv_q(1,1,1), // throwaway settings
-    m_tu_ne(m_tp_ne), m_tu_ne_qsize(m_tp_ne_qsize), m_tu_ne_hv_q(m_tp_ne_hv_q)
+  : m_tp_ne(1,1,1), m_tp_ne_qsize(1,1,1), // throwaway settings
+    m_tu_ne(m_tp_ne), m_tu_ne_qsize(m_tp_ne_qsize)
 {
   nslot = calc_nslot(m_geometry.num_elems());
 }
@@ -97,18 +135,26 @@ void ComposeTransportImpl::reset (const SimulationParams& params) {
   m_tp_ne_qsize = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * m_data.qsize);
   m_tu_ne = TeamUtils<ExecSpace>(m_tp_ne);
   m_tu_ne_qsize = TeamUtils<ExecSpace>(m_tp_ne_qsize);
+  m_hv_batches.clear();
   if (m_data.nu_q > 0 && m_data.hv_q > 0) {
-    m_tp_ne_hv_q = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * m_data.hv_q);
-    m_tu_ne_hv_q = TeamUtils<ExecSpace>(m_tp_ne_hv_q);
+    const auto q_message_bytes =
+      calc_hv_q_message_bytes(Context::singleton().get<Connectivity>());
+    m_data.hv_q_batch = calc_hv_q_batch(q_message_bytes, m_data.hv_q);
+    for (int q0 = 0; q0 < m_data.hv_q; q0 += m_data.hv_q_batch) {
+      const int nq = std::min(m_data.hv_q_batch, m_data.hv_q - q0);
+      m_hv_batches.emplace_back(
+        q0, nq, Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * nq));
+    }
   }
 
   m_sphere_ops.allocate_buffers(m_tu_ne_qsize);
 
   if (Context::singleton().get<Connectivity>().get_comm().root())
     printf("compose> nelemd %d qsize %d hv_q %d hv_subcycle_q %d lim %d "
-           "independent_time_steps %d\n",
+           "independent_time_steps %d hv_q_batch %d\n",
            m_data.nelemd, m_data.qsize, m_data.hv_q, m_data.hv_subcycle_q,
-           m_data.limiter_option, (int) m_data.independent_time_steps);
+           m_data.limiter_option, (int) m_data.independent_time_steps,
+           m_data.hv_q_batch);
 }
 
 int ComposeTransportImpl::requested_buffer_size () const {
@@ -162,18 +208,25 @@ void ComposeTransportImpl::init_boundary_exchanges () {
 
   // For optional HV applied to q.
   if (m_data.hv_q > 0 && m_data.nu_q > 0) {
-    for (int i = 0; i < 2; ++i) {
-      m_hv_dss_be[i] = std::make_shared<BoundaryExchange>();
-      auto be = m_hv_dss_be[i];
-      be->set_label(std::string("ComposeTransport-q-HV-" + std::to_string(i)));
-      be->set_diagnostics_level(sp.internal_diagnostics_level);
-      be->set_buffers_manager(bm_exchange);
-      be->set_num_fields(0, 0, m_data.hv_q);
-      if (i == 0) 
-        be->register_field(m_tracers.qtens_biharmonic, m_data.hv_q, 0);
-      else
-        be->register_field(m_tracers.Q, m_data.hv_q, 0);
-      be->registration_completed();
+    // Two batches can be in flight at once, so they need separate buffers.
+    if (m_hv_batches.size() > 1 && ! m_hv_bm)
+      m_hv_bm = std::make_shared<MpiBuffersManager>(bm_exchange->get_connectivity());
+    for (size_t ib = 0; ib < m_hv_batches.size(); ++ib) {
+      auto& b = m_hv_batches[ib];
+      for (int i = 0; i < 2; ++i) {
+        b.dss_be[i] = std::make_shared<BoundaryExchange>();
+        auto be = b.dss_be[i];
+        be->set_label(std::string("ComposeTransport-q-HV-" + std::to_string(i) +
+                                  "-" + std::to_string(ib)));
+        be->set_diagnostics_level(sp.internal_diagnostics_level);
+        be->set_buffers_manager(ib % 2 == 0 ? bm_exchange : m_hv_bm);
+        be->set_num_fields(0, 0, b.nq);
+        if (i == 0) 
+          be->register_field(m_tracers.qtens_biharmonic, b.nq, b.q0);
+        else
+          be->register_field(m_tracers.Q, b.nq, b.q0);
+        be->registration_completed();
+      }
     }
   }
 }
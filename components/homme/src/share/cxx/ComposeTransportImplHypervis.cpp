@@ -18,8 +18,9 @@ void ComposeTransportImpl::advance_hypervis_scalar (const Real dt_q) {
   const auto Qtens = m_tracers.qtens_biharmonic;
   const auto Q = m_tracers.Q;
   const auto spheremp = m_geometry.m_spheremp;
-  const auto tu_ne_hv_q = m_tu_ne_hv_q;
+  const auto rspheremp = m_geometry.m_rspheremp;
   const auto sphere_ops = m_sphere_ops;
+  const int nbatch = m_hv_batches.size();
   for (int it = 0; it < m_data.hv_subcycle_q; ++it) {
     { // Qtens = Q
       const auto f = KOKKOS_LAMBDA (const int idx) {
@@ -31,45 +32,65 @@ void ComposeTransportImpl::advance_hypervis_scalar (const Real dt_q) {
       launch_ie_q_ij_nlev<num_lev_pack>(hv_q, f);
     }
     // biharmonic_wk_scalar
-    const auto laplace_simple_Qtens = [&] () {
+    const auto laplace_simple_Qtens = [&] (const HvBatch& b) {
+      const auto q0 = b.q0, nq = b.nq;
+      const auto tu = b.tu;
       const auto f = KOKKOS_LAMBDA (const MT& team) {
-        KernelVariables kv(team, hv_q, tu_ne_hv_q);
-        const auto Qtens_ie = Homme::subview(Qtens, kv.ie, kv.iq);
+        KernelVariables kv(team, nq, tu);
+        const auto Qtens_ie = Homme::subview(Qtens, kv.ie, q0 + kv.iq);
         sphere_ops.laplace_simple(kv, Qtens_ie, Qtens_ie);
       };
       Kokkos::fence();
-      Kokkos::parallel_for(m_tp_ne_hv_q, f);
+      Kokkos::parallel_for(b.tp, f);
     };
-    laplace_simple_Qtens();
-    m_hv_dss_be[0]->exchange(m_geometry.m_rspheremp);
-    if (m_data.hv_scaling == 0) {
-      Kokkos::fence();
-      laplace_simple_Qtens();
-    } else {
-      const auto tensorvisc = m_geometry.m_tensorvisc;
-      const auto f = KOKKOS_LAMBDA (const MT& team) {
-        KernelVariables kv(team, hv_q, tu_ne_hv_q);
-        const auto Qtens_ie = Homme::subview(Qtens, kv.ie, kv.iq);
-        sphere_ops.laplace_tensor(kv, Homme::subview(tensorvisc, kv.ie),
-                                  Qtens_ie, Qtens_ie);
-      };
-      Kokkos::fence();
-      Kokkos::parallel_for(m_tp_ne_hv_q, f);
-    }
-    { // Compute Q = Q spheremp - dt nu_q Qtens. N.B. spheremp is already in
-      // Qtens from divergence_sphere_wk.
+    const auto laplace_Qtens = [&] (const HvBatch& b) {
+      if (m_data.hv_scaling == 0) {
+        laplace_simple_Qtens(b);
+      } else {
+        const auto q0 = b.q0, nq = b.nq;
+        const auto tu = b.tu;
+        const auto tensorvisc = m_geometry.m_tensorvisc;
+        const auto f = KOKKOS_LAMBDA (const MT& team) {
+          KernelVariables kv(team, nq, tu);
+          const auto Qtens_ie = Homme::subview(Qtens, kv.ie, q0 + kv.iq);
+          sphere_ops.laplace_tensor(kv, Homme::subview(tensorvisc, kv.ie),
+                                    Qtens_ie, Qtens_ie);
+        };
+        Kokkos::fence();
+        Kokkos::parallel_for(b.tp, f);
+      }
+    };
+    // Compute Q = Q spheremp - dt nu_q Qtens. N.B. spheremp is already in
+    // Qtens from divergence_sphere_wk.
+    const auto update_Q = [&] (const HvBatch& b) {
+      const auto q0 = b.q0, nq = b.nq;
       const auto f = KOKKOS_LAMBDA (const int idx) {
         int ie, q, i, j, lev;
-        idx_ie_q_ij_nlev<num_lev_pack>(hv_q, idx, ie, q, i, j, lev);
+        idx_ie_q_ij_nlev<num_lev_pack>(nq, idx, ie, q, i, j, lev);
+        q += q0;
         Q(ie,q,i,j,lev) = (Q(ie,q,i,j,lev) * spheremp(ie,i,j)
                            - dt * nu_q * Qtens(ie,q,i,j,lev));
       };
       Kokkos::fence();
-      launch_ie_q_ij_nlev<num_lev_pack>(hv_q, f);
+      launch_ie_q_ij_nlev<num_lev_pack>(nq, f);
+    };
+    // Pipeline the batches: the messages of batch ib-1 are in flight while
+    // batch ib is computed. DSS of Qtens, then halo exchange of Q, both
+    // applying rspheremp.
+    for (int ib = 0; ib < nbatch; ++ib) {
+      laplace_simple_Qtens(m_hv_batches[ib]);
+      m_hv_batches[ib].dss_be[0]->pack_and_send();
+      if (ib > 0) m_hv_batches[ib-1].dss_be[0]->recv_and_unpack(rspheremp);
+    }
+    m_hv_batches[nbatch-1].dss_be[0]->recv_and_unpack(rspheremp);
+    for (int ib = 0; ib < nbatch; ++ib) {
+      laplace_Qtens(m_hv_batches[ib]);
+      update_Q(m_hv_batches[ib]);
+      Kokkos::fence();
+      m_hv_batches[ib].dss_be[1]->pack_and_send();
+      if (ib > 0) m_hv_batches[ib-1].dss_be[1]->recv_and_unpack(rspheremp);
     }
-    // Halo exchange Q and apply rspheremp.
-    Kokkos::fence();
-    m_hv_dss_be[1]->exchange(m_geometry.m_rspheremp);
+    m_hv_batches[nbatch-1].dss_be[1]->recv_and_unpack(rspheremp);
   }
 }
 
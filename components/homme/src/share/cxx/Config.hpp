@@ -29,6 +29,10 @@
 # define HOMMEXX_MPI_ON_DEVICE 1
 #endif
 
+#ifndef HOMMEXX_MPI_SHARED_MEMORY
+# define HOMMEXX_MPI_SHARED_MEMORY 0
+#endif
+
 #include <Kokkos_Core.hpp>
 
 #ifdef HOMMEXX_ENABLE_GPU 
@@ -18,6 +18,7 @@
 #include "HybridVCoord.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "Tracers.hpp"
 #include "profiling.hpp"
 #include "mpi/BoundaryExchange.hpp"
@@ -423,7 +424,8 @@ public:
       *this);
     Kokkos::fence();
     m_kernel_will_run_limiters = true;
-    Kokkos::parallel_for(
+    tuned_parallel_for(
+      "esf advect and limit tracers",
       //to play with launch bounds
       //Homme::get_default_team_policy<ExecSpace, AALTracerPhase, Kokkos::LaunchBounds<128,1> >(
       Homme::get_default_team_policy<ExecSpace, AALTracerPhase >(
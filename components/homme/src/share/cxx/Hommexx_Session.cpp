@@ -47,6 +47,7 @@ void print_homme_config_settings () {
     std::cout << "HOMMEXX vector tag: " << Scalar::label() << "\n";
     std::cout << "HOMMEXX active AVX set:" << active_avx_string() << "\n";
     std::cout << "HOMMEXX MPI_ON_DEVICE: " << HOMMEXX_MPI_ON_DEVICE << "\n";
+    std::cout << "HOMMEXX MPI_SHARED_MEMORY: " << HOMMEXX_MPI_SHARED_MEMORY << "\n";
 #ifdef HOMMEXX_CUDA_SHARE_BUFFER
     std::cout << "HOMMEXX CUDA_SHARE_BUFFER: on\n";
 #else
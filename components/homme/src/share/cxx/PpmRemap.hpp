@@ -170,21 +170,41 @@ struct PpmVertRemap : public VertRemapAlg {
                 "boundary condition");
   const int gs = _ppm_consts::gs;
 
-  explicit PpmVertRemap(const int num_elems, const int num_remap)
+  // batch_size is the max number of variables remapped together by one team
+  // in the batched version of compute_remap_phase
+  explicit PpmVertRemap(const int num_elems, const int num_remap, const int batch_size = 1)
       : m_dpo("dpo", num_elems)
       , m_pio("pio", num_elems)
       , m_pin("pin", num_elems)
       , m_ppmdx("ppmdx", num_elems)
       , m_z2("z2", num_elems)
       , m_kid("kid", num_elems)
+      , m_batch_size(batch_size)
       , m_ppm_tu(get_default_team_policy<ExecSpace>(num_elems * num_remap))
-      , m_ao("a0", m_ppm_tu.get_num_ws_slots())
-      , m_mass_o("mass_o",m_ppm_tu.get_num_ws_slots())
-      , m_dma("dma", m_ppm_tu.get_num_ws_slots())
-      , m_ai("ai", m_ppm_tu.get_num_ws_slots())
-      , m_parabola_coeffs("Coefficients for the interpolating parabola", m_ppm_tu.get_num_ws_slots())
+      , m_ppm_tu_batched(get_default_team_policy<ExecSpace>(num_elems * ((num_remap + batch_size - 1) / batch_size)))
+      , m_ao("a0", num_ws_slots())
+      , m_mass_o("mass_o",num_ws_slots())
+      , m_dma("dma", num_ws_slots())
+      , m_ai("ai", num_ws_slots())
+      , m_parabola_coeffs("Coefficients for the interpolating parabola", num_ws_slots())
   {
-    // Nothing to do here
+    assert(batch_size > 0);
+  }
+
+  // The batched compute_remap_phase needs each team to own batch_size slots
+  // of the tracer-dependent buffers
+  int num_ws_slots () const {
+    return std::max(m_ppm_tu.get_num_ws_slots(),
+                    m_ppm_tu_batched.get_num_ws_slots() * m_batch_size);
+  }
+
+  int batch_size () const { return m_batch_size; }
+
+  // Team scratch memory needed by the batched compute_remap_phase, which stages
+  // the integral bounds of the element once for all the variables of the batch
+  static size_t remap_phase_team_shmem_size () {
+    return ScratchView<int[NP][NP][NUM_PHYSICAL_LEV]>::shmem_size() +
+           ScratchView<Real[NP][NP][NUM_PHYSICAL_LEV]>::shmem_size();
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -209,52 +229,107 @@ struct PpmVertRemap : public VertRemapAlg {
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
 
+      remap_column(kv, kv.team_idx, igp, jgp,
+                   Homme::subview(m_kid, kv.ie, igp, jgp),
+                   Homme::subview(m_z2, kv.ie, igp, jgp),
+                   Homme::subview(remap_var, igp, jgp));
+    }); // End team thread range
+    kv.team_barrier();
+  }
+
+  // Batched version of compute_remap_phase: remaps num_vars <= batch_size()
+  // variables, where remap_vars(ivar) returns the ivar-th one. The team threads
+  // are spread over both the variables and the gll points, and the integral
+  // bounds computed in compute_grids_phase are copied once in team scratch
+  // memory and shared by all the variables. The team policy must provide
+  // remap_phase_team_shmem_size() bytes of team scratch memory.
+  // Note: this only changes how (var,gll) pairs are distributed over teams and
+  //       threads. Each variable is still remapped by its own thread, with the
+  //       vector lanes over the levels, so there is no vectorization across
+  //       variables.
+  template <typename RemapVars>
+  KOKKOS_INLINE_FUNCTION
+  void compute_remap_phase(KernelVariables &kv, const int num_vars,
+                           const RemapVars &remap_vars) const {
+    assert(num_vars <= m_batch_size);
+
+    ScratchView<int[NP][NP][NUM_PHYSICAL_LEV]> kid(kv.team.team_scratch(0));
+    ScratchView<Real[NP][NP][NUM_PHYSICAL_LEV]> z2(kv.team.team_scratch(0));
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
+                         [&](const int &loop_idx) {
+      const int igp = loop_idx / NP;
+      const int jgp = loop_idx % NP;
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
                            [&](const int k) {
-        const int ilevel = k / VECTOR_SIZE;
-        const int ivector = k % VECTOR_SIZE;
-        m_ao(kv.team_idx, igp, jgp, k + _ppm_consts::INITIAL_PADDING) =
-            remap_var(igp, jgp, ilevel)[ivector] /
-            m_dpo(kv.ie, igp, jgp, k + _ppm_consts::INITIAL_PADDING);
+        kid(igp, jgp, k) = m_kid(kv.ie, igp, jgp, k);
+        z2(igp, jgp, k) = m_z2(kv.ie, igp, jgp, k);
       });
+    });
+    kv.team_barrier();
 
-      boundaries::fill_cell_means_gs(kv, Homme::subview(m_dpo, kv.ie, igp, jgp),
-                                     Homme::subview(m_ao, kv.team_idx, igp, jgp));
-
-      Dispatch<ExecSpace>::parallel_scan(
-          kv.team, NUM_PHYSICAL_LEV,
-          [=](const int &k, Real &accumulator, const bool last) {
-            // Accumulate the old mass up to old grid cell interface locations
-            // to simplify integration during remapping. Also, divide out the
-            // grid spacing so we're working with actual tracer values and can
-            // conserve mass.
-            const int ilevel = k / VECTOR_SIZE;
-            const int ivector = k % VECTOR_SIZE;
-            accumulator += remap_var(igp, jgp, ilevel)[ivector];
-            if (last) {
-              m_mass_o(kv.team_idx, igp, jgp, k + 1) = accumulator;
-            }
-      });
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, num_vars * NP * NP),
+                         [&](const int &loop_idx) {
+      const int ivar = loop_idx / (NP * NP);
+      const int igp = (loop_idx / NP) % NP;
+      const int jgp = loop_idx % NP;
 
-      // Computes a monotonic and conservative PPM reconstruction
-      compute_ppm(kv,
-                  Homme::subview(m_ao, kv.team_idx, igp, jgp),
-                  Homme::subview(m_ppmdx, kv.ie, igp, jgp),
-                  Homme::subview(m_dma, kv.team_idx, igp, jgp),
-                  Homme::subview(m_ai, kv.team_idx, igp, jgp),
-                  Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp));
-
-      compute_remap(kv,
-                    Homme::subview(m_kid, kv.ie, igp, jgp),
-                    Homme::subview(m_z2, kv.ie, igp, jgp),
-                    Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp),
-                    Homme::subview(m_mass_o, kv.team_idx, igp, jgp),
-                    Homme::subview(m_dpo, kv.ie, igp, jgp),
-                    Homme::subview(remap_var, igp, jgp));
-    }); // End team thread range
+      remap_column(kv, kv.team_idx * m_batch_size + ivar, igp, jgp,
+                   Homme::subview(kid, igp, jgp),
+                   Homme::subview(z2, igp, jgp),
+                   Homme::subview(remap_vars(ivar), igp, jgp));
+    });
     kv.team_barrier();
   }
 
+  // Remaps one column, using the slot-th entry of the tracer-dependent buffers
+  template <typename KidView, typename BoundsView>
+  KOKKOS_INLINE_FUNCTION
+  void remap_column(KernelVariables &kv, const int slot,
+                    const int igp, const int jgp,
+                    const KidView &k_id, const BoundsView &integral_bounds,
+                    ExecViewUnmanaged<Scalar[NUM_LEV]> remap_var) const {
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
+                         [&](const int k) {
+      const int ilevel = k / VECTOR_SIZE;
+      const int ivector = k % VECTOR_SIZE;
+      m_ao(slot, igp, jgp, k + _ppm_consts::INITIAL_PADDING) =
+          remap_var(ilevel)[ivector] /
+          m_dpo(kv.ie, igp, jgp, k + _ppm_consts::INITIAL_PADDING);
+    });
+
+    boundaries::fill_cell_means_gs(kv, Homme::subview(m_dpo, kv.ie, igp, jgp),
+                                   Homme::subview(m_ao, slot, igp, jgp));
+
+    Dispatch<ExecSpace>::parallel_scan(
+        kv.team, NUM_PHYSICAL_LEV,
+        [=](const int &k, Real &accumulator, const bool last) {
+          // Accumulate the old mass up to old grid cell interface locations
+          // to simplify integration during remapping. Also, divide out the
+          // grid spacing so we're working with actual tracer values and can
+          // conserve mass.
+          const int ilevel = k / VECTOR_SIZE;
+          const int ivector = k % VECTOR_SIZE;
+          accumulator += remap_var(ilevel)[ivector];
+          if (last) {
+            m_mass_o(slot, igp, jgp, k + 1) = accumulator;
+          }
+    });
+
+    // Computes a monotonic and conservative PPM reconstruction
+    compute_ppm(kv,
+                Homme::subview(m_ao, slot, igp, jgp),
+                Homme::subview(m_ppmdx, kv.ie, igp, jgp),
+                Homme::subview(m_dma, slot, igp, jgp),
+                Homme::subview(m_ai, slot, igp, jgp),
+                Homme::subview(m_parabola_coeffs, slot, igp, jgp));
+
+    compute_remap(kv, k_id, integral_bounds,
+                  Homme::subview(m_parabola_coeffs, slot, igp, jgp),
+                  Homme::subview(m_mass_o, slot, igp, jgp),
+                  Homme::subview(m_dpo, kv.ie, igp, jgp),
+                  remap_var);
+  }
+
   KOKKOS_FORCEINLINE_FUNCTION
   Real compute_mass(const Real sq_coeff, const Real lin_coeff,
                     const Real const_coeff, const Real prev_mass,
@@ -270,12 +345,12 @@ struct PpmVertRemap : public VertRemapAlg {
     return mass;
   }
 
-  template <typename ExecSpaceType = ExecSpace>
+  template <typename KidView, typename BoundsView, typename ExecSpaceType = ExecSpace>
   KOKKOS_INLINE_FUNCTION
   typename std::enable_if<!Homme::OnGpu<ExecSpaceType>::value, void>::type
   compute_remap(KernelVariables &/* kv */,
-      ExecViewUnmanaged<const int[NUM_PHYSICAL_LEV]> k_id,
-      ExecViewUnmanaged<const Real[NUM_PHYSICAL_LEV]> integral_bounds,
+      const KidView &k_id,
+      const BoundsView &integral_bounds,
       ExecViewUnmanaged<const Real[3][NUM_PHYSICAL_LEV]> parabola_coeffs,
       ExecViewUnmanaged<Real[_ppm_consts::MASS_O_PHYSICAL_LEV]> mass,
       ExecViewUnmanaged<const Real[_ppm_consts::DPO_PHYSICAL_LEV]> prev_dp,
@@ -306,12 +381,12 @@ struct PpmVertRemap : public VertRemapAlg {
     }
   }
 
-  template <typename ExecSpaceType = ExecSpace>
+  template <typename KidView, typename BoundsView, typename ExecSpaceType = ExecSpace>
   KOKKOS_INLINE_FUNCTION
   typename std::enable_if<Homme::OnGpu<ExecSpaceType>::value, void>::type
   compute_remap(KernelVariables &kv,
-      ExecViewUnmanaged<const int[NUM_PHYSICAL_LEV]> k_id,
-      ExecViewUnmanaged<const Real[NUM_PHYSICAL_LEV]> integral_bounds,
+      const KidView &k_id,
+      const BoundsView &integral_bounds,
       ExecViewUnmanaged<const Real[3][NUM_PHYSICAL_LEV]> parabola_coeffs,
       ExecViewUnmanaged<Real[_ppm_consts::MASS_O_PHYSICAL_LEV]> prev_mass,
       ExecViewUnmanaged<const Real[_ppm_consts::DPO_PHYSICAL_LEV]> prev_dp,
@@ -660,7 +735,9 @@ struct PpmVertRemap : public VertRemapAlg {
   ExecViewManaged<Real * [NP][NP][NUM_PHYSICAL_LEV]>  m_z2;
   ExecViewManaged<int * [NP][NP][NUM_PHYSICAL_LEV]>   m_kid;
 
+  int m_batch_size;
   TeamUtils<ExecSpace> m_ppm_tu;
+  TeamUtils<ExecSpace> m_ppm_tu_batched;
   ExecViewManaged<Real * [NP][NP][_ppm_consts::AO_PHYSICAL_LEV]> m_ao;
   ExecViewManaged<Real * [NP][NP][_ppm_consts::MASS_O_PHYSICAL_LEV]> m_mass_o;
   ExecViewManaged<Real * [NP][NP][_ppm_consts::DMA_PHYSICAL_LEV]> m_dma;
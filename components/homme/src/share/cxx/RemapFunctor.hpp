@@ -23,6 +23,7 @@
 #include "utilities/SubviewUtils.hpp"
 #include "utilities/SyncUtils.hpp"
 #include "RemapStateProvider.hpp"
+#include "TeamPolicyTuner.hpp"
 
 #include "profiling.hpp"
 
@@ -269,10 +270,10 @@ struct RemapFunctor : public Remapper {
                 "RemapFunctor not given a remap algorithm to use");
 
   struct RemapData {
-    RemapData(const int qsize_in, const int capacity_in)
-      : qsize(qsize_in), capacity(capacity_in)
+    RemapData(const int qsize_in, const int capacity_in, const int batch_size_in)
+      : qsize(qsize_in), capacity(capacity_in), batch_size(batch_size_in)
     {}
-    const int qsize, capacity;
+    const int qsize, capacity, batch_size;
     int np1;
     int np1_qdp;
     Real dt;
@@ -290,7 +291,7 @@ struct RemapFunctor : public Remapper {
 
   RemapType m_remap;
 
-  TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_nsr, m_tu_ne_ntr;
+  TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_nsr, m_tu_ne_ntr, m_tu_ne_nb;
 
   explicit
   RemapFunctor (const int qsize,
@@ -301,17 +302,22 @@ struct RemapFunctor : public Remapper {
                 // maximum capacity needed if it differs from
                 //    num_states_remap + qsize.
                 // If capacity < num_states_remap, num_states_remap is used.
-                const int capacity=-1)
+                const int capacity=-1,
+                // Number of variables remapped by each team in the remap
+                // phase. If batch_size < 1, each team remaps one variable.
+                const int batch_size=-1)
    : m_fields_provider(elements)
-   , m_data(qsize, std::max(capacity, m_fields_provider.num_states_remap() + qsize))
+   , m_data(qsize, std::max(capacity, m_fields_provider.num_states_remap() + qsize),
+            get_batch_size(batch_size, m_fields_provider.num_states_remap() + qsize))
    , m_state(elements.m_state)
    , m_hvcoord(hvcoord)
    , m_qdp(tracers.qdp)
-   , m_remap(elements.num_elems(), m_data.capacity)
+   , m_remap(elements.num_elems(), m_data.capacity, m_data.batch_size)
    // Functor tags are irrelevant below
    , m_tu_ne(remap_team_policy<ComputeThicknessTag>(m_state.num_elems()))
    , m_tu_ne_nsr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * m_fields_provider.num_states_remap()))
    , m_tu_ne_ntr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * num_to_remap()))
+   , m_tu_ne_nb(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * num_batches()))
   {
     // Members used for sanity checks
     valid_layer_thickness = decltype(valid_layer_thickness)("Check for whether the surface thicknesses are positive",elements.num_elems());
@@ -345,6 +351,10 @@ struct RemapFunctor : public Remapper {
   KOKKOS_INLINE_FUNCTION
   int num_to_remap() const { return m_fields_provider.num_states_remap() + m_data.qsize; }
 
+  // Number of batches of (at most) batch_size variables in the remap phase
+  KOKKOS_INLINE_FUNCTION
+  int num_batches() const { return (num_to_remap() + m_data.batch_size - 1) / m_data.batch_size; }
+
   KOKKOS_INLINE_FUNCTION
   ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]>
   get_remap_val(const KernelVariables &kv, int var) const {
@@ -412,13 +422,21 @@ struct RemapFunctor : public Remapper {
   // This asserts if num_to_remap() == 0
   KOKKOS_INLINE_FUNCTION
   void operator()(ComputeRemapTag, const TeamMember &team) const {
-    KernelVariables kv(team, m_tu_ne_ntr);
+    KernelVariables kv(team, m_tu_ne_nb);
     assert(num_to_remap() != 0);
-    const int var = kv.ie % num_to_remap();
-    kv.ie /= num_to_remap();
+    const int ib = kv.ie % num_batches();
+    kv.ie /= num_batches();
     assert(kv.ie < m_state.num_elems());
 
-    this->m_remap.compute_remap_phase(kv, get_remap_val(kv, var));
+    if (m_data.batch_size == 1) {
+      this->m_remap.compute_remap_phase(kv, get_remap_val(kv, ib));
+    } else {
+      const int var_beg = ib * m_data.batch_size;
+      const int num_vars = std::min(m_data.batch_size, num_to_remap() - var_beg);
+      this->m_remap.compute_remap_phase(kv, num_vars, [&](const int ivar) {
+        return get_remap_val(kv, var_beg + ivar);
+      });
+    }
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -474,7 +492,9 @@ struct RemapFunctor : public Remapper {
       run_functor<ComputeGridsTag>("Remap Compute Grids Functor",
                                    m_state.num_elems());
       run_functor<ComputeRemapTag>("Remap Compute Remap Functor",
-                                   m_state.num_elems() * num_to_remap());
+                                   m_state.num_elems() * num_batches(),
+                                   m_data.batch_size > 1 ?
+                                     RemapType::remap_phase_team_shmem_size() : 0);
       if (nonzero_rsplit) {
         run_functor<ComputeIntrinsicsTag>("Remap Rescale States Functor",
                                           m_state.num_elems() * m_fields_provider.num_states_remap());
@@ -547,6 +567,14 @@ struct RemapFunctor : public Remapper {
   }
 
 private:
+  // By default, each (element, variable) pair gets its own team, on all
+  // backends. Batching is opt-in: we have no timings yet showing which batch
+  // size (if any) pays off on a given architecture.
+  static int get_batch_size (const int batch_size, const int num_to_remap) {
+    const int bs = batch_size < 1 ? 1 : batch_size;
+    return std::max(1, std::min(bs, num_to_remap));
+  }
+
   template <typename FunctorTag>
   typename std::enable_if<OnGpu<ExecSpace>::value == false,
                           Kokkos::TeamPolicy<ExecSpace, FunctorTag> >::type
@@ -566,12 +594,16 @@ private:
   }
 
   template <typename FunctorTag>
-  void run_functor(const std::string functor_name, int num_exec) {
-    const auto policy = remap_team_policy<FunctorTag>(num_exec);
+  void run_functor(const std::string functor_name, int num_exec,
+                   const size_t team_shmem_size = 0) {
+    auto policy = remap_team_policy<FunctorTag>(num_exec);
+    if (team_shmem_size > 0) {
+      policy.set_scratch_size(0, Kokkos::PerTeam(team_shmem_size));
+    }
     // Timers don't work on CUDA, so place them here
     GPTLstart(functor_name.c_str());
     profiling_resume();
-    Kokkos::parallel_for("vertical remap", policy, *this);
+    tuned_parallel_for("vertical remap " + functor_name, policy, *this);
     Kokkos::fence();
     profiling_pause();
     GPTLstop(functor_name.c_str());
@@ -0,0 +1,211 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#include "TeamPolicyTuner.hpp"
+
+#include "Dimensions.hpp"
+#include "mpi/Comm.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#ifdef KOKKOS_ENABLE_CUDA
+# include <cuda_runtime.h>
+#endif
+
+#ifdef KOKKOS_ENABLE_HIP
+# include <hip/hip_runtime.h>
+#endif
+
+namespace Homme {
+
+namespace {
+
+std::string get_hardware_id () {
+  std::string id = ExecSpace::name();
+#if defined(HOMMEXX_ENABLE_GPU) && defined(KOKKOS_ENABLE_CUDA)
+  int dev;
+  cudaDeviceProp prop;
+  if (cudaGetDevice(&dev)==cudaSuccess && cudaGetDeviceProperties(&prop,dev)==cudaSuccess) {
+    id += std::string("_") + prop.name;
+  }
+#elif defined(HOMMEXX_ENABLE_GPU) && defined(KOKKOS_ENABLE_HIP)
+  int dev;
+  hipDeviceProp_t prop;
+  if (hipGetDevice(&dev)==hipSuccess && hipGetDeviceProperties(&prop,dev)==hipSuccess) {
+    id += std::string("_") + prop.name;
+  }
+#endif
+  id += "_" + std::to_string(ExecSpace().concurrency());
+
+  // The id is the first token of each line in the cache file
+  std::replace(id.begin(),id.end(),' ','_');
+  return id;
+}
+
+} // anonymous namespace
+
+TeamPolicyTuner::TeamPolicyTuner (const int num_elems)
+ : m_enabled (false)
+ , m_root (Context::singleton().get<Comm>().root())
+ , m_mpi_comm (Context::singleton().get<Comm>().mpi_comm())
+ , m_num_elems (num_elems)
+ , m_num_ranks (Context::singleton().get<Comm>().size())
+{
+  const char* cache_file = std::getenv("HOMMEXX_TEAM_TUNING_CACHE");
+  if (cache_file==nullptr || std::string(cache_file).empty()) {
+    return;
+  }
+
+  if (!OnGpu<ExecSpace>::value) {
+    if (m_root) {
+      std::cout << "HOMMEXX team shape autotuning is only available on GPU. "
+                   "Ignoring HOMMEXX_TEAM_TUNING_CACHE.\n";
+    }
+    return;
+  }
+
+  m_enabled = true;
+  m_cache_file = cache_file;
+  // Key the cache on root's hardware, and on the global problem size, so that
+  // all ranks find the same cached entries
+  m_hardware = get_hardware_id();
+  int hw_size = m_hardware.size();
+  MPI_Bcast(&hw_size,1,MPI_INT,0,m_mpi_comm);
+  m_hardware.resize(hw_size);
+  MPI_Bcast(&m_hardware[0],hw_size,MPI_CHAR,0,m_mpi_comm);
+  MPI_Allreduce(MPI_IN_PLACE,&m_num_elems,1,MPI_INT,MPI_SUM,m_mpi_comm);
+
+#if defined(KOKKOS_ENABLE_CUDA)
+  const int warp_size = Kokkos::Impl::CudaTraits::WarpSize;
+#elif defined(KOKKOS_ENABLE_HIP)
+  const int warp_size = Kokkos::Impl::HIPTraits::WarpSize;
+#else
+  const int warp_size = 32;
+#endif
+  for (int nwarps=2; nwarps<=HOMMEXX_CUDA_MAX_WARP_PER_TEAM; nwarps*=2) {
+    m_team_threads.push_back(nwarps*warp_size);
+  }
+  for (int vl=4; vl<=warp_size; vl*=2) {
+    m_vector_lengths.push_back(vl);
+  }
+
+  load();
+
+  if (m_root) {
+    std::cout << "HOMMEXX team shape autotuning is on.\n"
+              << "  cache file: " << m_cache_file << "\n"
+              << "  hardware: " << m_hardware << ", nlev: " << NUM_PHYSICAL_LEV
+              << ", nelem: " << m_num_elems << ", nranks: " << m_num_ranks << "\n"
+              << "  cached kernels: " << m_entries.size() << "\n"
+              << "  WARNING: results are not BFB with runs using the default team shapes.\n";
+  }
+}
+
+TeamPolicyTuner::~TeamPolicyTuner ()
+{
+  save();
+}
+
+void TeamPolicyTuner::load ()
+{
+  // Only root reads the file, so that all ranks get the same entries
+  std::string content;
+  if (m_root) {
+    std::ifstream file(m_cache_file);
+    std::stringstream ss;
+    ss << file.rdbuf();
+    content = ss.str();
+  }
+  int size = content.size();
+  MPI_Bcast(&size,1,MPI_INT,0,m_mpi_comm);
+  content.resize(size);
+  MPI_Bcast(&content[0],size,MPI_CHAR,0,m_mpi_comm);
+
+  // Each line of the cache file is
+  //   <hardware> <nlev> <nelem> <nranks> <team size> <vector length> <kernel name>
+  // where the kernel name may contain spaces.
+  std::istringstream file(content);
+  std::string line;
+  while (std::getline(file,line)) {
+    std::istringstream ss(line);
+    std::string hw, name;
+    int nlev, nelem, nranks;
+    Shape shape;
+    if (!(ss >> hw >> nlev >> nelem >> nranks >> shape.first >> shape.second) ||
+        !same_config(hw,nlev,nelem,nranks)) {
+      continue;
+    }
+    std::getline(ss >> std::ws,name);
+    if (name.empty()) {
+      continue;
+    }
+    auto& e = m_entries[name];
+    e.best = shape;
+    e.tuned = true;
+  }
+}
+
+bool TeamPolicyTuner::same_config (const std::string& hw, const int nlev,
+                                   const int nelem, const int nranks) const
+{
+  return hw==m_hardware && nlev==NUM_PHYSICAL_LEV && nelem==m_num_elems && nranks==m_num_ranks;
+}
+
+int TeamPolicyTuner::pick_best (std::vector<double>& times) const
+{
+  MPI_Allreduce(MPI_IN_PLACE,times.data(),times.size(),MPI_DOUBLE,MPI_MAX,m_mpi_comm);
+  int best = std::min_element(times.begin(),times.end()) - times.begin();
+  MPI_Bcast(&best,1,MPI_INT,0,m_mpi_comm);
+  return best;
+}
+
+void TeamPolicyTuner::save () const
+{
+  if (!m_enabled || !m_root) {
+    return;
+  }
+
+  bool any_tuned = false;
+  for (const auto& it : m_entries) {
+    any_tuned |= it.second.tuned;
+  }
+  if (!any_tuned) {
+    return;
+  }
+
+  // Keep the lines of other configurations, and replace the ones of this configuration
+  std::vector<std::string> lines;
+  {
+    std::ifstream file(m_cache_file);
+    std::string line;
+    while (std::getline(file,line)) {
+      std::istringstream ss(line);
+      std::string hw;
+      int nlev, nelem, nranks;
+      if (ss >> hw >> nlev >> nelem >> nranks && same_config(hw,nlev,nelem,nranks)) {
+        continue;
+      }
+      lines.push_back(line);
+    }
+  }
+
+  std::ofstream file(m_cache_file);
+  for (const auto& line : lines) {
+    file << line << "\n";
+  }
+  for (const auto& it : m_entries) {
+    const auto& e = it.second;
+    if (e.tuned) {
+      file << m_hardware << " " << NUM_PHYSICAL_LEV << " " << m_num_elems << " " << m_num_ranks << " "
+           << e.best.first << " " << e.best.second << " " << it.first << "\n";
+    }
+  }
+}
+
+} // namespace Homme
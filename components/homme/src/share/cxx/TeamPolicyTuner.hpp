@@ -0,0 +1,217 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#ifndef HOMMEXX_TEAM_POLICY_TUNER_HPP
+#define HOMMEXX_TEAM_POLICY_TUNER_HPP
+
+#include "Context.hpp"
+#include "ExecSpaceDefs.hpp"
+
+#include <Kokkos_Core.hpp>
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Homme
+{
+
+/*
+ * Autotuning of the team shape (team size, vector length) of the main kernels.
+ *
+ * Tuning is enabled by setting the env var HOMMEXX_TEAM_TUNING_CACHE to the name
+ * of a cache file. The first launches of each kernel dispatched via this class
+ * then cycle through a set of candidate team shapes, timing each of them, and
+ * the fastest shape is used for the rest of the run. Since only the team shape
+ * changes, each of these launches does the actual work of the kernel.
+ * Each candidate is timed on all ranks, and its time is the max over ranks. The
+ * winner is the candidate with the smallest time, as chosen by the root rank, so
+ * that all ranks use the same shape.
+ * At the end of the run, the root rank saves the tuned shapes in the cache file,
+ * keyed by hardware, number of levels, global number of elements and number of
+ * ranks, so that later runs with the same key skip the tuning. The cache file is
+ * read by the root rank only, and its content is broadcast to all ranks.
+ *
+ * NOTE: enabling the tuner is NOT BFB. The team shape changes the order of
+ *       operations of the team/vector reductions (and scans) in the kernels, so
+ *       results differ (at round-off level) from runs with the default shapes,
+ *       and from runs where the tuner picked different shapes.
+ *
+ * Tuning is only done on GPU. On CPU, TeamUtils computes the workspace index of
+ * a team from the team size the functor buffers were sized with, so kernels
+ * must run with the default team shape.
+ */
+class TeamPolicyTuner {
+public:
+  using Shape = std::pair<int,int>; // (team size, vector length)
+
+  // Collective on the Homme comm (num_elems is the number of local elements)
+  explicit TeamPolicyTuner (const int num_elems);
+  ~TeamPolicyTuner ();
+
+  bool enabled () const { return m_enabled; }
+
+  template<typename PolicyType, typename FunctorType>
+  void parallel_for (const std::string& name, const PolicyType& policy, const FunctorType& f) {
+    launch(name, policy, f, Kokkos::ParallelForTag(),
+           [&](const PolicyType& p) { Kokkos::parallel_for(name, p, f); });
+  }
+
+  template<typename PolicyType, typename FunctorType, typename ValueType>
+  void parallel_reduce (const std::string& name, const PolicyType& policy, const FunctorType& f,
+                        ValueType& result) {
+    launch(name, policy, f, Kokkos::ParallelReduceTag(),
+           [&](const PolicyType& p) { Kokkos::parallel_reduce(name, p, f, result); });
+  }
+
+  // Write the tuned shapes in the cache file (root rank only).
+  // This is also called upon destruction.
+  void save () const;
+
+private:
+
+  struct Entry {
+    std::vector<Shape>  candidates;
+    std::vector<double> times;
+    int                 num_calls = 0;
+    Shape               best;
+    bool                tuned     = false;
+    bool                validated = false;
+  };
+
+  // Number of timed launches for each candidate shape
+  static constexpr int num_reps = 3;
+
+  template<typename PolicyType>
+  static PolicyType make_policy (const PolicyType& policy, const Shape& shape) {
+    PolicyType p(policy.league_size(), shape.first, shape.second);
+    p.set_chunk_size(policy.chunk_size());
+    if (policy.team_scratch_size(0)>0 || policy.thread_scratch_size(0)>0) {
+      p.set_scratch_size(0, Kokkos::PerTeam(policy.team_scratch_size(0)),
+                            Kokkos::PerThread(policy.thread_scratch_size(0)));
+    }
+    return p;
+  }
+
+  template<typename PolicyType, typename FunctorType, typename LaunchTag>
+  static bool is_valid (const PolicyType& policy, const Shape& shape,
+                        const FunctorType& f, const LaunchTag& tag) {
+    return shape.first>=1 &&
+           shape.first<=make_policy(policy,Shape(1,shape.second)).team_size_max(f,tag);
+  }
+
+  template<typename PolicyType, typename FunctorType, typename LaunchTag>
+  std::vector<Shape> get_candidates (const PolicyType& policy, const FunctorType& f,
+                                     const LaunchTag& tag) const {
+    // The default shape goes first, so that if it is the fastest it wins ties
+    std::vector<Shape> candidates(1,Shape(policy.team_size(),policy.impl_vector_length()));
+    for (const int vl : m_vector_lengths) {
+      for (const int nthreads : m_team_threads) {
+        const Shape s (nthreads/vl, vl);
+        if (s!=candidates.front() && is_valid(policy,s,f,tag)) {
+          candidates.push_back(s);
+        }
+      }
+    }
+    return candidates;
+  }
+
+  template<typename PolicyType, typename FunctorType, typename LaunchTag, typename LaunchType>
+  void launch (const std::string& name, const PolicyType& policy, const FunctorType& f,
+               const LaunchTag& tag, const LaunchType& run) {
+    if (!m_enabled) {
+      run(policy);
+      return;
+    }
+
+    auto& e = m_entries[name];
+    if (e.tuned && !e.validated) {
+      // A cached shape may be stale, e.g. if the kernel changed since it was tuned
+      e.validated = true;
+      if (!is_valid(policy,e.best,f,tag)) {
+        e = Entry();
+      }
+    }
+    if (e.tuned) {
+      run(make_policy(policy,e.best));
+      return;
+    }
+
+    if (e.candidates.empty()) {
+      e.candidates = get_candidates(policy,f,tag);
+      e.times.assign(e.candidates.size(),std::numeric_limits<double>::max());
+    }
+
+    const int ic = e.num_calls / num_reps;
+    Kokkos::fence();
+    Kokkos::Timer timer;
+    run(make_policy(policy,e.candidates[ic]));
+    Kokkos::fence();
+    e.times[ic] = std::min(e.times[ic],timer.seconds());
+
+    ++e.num_calls;
+    if (e.num_calls==num_reps*static_cast<int>(e.candidates.size())) {
+      // All ranks launch the same kernels, and, on the same hardware, get the same
+      // candidates, so they all get here at the same launch.
+      e.best = e.candidates[pick_best(e.times)];
+      e.tuned = e.validated = true;
+    }
+  }
+
+  // Take the max over ranks of each candidate time, and return the index of the
+  // fastest candidate, as computed on the root rank
+  int pick_best (std::vector<double>& times) const;
+
+  void load ();
+
+  bool same_config (const std::string& hw, const int nlev, const int nelem, const int nranks) const;
+
+  bool        m_enabled;
+  bool        m_root;
+  MPI_Comm    m_mpi_comm;
+  int         m_num_elems;   // Global number of elements
+  int         m_num_ranks;
+  std::string m_cache_file;
+  std::string m_hardware;
+
+  // Candidate threads per team and vector lengths
+  std::vector<int> m_team_threads;
+  std::vector<int> m_vector_lengths;
+
+  std::map<std::string,Entry> m_entries;
+};
+
+// Launch a team kernel via the TeamPolicyTuner stored in the Context, if any.
+// Otherwise, simply call the corresponding Kokkos function.
+template<typename PolicyType, typename FunctorType>
+void tuned_parallel_for (const std::string& name, const PolicyType& policy, const FunctorType& f) {
+  const auto& c = Context::singleton();
+  if (c.has<TeamPolicyTuner>()) {
+    c.get<TeamPolicyTuner>().parallel_for(name,policy,f);
+  } else {
+    Kokkos::parallel_for(name,policy,f);
+  }
+}
+
+template<typename PolicyType, typename FunctorType, typename ValueType>
+void tuned_parallel_reduce (const std::string& name, const PolicyType& policy, const FunctorType& f,
+                            ValueType& result) {
+  const auto& c = Context::singleton();
+  if (c.has<TeamPolicyTuner>()) {
+    c.get<TeamPolicyTuner>().parallel_reduce(name,policy,f,result);
+  } else {
+    Kokkos::parallel_reduce(name,policy,f,result);
+  }
+}
+
+} // namespace Homme
+
+#endif // HOMMEXX_TEAM_POLICY_TUNER_HPP
@@ -173,6 +173,10 @@ namespace Remap {
 // previously computed in compute_grids_phase.
 // It is also expected to have a large amount of parallelism, specifically
 // qsize * num_elems
+//
+// They must also provide a batched overload of compute_remap_phase, which
+// remaps up to batch_size variables with one team, together with
+// remap_phase_team_shmem_size, the team scratch memory that overload needs
 struct VertRemapAlg {};
 } // namespace Remap
 
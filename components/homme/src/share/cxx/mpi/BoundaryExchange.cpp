@@ -12,6 +12,8 @@
 
 #include "utilities/VectorUtils.hpp"
 
+#include <algorithm>
+
 #ifndef HOMME_BE_NO_HASHER
 // It's convenient and clean to use boundary exchanges as the place to hash
 // state. However, this interferes with the BoundaryExchange unit test's
@@ -490,6 +492,7 @@ void BoundaryExchange::pack_and_send ()
   }
 
   // ---- Pack ---- //
+  start_timer("be pack");
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
   // First, pack 2d fields (if any)...
@@ -510,6 +513,7 @@ void BoundaryExchange::pack_and_send ()
     pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
                     m_num_elems, m_num_3d_int_fields);
   Kokkos::fence();
+  stop_timer("be pack");
 
   // ---- Send ---- //
   tstart("be sync_send_buffer");
@@ -519,6 +523,7 @@ void BoundaryExchange::pack_and_send ()
   if ( ! m_send_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
                             m_connectivity->get_comm().mpi_comm());
+  post_node_sends();
 
   // Notify a send is ongoing
   m_send_pending = true;
@@ -529,6 +534,10 @@ void BoundaryExchange::recv_and_unpack () {
   recv_and_unpack(nullptr);
 }
 
+void BoundaryExchange::recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  recv_and_unpack(&rspheremp);
+}
+
 // assume:conn-edges-snwe
 static void
 unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
@@ -714,6 +723,7 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
     HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
                             m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
   m_recv_pending = false;
+  recv_node_data();
   tstop("be recv waitall");
 
   tstart("be recv_and_unpack book");
@@ -722,6 +732,7 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   tstop("be recv_and_unpack book");
 
   // --- Unpack --- //
+  start_timer("be unpack");
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
   // First, unpack 2d fields (if any)...
@@ -742,6 +753,7 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
     unpack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_recv_3d_int_buffers, rspheremp,
                       m_num_elems, m_num_3d_int_fields);
   Kokkos::fence();
+  stop_timer("be unpack");
 
   // If another BE structure starts an exchange, it has no way to check that
   // this object has finished its send requests, and may erroneously reuse the
@@ -866,6 +878,7 @@ void BoundaryExchange::pack_and_send_min_max ()
   if ( ! m_send_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
                             m_connectivity->get_comm().mpi_comm());
+  post_node_sends();
 
   // Mark send buffer as busy
   m_send_pending = true;
@@ -968,6 +981,7 @@ void BoundaryExchange::recv_and_unpack_min_max ()
   if ( ! m_recv_requests.empty())
     HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(m_recv_requests.size(), m_recv_requests.data(), MPI_STATUSES_IGNORE),
                             m_connectivity->get_comm().mpi_comm()); // Wait for all data to arrive
+  recv_node_data();
 
   m_buffers_manager->sync_recv_buffer(this); // Deep copy mpi_recv_buffer into recv_buffer (no op if MPI is on device)
 
@@ -1145,11 +1159,22 @@ void BoundaryExchange::build_buffer_views_and_requests()
   {
     const auto mpi_comm = m_connectivity->get_comm().mpi_comm();
     const size_t npids = pids.size();
+    const bool use_shm = buffers_manager->use_shared_memory();
     free_requests();
-    m_send_requests.resize(npids);
-    m_recv_requests.resize(npids);
+    m_node_copies.clear();
+    // Note: reserve, since we pass pointers to the entries to MPI_Irecv
+    m_node_copies.reserve(npids);
+    m_send_requests.reserve(npids);
+    m_recv_requests.reserve(npids);
     MPIViewManaged<Real*>::pointer_type send_ptr = buffers_manager->get_mpi_send_buffer().data();
     MPIViewManaged<Real*>::pointer_type recv_ptr = buffers_manager->get_mpi_recv_buffer().data();
+
+    // On-node neighbors need to know where the data for them is in our send buffer
+    std::vector<int> node_send_offsets;
+    std::vector<MPI_Request> node_offsets_requests;
+    node_send_offsets.reserve(npids);
+    node_offsets_requests.reserve(2*npids);
+
     int offset = 0;
     for (size_t ip = 0; ip < npids; ++ip) {
       int count = 0;
@@ -1158,22 +1183,74 @@ void BoundaryExchange::build_buffer_views_and_requests()
         const auto& info = ucon(i);
         count += m_elem_buf_size[info.kind];
       }
-      HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(send_ptr + offset, count, MPI_DOUBLE,
-                                            pids[ip], m_exchange_type, mpi_comm,
-                                            &m_send_requests[ip]),
-                              m_connectivity->get_comm().mpi_comm());
-      HOMMEXX_MPI_CHECK_ERROR(MPI_Recv_init(recv_ptr + offset, count, MPI_DOUBLE,
-                                            pids[ip], m_exchange_type, mpi_comm,
-                                            &m_recv_requests[ip]),
-                              m_connectivity->get_comm().mpi_comm());
+      const int node_rank = use_shm ? buffers_manager->get_node_rank(pids[ip]) : -1;
+      if (node_rank>=0) {
+        m_node_copies.push_back(NodeCopy{node_rank,-1,offset,count});
+        node_send_offsets.push_back(offset);
+        node_offsets_requests.emplace_back();
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Irecv(&m_node_copies.back().remote_offset, 1, MPI_INT,
+                                          pids[ip], m_exchange_type, mpi_comm,
+                                          &node_offsets_requests.back()),
+                                m_connectivity->get_comm().mpi_comm());
+        node_offsets_requests.emplace_back();
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Isend(&node_send_offsets.back(), 1, MPI_INT,
+                                          pids[ip], m_exchange_type, mpi_comm,
+                                          &node_offsets_requests.back()),
+                                m_connectivity->get_comm().mpi_comm());
+      } else {
+        m_send_requests.emplace_back();
+        m_recv_requests.emplace_back();
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Send_init(send_ptr + offset, count, MPI_DOUBLE,
+                                              pids[ip], m_exchange_type, mpi_comm,
+                                              &m_send_requests.back()),
+                                m_connectivity->get_comm().mpi_comm());
+        HOMMEXX_MPI_CHECK_ERROR(MPI_Recv_init(recv_ptr + offset, count, MPI_DOUBLE,
+                                              pids[ip], m_exchange_type, mpi_comm,
+                                              &m_recv_requests.back()),
+                                m_connectivity->get_comm().mpi_comm());
+      }
       offset += count;
     }
+    if ( ! node_offsets_requests.empty())
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Waitall(node_offsets_requests.size(), node_offsets_requests.data(),
+                                          MPI_STATUSES_IGNORE),
+                              m_connectivity->get_comm().mpi_comm());
   }
 
   // Now the buffer views and the requests are built
   m_buffer_views_and_requests_built = true;
 }
 
+void BoundaryExchange::post_node_sends ()
+{
+  if (!m_buffers_manager->use_shared_memory()) {
+    return;
+  }
+
+  // Our send buffer is packed: let the neighbors on this node know.
+  // Note: all ranks on the node must participate, even if they have
+  //       no on-node neighbor.
+  m_buffers_manager->node_sync();
+}
+
+void BoundaryExchange::recv_node_data ()
+{
+  if (!m_buffers_manager->use_shared_memory()) {
+    return;
+  }
+
+  // The neighbors' send buffers are ready (see post_node_sends)
+  Real* recv_ptr = m_buffers_manager->get_mpi_recv_buffer().data();
+  for (const auto& nc : m_node_copies) {
+    const Real* src = m_buffers_manager->get_node_send_buffer(nc.node_rank) + nc.remote_offset;
+    std::copy(src, src + nc.count, recv_ptr + nc.local_offset);
+  }
+
+  // Let the neighbors know that we are done reading their send buffers,
+  // so they can safely reuse them.
+  m_buffers_manager->node_sync();
+}
+
 void BoundaryExchange
 ::free_requests () {
   for (size_t i=0; i<m_send_requests.size(); ++i)
@@ -1265,6 +1342,7 @@ void BoundaryExchange::clear_buffer_views_and_requests ()
 
   // Destroy each request
   free_requests();
+  m_node_copies.clear();
 
   // Clear buffer views
   m_send_1d_buffers = decltype(m_send_1d_buffers)("m_send_1d_buffers", 0, 0);
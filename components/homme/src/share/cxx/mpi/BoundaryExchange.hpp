@@ -218,6 +218,7 @@ public:
   // Perform the pack_and_send and recv_and_unpack for boundary exchange of 2d/3d fields
   void pack_and_send ();
   void recv_and_unpack ();
+  void recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
 
   // Perform the pack_and_send and recv_and_unpack for min/max boundary exchange of 1d fields
   void pack_and_send_min_max ();
@@ -251,6 +252,18 @@ private:
   std::vector<MPI_Request>  m_send_requests;
   std::vector<MPI_Request>  m_recv_requests;
 
+  // If the buffers manager uses shared memory, data from neighbors on the same
+  // node is copied directly from their send buffer, rather than sent via MPI.
+  // For each such neighbor, we store where its data is in its send buffer,
+  // and where it needs to go in our mpi recv buffer.
+  struct NodeCopy {
+    int node_rank;
+    int remote_offset;
+    int local_offset;
+    int count;
+  };
+  std::vector<NodeCopy>     m_node_copies;
+
   ExecViewManaged<ExecViewManaged<Scalar[2][NUM_LEV]>**>            m_1d_fields;
   ExecViewManaged<ExecViewManaged<Real[NP][NP]>**>                  m_2d_fields;
   ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**>       m_3d_fields;
@@ -311,6 +324,10 @@ private:
     std::vector<int>& h_slot_idx_to_elem_conn_pair,
     std::vector<int>& pids, std::vector<int>& pids_os);
   void free_requests();
+  // Shared memory transport: signal that our send buffer is ready, and copy
+  // the data from the on-node neighbors' send buffers (no-ops if not using shm)
+  void post_node_sends ();
+  void recv_node_data ();
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
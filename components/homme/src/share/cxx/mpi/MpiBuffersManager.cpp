@@ -8,6 +8,9 @@
 
 #include "BoundaryExchange.hpp"
 #include "Connectivity.hpp"
+#include "ErrorDefs.hpp"
+
+#include <numeric>
 
 namespace Homme
 {
@@ -18,6 +21,9 @@ MpiBuffersManager::MpiBuffersManager ()
  , m_local_buffer_size (0)
  , m_buffers_busy      (false)
  , m_views_are_valid   (false)
+ , m_use_shared_memory (HOMMEXX_MPI_SHARED_MEMORY && !OnGpu<ExecSpace>::value)
+ , m_node_comm         (MPI_COMM_NULL)
+ , m_send_win          (MPI_WIN_NULL)
 {
   // The "fake" buffers used for MISSING connections. These do not depend on the requirements
   // from the custormers, so we can create them right away.
@@ -41,6 +47,27 @@ MpiBuffersManager::~MpiBuffersManager ()
 
   // Check our buffers are not busy
   assert (!m_buffers_busy);
+
+  // Window and comm can only be freed if MPI is still up
+  int finalized;
+  MPI_Finalized(&finalized);
+  if (!finalized) {
+    free_shared_send_buffer();
+    if (m_node_comm!=MPI_COMM_NULL) {
+      MPI_Comm_free(&m_node_comm);
+    }
+  }
+}
+
+void MpiBuffersManager::set_use_shared_memory (const bool use_shared_memory)
+{
+  // Switching transport after buffers are allocated is not allowed
+  assert (!m_views_are_valid);
+
+  Errors::runtime_check(!use_shared_memory || !OnGpu<ExecSpace>::value,
+      "Error! Shared memory boundary exchange is only available on CPU builds.\n");
+
+  m_use_shared_memory = use_shared_memory;
 }
 
 void MpiBuffersManager::check_for_reallocation ()
@@ -69,19 +96,41 @@ bool MpiBuffersManager::check_views_capacity (const int num_1d_fields, const int
 
 void MpiBuffersManager::allocate_buffers ()
 {
+  bool views_are_valid = m_views_are_valid;
+  if (m_use_shared_memory) {
+    // Allocating the shared window is collective on the node, so if one rank
+    // needs to reallocate, all the ranks on the node must do it
+    init_node_comm();
+    int need_alloc = m_views_are_valid ? 0 : 1;
+    int any_need_alloc;
+    MPI_Allreduce(&need_alloc,&any_need_alloc,1,MPI_INT,MPI_MAX,m_node_comm);
+    views_are_valid = any_need_alloc==0;
+  }
+
   // If views are marked as valid, they are already allocated, and no other
   // customer has requested a larger size
-  if (m_views_are_valid) {
+  if (views_are_valid) {
     return;
   }
 
   // The buffers used for packing/unpacking
-  m_send_buffer  = ExecViewManaged<Real*>("send buffer",  m_mpi_buffer_size);
+  if (m_use_shared_memory) {
+    // On CPU, MPIMemSpace=ExecMemSpace, so the send buffer is also used in MPI calls
+    allocate_shared_send_buffer();
+  } else {
+    m_send_buffer_storage = ExecViewManaged<Real*>("send buffer",  m_mpi_buffer_size);
+    m_send_buffer = m_send_buffer_storage;
+  }
   m_recv_buffer  = ExecViewManaged<Real*>("recv buffer",  m_mpi_buffer_size);
   m_local_buffer = ExecViewManaged<Real*>("local buffer", m_local_buffer_size);
 
   // The buffers used in MPI calls
-  m_mpi_send_buffer = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer)::execution_space(),m_send_buffer);
+  if (m_use_shared_memory) {
+    m_mpi_send_buffer = MPIViewUnmanaged<Real*>(m_send_buffer.data(),m_send_buffer.size());
+  } else {
+    m_mpi_send_buffer_storage = Kokkos::create_mirror_view(decltype(m_mpi_send_buffer_storage)::execution_space(),m_send_buffer_storage);
+    m_mpi_send_buffer = m_mpi_send_buffer_storage;
+  }
   m_mpi_recv_buffer = Kokkos::create_mirror_view(decltype(m_mpi_recv_buffer)::execution_space(),m_recv_buffer);
 
   m_views_are_valid = true;
@@ -93,6 +142,67 @@ void MpiBuffersManager::allocate_buffers ()
   }
 }
 
+void MpiBuffersManager::init_node_comm ()
+{
+  if (m_node_comm!=MPI_COMM_NULL) {
+    return;
+  }
+
+  assert (m_connectivity);
+  const auto& comm = m_connectivity->get_comm();
+  MPI_Comm_split_type(comm.mpi_comm(),MPI_COMM_TYPE_SHARED,comm.rank(),MPI_INFO_NULL,&m_node_comm);
+
+  // Map each pid to its rank in the node comm (if on this node)
+  MPI_Group group, node_group;
+  MPI_Comm_group(comm.mpi_comm(),&group);
+  MPI_Comm_group(m_node_comm,&node_group);
+  std::vector<int> pids(comm.size());
+  std::iota(pids.begin(),pids.end(),0);
+  m_pid_to_node_rank.resize(comm.size());
+  MPI_Group_translate_ranks(group,comm.size(),pids.data(),node_group,m_pid_to_node_rank.data());
+  for (auto& r : m_pid_to_node_rank) {
+    if (r==MPI_UNDEFINED) {
+      r = -1;
+    }
+  }
+  MPI_Group_free(&group);
+  MPI_Group_free(&node_group);
+}
+
+void MpiBuffersManager::allocate_shared_send_buffer ()
+{
+  free_shared_send_buffer();
+
+  Real* send_ptr;
+  MPI_Win_allocate_shared(m_mpi_buffer_size*sizeof(Real),sizeof(Real),MPI_INFO_NULL,
+                          m_node_comm,&send_ptr,&m_send_win);
+
+  // Open a passive target epoch for the whole life of the window. Synchronization
+  // is done via node_sync, so there is no need for MPI locks.
+  MPI_Win_lock_all(MPI_MODE_NOCHECK,m_send_win);
+
+  int node_size;
+  MPI_Comm_size(m_node_comm,&node_size);
+  m_node_send_buffers.resize(node_size);
+  for (int r=0; r<node_size; ++r) {
+    MPI_Aint size;
+    int disp_unit;
+    MPI_Win_shared_query(m_send_win,r,&size,&disp_unit,&m_node_send_buffers[r]);
+  }
+
+  m_send_buffer = ExecViewUnmanaged<Real*>(send_ptr,m_mpi_buffer_size);
+}
+
+void MpiBuffersManager::free_shared_send_buffer ()
+{
+  if (m_send_win==MPI_WIN_NULL) {
+    return;
+  }
+  MPI_Win_unlock_all(m_send_win);
+  MPI_Win_free(&m_send_win);
+  m_node_send_buffers.clear();
+}
+
 void MpiBuffersManager::lock_buffers ()
 {
   // Make sure we are not trying to lock buffers already locked
@@ -8,6 +8,9 @@
 #define HOMMEXX_MPI_BUFFERS_MANAGER_HPP
 
 #include "Types.hpp"
+#include "ExecSpaceDefs.hpp"
+
+#include <mpi.h>
 
 #include <vector>
 #include <map>
@@ -70,6 +73,16 @@ class BoundaryExchange;
  * which is a no-op if the MPIMemSpace=ExecMemSpace, that is, if
  * the MPI is performed using pointers on the Execution Space.
  *
+ * On CPU builds, the BM can optionally allocate the send buffer in an
+ * MPI-3 shared memory window, shared by all the ranks on the same node
+ * (see set_use_shared_memory). In this case, the BE customers do not use
+ * MPI messages for neighbors on the same node. Instead, they read the
+ * packed data directly from the neighbor's send buffer, using node-wide
+ * barriers to know when the data is ready, and when it has been consumed.
+ * Since the window allocation and the barriers are collective on the node,
+ * all ranks on a node must register/exchange the same BE's in the same
+ * order (which is always the case in Homme).
+ *
  */
 
 class MpiBuffersManager
@@ -87,6 +100,11 @@ public:
   // Checks whether the connectivity is already set
   bool is_connectivity_set () const { return m_connectivity!=nullptr; }
 
+  // Whether on-node neighbors exchange data through a shared memory window.
+  // Only available on CPU builds. Must be called before buffers are allocated.
+  void set_use_shared_memory (const bool use_shared_memory);
+  bool use_shared_memory () const { return m_use_shared_memory; }
+
   // Set the connectivity class
   void set_connectivity (std::shared_ptr<Connectivity> connectivity);
 
@@ -131,6 +149,19 @@ private:
   void sync_send_buffer (BoundaryExchange* customer);
   void sync_recv_buffer (BoundaryExchange* customer);
 
+  // Shared memory transport utilities (only valid if m_use_shared_memory=true)
+  // Rank of the given pid in the node comm (-1 if pid is not on this node)
+  int get_node_rank (const int pid) const;
+  // The send buffer of the given rank in the node comm
+  const Real* get_node_send_buffer (const int node_rank) const;
+  // Node-wide barrier, which also ensures that all writes to the
+  // shared send buffers are visible to all the ranks on the node
+  void node_sync () const;
+
+  void init_node_comm ();
+  void allocate_shared_send_buffer ();
+  void free_shared_send_buffer ();
+
   // Small struct, to hold customer's needs. We could use an std::pair, but this is more verbose
   struct CustomerNeeds {
     size_t local_buffer_size;
@@ -163,6 +194,9 @@ private:
   // Used to check whether user can still request different sizes
   bool m_views_are_valid;
 
+  // Whether the send buffer lives in a node shared memory window
+  bool m_use_shared_memory;
+
   // Customers of this MpiBuffersManager, each with its local and mpi sizes
   std::map<BoundaryExchange*,CustomerNeeds>  m_customers;
 
@@ -170,13 +204,23 @@ private:
   std::shared_ptr<Connectivity> m_connectivity;
 
   // The buffers
-  ExecViewManaged<Real*>  m_send_buffer;
-  ExecViewManaged<Real*>  m_recv_buffer;
-  ExecViewManaged<Real*>  m_local_buffer;
+  // Note: the send buffer may live in a shared memory window, so we store an
+  //       unmanaged view, and keep the managed allocation (if any) separately
+  ExecViewManaged<Real*>    m_send_buffer_storage;
+  ExecViewUnmanaged<Real*>  m_send_buffer;
+  ExecViewManaged<Real*>    m_recv_buffer;
+  ExecViewManaged<Real*>    m_local_buffer;
 
   // The mpi buffers (same as the previous send/recv buffers if MPIMemSpace=ExecMemSpace)
-  MPIViewManaged<Real*>   m_mpi_send_buffer;
-  MPIViewManaged<Real*>   m_mpi_recv_buffer;
+  MPIViewManaged<Real*>     m_mpi_send_buffer_storage;
+  MPIViewUnmanaged<Real*>   m_mpi_send_buffer;
+  MPIViewManaged<Real*>     m_mpi_recv_buffer;
+
+  // Shared memory transport data
+  MPI_Comm            m_node_comm;
+  MPI_Win             m_send_win;
+  std::vector<int>    m_pid_to_node_rank;
+  std::vector<Real*>  m_node_send_buffers;
 
   // The blackhole send/recv buffers (used for missing connections)
   ExecViewManaged<Real*>  m_blackhole_send_buffer;
@@ -215,6 +259,27 @@ inline void MpiBuffersManager::sync_recv_buffer (BoundaryExchange* customer)
   }
 }
 
+inline int MpiBuffersManager::get_node_rank (const int pid) const
+{
+  assert (m_use_shared_memory);
+  return m_pid_to_node_rank[pid];
+}
+
+inline const Real* MpiBuffersManager::get_node_send_buffer (const int node_rank) const
+{
+  assert (m_use_shared_memory && m_views_are_valid);
+  return m_node_send_buffers[node_rank];
+}
+
+inline void MpiBuffersManager::node_sync () const
+{
+  assert (m_use_shared_memory);
+  // Make our writes visible, wait for everyone, then make sure we see everyone's writes
+  MPI_Win_sync(m_send_win);
+  MPI_Barrier(m_node_comm);
+  MPI_Win_sync(m_send_win);
+}
+
 inline ExecViewUnmanaged<Real*>
 MpiBuffersManager::get_send_buffer () const
 {
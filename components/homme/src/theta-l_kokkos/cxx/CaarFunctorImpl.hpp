@@ -20,6 +20,7 @@
 #include "RKStageData.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "kokkos_utils.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
@@ -347,7 +348,7 @@ struct CaarFunctorImpl {
 
     GPTLstart("caar compute");
     int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+    tuned_parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
     Kokkos::fence();
     GPTLstop("caar compute");
     if (nerr > 0)
@@ -15,6 +15,7 @@
 #include "KernelVariables.hpp"
 #include "PhysicalConstants.hpp"
 #include "ElementOps.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "profiling.hpp"
 #include "ErrorDefs.hpp"
 #include "utilities/scream_tridiag.hpp"
@@ -396,7 +397,7 @@ struct DirkFunctorImpl {
     };
 
     int nerr;
-    Kokkos::parallel_reduce(m_policy, toplevel, nerr);
+    tuned_parallel_reduce("dirk newton", m_policy, toplevel, nerr);
     if (nerr > 0) {
       const int nt[] = {nm1, n0, np1};
       const char* ntname[] = {"nm1", "n0", "np1"};
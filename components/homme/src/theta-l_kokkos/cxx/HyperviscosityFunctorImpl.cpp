@@ -8,6 +8,7 @@
 
 #include "Context.hpp"
 #include "FunctorsBuffersManager.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "profiling.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
@@ -271,7 +272,7 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
     biharmonic_wk_theta ();
     GPTLstop("hvf-bhwk");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
+    tuned_parallel_for("hvf pre-boundary exchange", m_policy_pre_exchange, *this);
     Kokkos::fence();
 
     // Exchange
@@ -355,7 +356,7 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
   // For the first laplacian we use a differnt kernel, which uses directly the states
   // at timelevel np1 as inputs, and subtracts the reference states.
   // This way we avoid copying the states to *tens buffers.
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
+  tuned_parallel_for("hvf first laplace", m_policy_first_laplace, *this);
   Kokkos::fence();
 
   // Exchange
@@ -368,10 +369,10 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
   const int ne = m_geometry.num_elems();
   if ( m_data.consthv ) {
     auto policy = Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceConstHV>(ne);
-    Kokkos::parallel_for(policy, *this);
+    tuned_parallel_for("hvf second laplace const hv", policy, *this);
   }else{
     auto policy = Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceTensorHV>(ne);
-    Kokkos::parallel_for(policy, *this);
+    tuned_parallel_for("hvf second laplace tensor hv", policy, *this);
   }
   Kokkos::fence();
 } //biharmonic
@@ -21,6 +21,7 @@
 #include "ReferenceElement.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "TimeLevel.hpp"
 #include "Tracers.hpp"
 #include "GllFvRemap.hpp"
@@ -364,6 +365,9 @@ void init_functors_c (const bool& allocate_buffer)
 
   auto& fbm     = c.create_if_not_there<FunctorsBuffersManager>();
 
+  // Team shapes autotuning (a no-op, unless enabled via env var)
+  c.create_if_not_there<TeamPolicyTuner>(elems.num_elems());
+
 //OG why are if-statement here -- above calls define which constructor is called
 
   // If any Functor was constructed only partially, setup() must be called.
@@ -9,6 +9,7 @@
 #include "utilities/TestUtils.hpp"
 #include "Types.hpp"
 
+#include <chrono>
 #include <random>
 #include <iomanip>
 #include <iostream>
@@ -302,6 +303,58 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
     }}}}}}
   }
 
+  // Compare the MPI and the shared memory transports (CPU only). Results must be BFB,
+  // and we report the time spent in the exchanges with both transports.
+  if (!OnGpu<ExecSpace>::value) {
+    constexpr int num_exchanges = 10;
+    using field_t = ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV]>;
+
+    auto run_exchanges = [&] (const bool use_shared_memory, field_t field) -> double {
+      auto bm = std::make_shared<MpiBuffersManager>(connectivity);
+      bm->set_use_shared_memory(use_shared_memory);
+      BoundaryExchange be(connectivity,bm);
+      be.set_num_fields(0,0,NUM_TIME_LEVELS);
+      be.register_field(field,NUM_TIME_LEVELS,0);
+      be.registration_completed();
+
+      Kokkos::deep_copy(field,field_3d_cxx);
+      MPI_Barrier(connectivity->get_comm().mpi_comm());
+      const auto start = std::chrono::steady_clock::now();
+      for (int i=0; i<num_exchanges; ++i) {
+        be.exchange();
+      }
+      const auto finish = std::chrono::steady_clock::now();
+      be.clean_up();
+
+      double elapsed = std::chrono::duration<double>(finish-start).count();
+      double max_elapsed;
+      MPI_Allreduce(&elapsed,&max_elapsed,1,MPI_DOUBLE,MPI_MAX,connectivity->get_comm().mpi_comm());
+      return max_elapsed;
+    };
+
+    field_t field_mpi("",num_elements), field_shm("",num_elements);
+    const double time_mpi = run_exchanges(false,field_mpi);
+    const double time_shm = run_exchanges(true, field_shm);
+    if (rank==0) {
+      std::cout << "BoundaryExchange timings (" << num_exchanges << " exchanges):\n"
+                << "  mpi transport          : " << time_mpi << " s\n"
+                << "  shared memory transport: " << time_shm << " s\n";
+    }
+
+    auto field_mpi_host = Kokkos::create_mirror_view(field_mpi);
+    auto field_shm_host = Kokkos::create_mirror_view(field_shm);
+    Kokkos::deep_copy(field_mpi_host,field_mpi);
+    Kokkos::deep_copy(field_shm_host,field_shm);
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int itl=0; itl<NUM_TIME_LEVELS; ++itl) {
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+              for (int iv=0; iv<VECTOR_SIZE; ++iv) {
+                REQUIRE(field_mpi_host(ie,itl,igp,jgp,ilev)[iv]==field_shm_host(ie,itl,igp,jgp,ilev)[iv]);
+    }}}}}}
+  }
+
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
   be1->clean_up();
@@ -42,8 +42,9 @@ class ppm_remap_functor_test {
                 "PPM Remap test must have a supported boundary condition");
 
 public:
-  ppm_remap_functor_test(const int num_elems, const int num_remap)
-      : ne(num_elems), num_remap(num_remap), remap(num_elems, num_remap),
+  ppm_remap_functor_test(const int num_elems, const int num_remap,
+                         const int batch_size = 1)
+      : ne(num_elems), num_remap(num_remap), remap(num_elems, num_remap, batch_size),
         src_layer_thickness_kokkos("source layer thickness", num_elems),
         tgt_layer_thickness_kokkos("target layer thickness", num_elems),
         remap_vals("values to remap", num_elems, num_remap) {}
@@ -51,6 +52,7 @@ public:
   struct TagGridTest {};
   struct TagPPMTest {};
   struct TagRemapTest {};
+  struct TagBatchedRemapTest {};
 
   static bool nan_boundaries(
       HostViewUnmanaged<Real * [NP][NP][_ppm_consts::DPO_PHYSICAL_LEV]> host) {
@@ -318,8 +320,14 @@ public:
 
     initialize_layers(engine);
 
-    Kokkos::parallel_for(
-        Homme::get_default_team_policy<ExecSpace, TagRemapTest>(ne), *this);
+    if (remap.batch_size() > 1) {
+      auto policy = Homme::get_default_team_policy<ExecSpace, TagBatchedRemapTest>(ne);
+      policy.set_scratch_size(0, Kokkos::PerTeam(remap.remap_phase_team_shmem_size()));
+      Kokkos::parallel_for(policy, *this);
+    } else {
+      Kokkos::parallel_for(
+          Homme::get_default_team_policy<ExecSpace, TagRemapTest>(ne), *this);
+    }
     Kokkos::fence();
 
     const int remap_alg = boundary_cond::fortran_remap_alg;
@@ -376,6 +384,20 @@ public:
     }
   }
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagBatchedRemapTest &, const TeamMember& team) const {
+    KernelVariables kv(team);
+    remap.compute_grids_phase(
+        kv, Homme::subview(src_layer_thickness_kokkos, kv.ie),
+        Homme::subview(tgt_layer_thickness_kokkos, kv.ie));
+    for (int var_beg = 0; var_beg < num_remap; var_beg += remap.batch_size()) {
+      const int num_vars = std::min(remap.batch_size(), num_remap - var_beg);
+      remap.compute_remap_phase(kv, num_vars, [&](const int ivar) {
+        return Homme::subview(remap_vals, kv.ie, var_beg + ivar);
+      });
+    }
+  }
+
   const int ne, num_remap;
   PpmVertRemap<boundary_cond> remap;
   ExecViewManaged<Scalar * [NP][NP][NUM_LEV]> src_layer_thickness_kokkos;
@@ -392,6 +414,33 @@ TEST_CASE("ppm_mirrored", "vertical remap") {
   SECTION("remap") { remap_test_mirrored.test_remap(); }
 }
 
+TEST_CASE("ppm_mirrored_batched", "vertical remap") {
+  constexpr int num_elems = 2;
+  constexpr int num_remap = 5;
+  constexpr int batch_size = 2;
+  ppm_remap_functor_test<PpmMirrored> remap_test_mirrored(num_elems, num_remap,
+                                                          batch_size);
+  SECTION("remap") { remap_test_mirrored.test_remap(); }
+}
+
+TEST_CASE("ppm_limited_extrap", "vertical remap") {
+  constexpr int num_elems = 2;
+  constexpr int num_remap = 3;
+  ppm_remap_functor_test<PpmLimitedExtrap> remap_test_extrap(num_elems, num_remap);
+  SECTION("remap") { remap_test_extrap.test_remap(); }
+}
+
+TEST_CASE("ppm_limited_extrap_batched", "vertical remap") {
+  constexpr int num_elems = 2;
+  constexpr int num_remap = 5;
+  // Also check a batch size that does not divide num_remap evenly
+  for (int batch_size : {2, 3, num_remap}) {
+    ppm_remap_functor_test<PpmLimitedExtrap> remap_test_extrap(num_elems, num_remap,
+                                                               batch_size);
+    remap_test_extrap.test_remap();
+  }
+}
+
 
 TEST_CASE("binary_search","binary_search")
 {
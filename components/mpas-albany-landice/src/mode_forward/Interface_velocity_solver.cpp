@@ -49,6 +49,9 @@ const double secondsInAYear = 31536000.0;  // This may vary slightly in MPAS, bu
 double minThickness = 1e-3; //[km]
 double thermal_thickness_limit; //[km]
 const double minBeta = 1e-5;
+const int maxRebalanceSweeps = 100; // max number of diffusion sweeps used to rebalance the FE triangles among neighboring procs
+const double rebalanceTolerance = 1.05; // the diffusion sweeps stop when the triangles load imbalance is below this value
+bool rebalanceTriangles = false;
 double rho_ice;
 double rho_ocean;
 //unsigned char dynamic_ice_bit_value;
@@ -72,6 +75,9 @@ std::vector<double> dissipationHeatOnPrisms, velocityOnVertices, velocityOnCells
     elevationData, thicknessData, betaData, bedTopographyData, stiffnessFactorData, effecPressData, muFrictionData, temperatureDataOnPrisms, smbData, thicknessOnCells, bodyForceOnBasalCell;
 std::vector<bool> isVertexBoundary, isBoundaryEdge;
 
+// masks and triangle ownership used to build the current FE grid, needed to update the grid incrementally
+std::vector<int> prevVerticesMask, triangleOwnerCandidates, localTrianglesProcIds, prevHaveElements;
+
 // only needed for creating ASCII mesh
 std::vector<double> thicknessUncertaintyData;
 std::vector<double> smbUncertaintyData;
@@ -117,13 +123,14 @@ void velocity_solver_set_parameters(double const* gravity_F, double const* ice_d
                          double const* clausius_clapeyron_coeff,
                          double const* thermal_thickness_limit_F,
                          int const* li_mask_ValueDynamicIce, int const* li_mask_ValueIce,
-                         bool const* use_GLP_F) {
+                         bool const* use_GLP_F, bool const* rebalance_fem_triangles_F) {
   // This function sets parameter values used by MPAS on the C/C++ side
   rho_ice = *ice_density_F;
   rho_ocean = *ocean_density_F;
   thermal_thickness_limit = *thermal_thickness_limit_F / unit_length; // Import with Albany scaling
   dynamic_ice_bit_value = *li_mask_ValueDynamicIce;
   ice_present_bit_value = *li_mask_ValueIce;
+  rebalanceTriangles = *rebalance_fem_triangles_F;
   velocity_solver_set_physical_parameters__(*gravity_F, rho_ice, *ocean_density_F, *sea_level_F/unit_length, *flowParamA_F*std::pow(unit_length,4)*secondsInAYear, 
                                             *flowLawExponent_F, *dynamic_thickness_F/unit_length, *use_GLP_F, *clausius_clapeyron_coeff);
 }
@@ -360,10 +367,51 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
 
   MPI_Comm_size(comm, &numProcs);
   MPI_Comm_rank(comm, &me);
-  std::vector<int> partialOffset(numProcs + 1), globalOffsetTriangles(
-      numProcs + 1), globalOffsetVertices(numProcs + 1), globalOffsetEdge(
-      numProcs + 1);
 
+  // The FE triangles, edges and vertices only depend on the dynamic ice bit of the MPAS vertices mask,
+  // whereas the ice margin edges and the Dirichlet nodes also depend on the MPAS cells mask and on the Dirichlet mask.
+  // We diff the dynamic ice bit against the one used to build the current grid, so that the FE grid is only
+  // rebuilt where needed:
+  // 1. if no rank changed the dynamic ice bit, the FE triangles, edges and vertices, the exchange lists
+  //    and the reduced communicator are all reused, and only the margin edges and the Dirichlet nodes are recomputed;
+  // 2. otherwise, the FE grid is rebuilt on all procs. The only savings are that procs whose (owned and shared)
+  //    MPAS vertices did not change reuse their local triangle ownership and reversed exchange lists,
+  //    while FE edges, vertices and exchange lists are recomputed everywhere (they may depend on the
+  //    triangles of neighboring procs).
+  bool isFirstCall = prevVerticesMask.empty();
+  int nLocalChangedFVertices = isFirstCall ? nVertices_F + 1 : 0;
+  if (!isFirstCall) {
+    for (int i = 0; i < nVertices_F; i++)
+      nLocalChangedFVertices += (verticesMask_F[i] & dynamic_ice_bit_value) != (prevVerticesMask[i] & dynamic_ice_bit_value);
+  }
+  prevVerticesMask.assign(verticesMask_F, verticesMask_F + nVertices_F);
+
+  int nChangedFVertices;
+  MPI_Allreduce(&nLocalChangedFVertices, &nChangedFVertices, 1, MPI_INT, MPI_SUM, comm);
+  bool rebuildGrid = (nChangedFVertices > 0);
+  bool rebuildLocalTriangles = (nLocalChangedFVertices > 0);
+
+  if (!isFirstCall && (me == 0)) {
+    if (rebuildGrid)
+      std::cout << "Updating FE grid: " << nChangedFVertices << " MPAS vertices changed dynamic ice status" << std::endl;
+    else
+      std::cout << "Reusing FE grid: only the ice margin and the Dirichlet nodes are updated" << std::endl;
+  }
+
+  //vector containing proc ranks for owned and shared MPAS cells
+  std::vector<int> fCellsProcIds(nCells_F);
+  getProcIds(fCellsProcIds, recvCellsList_F);
+
+  if (!rebuildGrid) {
+    computeIceMarginAndDirichletNodes();
+
+    //call the velocity solver only on procs owning some FE triangles
+    if (isDomainEmpty)
+      return;
+
+    velocity_solver_compute_2d_grid__(reducedComm);
+    return;
+  }
 
   // First, we compute the FE triangles belonging to this processor.
   // If changeTrianglesOwnership is not define, the triangles belonging to this
@@ -372,94 +420,72 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   // If changeTrianglesOwnership is define, we rearrange the ownership of the triangles
   // to improve the quality of the FE mesh and avoid corner cases (see below).
 
-  triangleToFVertex.clear();
-  triangleToFVertex.reserve(nVertices_F);
-  std::vector<int> fVertexToTriangle(nVertices_F, NotAnId);
-
-  //vector containing proc ranks for owned and shared FE triangles
-  trianglesProcIds.assign(nVertices_F,NotAnId);
-
-  //vector containing proc ranks for owned and shared MPAS cells
-  std::vector<int> fCellsProcIds(nCells_F);
-  getProcIds(fCellsProcIds, recvCellsList_F);
 #ifdef changeTrianglesOwnership
-  std::vector<int> fVerticesProcIds(nVertices_F);
-  getProcIds(fVerticesProcIds, recvVerticesList_F);
-  for (int i(0); i < nVertices_F; i++) {
-    int cellWithMinID=nCellsSolve_F;
-    if ((verticesMask_F[i] & dynamic_ice_bit_value)) {
-      int minCellId = std::numeric_limits<int>::max();
-      int minCellIdProc(0);
-
-      int cellProc[3];
-      bool invalidCell=false;
-      for (int j = 0; j < 3; j++) {
-        int iCell = cellsOnVertex_F[3 * i + j] - 1;
-        if(iCell >= nCells_F) {
-          invalidCell = true;
-          break;
-        }
-        int cellID = indexToCellID_F[iCell];
-        cellProc[j] = fCellsProcIds[iCell];
-        if(cellID < minCellId) {
-          minCellId = cellID;
-          cellWithMinID = iCell;
-          minCellIdProc = cellProc[j];
-        }
-      }
-
-      if(invalidCell) continue;
-
-      // the proc that owns at least 2 nodes of the triangle i. If all nodes belong to different procs, procOwns2Nodes is set to -1
-      int procOwns2Nodes = ((cellProc[0] ==  cellProc[1]) || (cellProc[0] ==  cellProc[2])) ? cellProc[0] :
-                           (cellProc[1] == cellProc[2]) ? cellProc[1] : -1;
-
-      int vertexProc = fVerticesProcIds[i];
-      bool triangleOwnsANode = (cellProc[0] == vertexProc) || (cellProc[1] == vertexProc) || (cellProc[2] == vertexProc);
+  // rebalancing the triangles ownership is a collective operation, so all procs compute the new ownership,
+  // but procs whose (owned and shared) triangles ownership is unchanged still reuse their local triangles
+  if (rebalanceTriangles) {
+    std::vector<int> newTrianglesProcIds;
+    computeDynamicTrianglesOwnership(newTrianglesProcIds, fCellsProcIds);
+    rebalanceTrianglesOwnership(newTrianglesProcIds, fCellsProcIds);
+    rebuildLocalTriangles = (newTrianglesProcIds != localTrianglesProcIds);
+    if (rebuildLocalTriangles)
+      trianglesProcIds.swap(newTrianglesProcIds);
+  }
+#endif
 
-      //A triangle will be owned by a proc if:
-      // 1. the proc owns at least 2 nodes of the triangle associated to that vertex, OR
-      // 2. all the nodes of the triangle belong to three different procs, and the proc owns the fortran vertex  and a node OR
-      // 3. the three nodes of the triangle and the fortran vertex belong to four different procs, and the proc owns the node with the minimum ID
+  if (rebuildLocalTriangles) {
+    triangleToFVertex.clear();
+    triangleToFVertex.reserve(nVertices_F);
 
-      trianglesProcIds[i] = (procOwns2Nodes != -1) ? procOwns2Nodes :
-                       triangleOwnsANode ? vertexProc :
-                       minCellIdProc;
+#ifdef changeTrianglesOwnership
+    //vector containing proc ranks for owned and shared FE triangles (already computed if rebalancing)
+    if (!rebalanceTriangles)
+      computeDynamicTrianglesOwnership(trianglesProcIds, fCellsProcIds);
 
-      if (trianglesProcIds[i] == me) {
-        fVertexToTriangle[i] = triangleToFVertex.size();
+    for (int i(0); i < nVertices_F; i++) {
+      if (trianglesProcIds[i] == me)
         triangleToFVertex.push_back(i);
-      } 
     }
-  }
+    localTrianglesProcIds = trianglesProcIds;
+
+    // because we change the ownership of some triangles, we need to first communicate back to the processors that used to own those triangles
+    // the data of the newly owned triangles. We do this by defining "reversed" send and receive lists, communicate back using those lists, and
+    // then communicate "forward" using the usual send and receive lists.
+    // We could join these two step in one communication, but for the moment we do that separately
+    createReverseExchangeLists(sendVerticesListReversed, recvVerticesListReversed, trianglesProcIds, indexToVertexID_F, recvVerticesList_F);
 #else
-  //in this case we just set the proc ranks for owned and shared FE triangles to the be the same as MPAS owned and shared vertices
-  getProcIds(trianglesProcIds, recvVerticesList_F);
-  for (int i(0); i < nVerticesSolve_F; i++) {
-    if (verticesMask_F[i] & dynamic_ice_bit_value) {
-      fVertexToTriangle[i] = triangleToFVertex.size();
-      triangleToFVertex.push_back(i);
+    //in this case we just set the proc ranks for owned and shared FE triangles to the be the same as MPAS owned and shared vertices
+    trianglesProcIds.assign(nVertices_F,NotAnId);
+    getProcIds(trianglesProcIds, recvVerticesList_F);
+    for (int i(0); i < nVerticesSolve_F; i++) {
+      if (verticesMask_F[i] & dynamic_ice_bit_value)
+        triangleToFVertex.push_back(i);
     }
-  }
+    localTrianglesProcIds = trianglesProcIds;
 #endif
+  } else {
+    // local triangles are unchanged, we only restore the proc ranks before they get overwritten by the halo exchange
+    trianglesProcIds = localTrianglesProcIds;
+  }
 
   nTriangles = triangleToFVertex.size();
 
+  double trianglesImbalance = computeLoadImbalance(nTriangles);
+  if (me == 0)
+    std::cout << "FE triangles load imbalance (max/mean over all procs): " << trianglesImbalance << std::endl;
+
   //Initialize the ice sheet problem with the number of FE triangles on this prov
   initialize_iceProblem(nTriangles);
 
   //Create a list of global IDs for FE triangles, using MPAS vertices IDs
+  std::vector<int> fVertexToTriangle(nVertices_F, NotAnId);
   fVertexToTriangleID.assign(nVertices_F, NotAnId);
   for (int index(0); index < nTriangles; index++) {
+    fVertexToTriangle[triangleToFVertex[index]] = index;
     fVertexToTriangleID[triangleToFVertex[index]] = indexToVertexID_F[triangleToFVertex[index]];
   }
 
 #ifdef changeTrianglesOwnership
-  // because we change the ownership of some triangles, we need to first communicate back to the processors that used to own those triangles
-  // the data of the newly owned triangles. We do this by defining "reversed" send and receive lists, communicate back using those lists, and
-  // then communicate "forward" using the usual send and receive lists.
-  // We could join these two step in one communication, but for the moment we do that separately
-  createReverseExchangeLists(sendVerticesListReversed, recvVerticesListReversed, trianglesProcIds, indexToVertexID_F, recvVerticesList_F);
   allToAll(fVertexToTriangleID, &sendVerticesListReversed, &recvVerticesListReversed);
   allToAll(fVertexToTriangle, &sendVerticesListReversed, &recvVerticesListReversed);
   allToAll(trianglesProcIds, sendVerticesList_F, recvVerticesList_F);
@@ -566,25 +592,11 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
 
   nEdges = edgeToFEdge.size();
   indexToEdgeID.resize(nEdges);
-  iceMarginEdgesLIds.clear();
-  iceMarginEdgesLIds.reserve(numBoundaryEdges);
   int maxEdgeID=std::numeric_limits<int>::min(), maxGlobalEdgeID;
   for (int index = 0; index < nEdges; index++) {
     int fEdge = edgeToFEdge[index];
     indexToEdgeID[index] = fEdgeToEdgeID[fEdge];
     maxEdgeID = (indexToEdgeID[index] > maxEdgeID) ? indexToEdgeID[index] : maxEdgeID;
-
-    if(index<numBoundaryEdges){
-      int fCell0 = cellsOnEdge_F[2 * fEdge] - 1;
-      int fCell1 = cellsOnEdge_F[2 * fEdge + 1] - 1;
-      assert((fCell0<nCells_F) && (fCell1<nCells_F));
-      bool isCell0OnMargin = !(cellsMask_F[fCell0] & dynamic_ice_bit_value) &&
-          (dirichletCellsMask_F[(nLayers+1)*fCell0] == 0);
-      bool isCell1OnMargin = !(cellsMask_F[fCell1] & dynamic_ice_bit_value) &&
-          (dirichletCellsMask_F[(nLayers+1)*fCell1] == 0);
-      if(isCell0OnMargin || isCell1OnMargin)
-        iceMarginEdgesLIds.push_back(index);
-    }
   }
 
   MPI_Allreduce(&maxEdgeID, &maxGlobalEdgeID, 1, MPI_INT, MPI_MAX, comm);
@@ -653,21 +665,9 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
   MPI_Allreduce(&maxVertexID, &maxGlobalVertexID, 1, MPI_INT, MPI_MAX, comm);
   globalVertexStride = maxGlobalVertexID;
 
-
-  int vertexColumnShift = (Ordering == 1) ? 1 : globalVertexStride;
-  int vertexLayerShift = (Ordering == 0) ? 1 : nLayers + 1;
-  dirichletNodesIDs.clear();
-  dirichletNodesIDs.reserve(nVertices); //need to improve storage efficiency
   isVertexBoundary.assign(nVertices, false);
   for (int index = 0; index < nVertices; index++) {
     int fCell = vertexToFCell[index];
-    for(int il=0; il< nLayers+1; ++il)
-    {
-      int imask_F = il+(nLayers+1)*fCell;
-      if(dirichletCellsMask_F[imask_F]!=0)
-        dirichletNodesIDs.push_back((nLayers-il)*vertexColumnShift+indexToVertexID[index]*vertexLayerShift);
-    }
-
     int nEdg = nEdgesOnCells_F[fCell];
     int j = 0;
     bool isBoundary;
@@ -715,6 +715,7 @@ void velocity_solver_compute_2d_grid(int const* _verticesMask_F, int const* _cel
     verticesOnEdge[2 * index + 1] = fCellToVertex[fCell2];
   }
 
+  computeIceMarginAndDirichletNodes();
 
   //call the velocity solver only on procs owning some FE triangles
   if (isDomainEmpty)
@@ -1361,16 +1362,191 @@ void exportBeta(double * beta_F) {
   allToAll (beta_F,  sendCellsList_F, recvCellsList_F, 1);
 }
 
+void computeTrianglesOwnership(std::vector<int>& triangleOwners, const std::vector<int>& fCellsProcIds) {
+  triangleOwners.assign(nVertices_F, NotAnId);
+  std::vector<int> fVerticesProcIds(nVertices_F);
+  getProcIds(fVerticesProcIds, recvVerticesList_F);
+  for (int i(0); i < nVertices_F; i++) {
+    int minCellId = std::numeric_limits<int>::max();
+    int minCellIdProc(0);
+
+    int cellProc[3];
+    bool invalidCell=false;
+    for (int j = 0; j < 3; j++) {
+      int iCell = cellsOnVertex_F[3 * i + j] - 1;
+      if(iCell >= nCells_F) {
+        invalidCell = true;
+        break;
+      }
+      int cellID = indexToCellID_F[iCell];
+      cellProc[j] = fCellsProcIds[iCell];
+      if(cellID < minCellId) {
+        minCellId = cellID;
+        minCellIdProc = cellProc[j];
+      }
+    }
+
+    if(invalidCell) continue;
+
+    // the proc that owns at least 2 nodes of the triangle i. If all nodes belong to different procs, procOwns2Nodes is set to -1
+    int procOwns2Nodes = ((cellProc[0] ==  cellProc[1]) || (cellProc[0] ==  cellProc[2])) ? cellProc[0] :
+                         (cellProc[1] == cellProc[2]) ? cellProc[1] : -1;
+
+    int vertexProc = fVerticesProcIds[i];
+    bool triangleOwnsANode = (cellProc[0] == vertexProc) || (cellProc[1] == vertexProc) || (cellProc[2] == vertexProc);
+
+    //A triangle will be owned by a proc if:
+    // 1. the proc owns at least 2 nodes of the triangle associated to that vertex, OR
+    // 2. all the nodes of the triangle belong to three different procs, and the proc owns the fortran vertex  and a node OR
+    // 3. the three nodes of the triangle and the fortran vertex belong to four different procs, and the proc owns the node with the minimum ID
+
+    triangleOwners[i] = (procOwns2Nodes != -1) ? procOwns2Nodes :
+                        triangleOwnsANode ? vertexProc :
+                        minCellIdProc;
+  }
+}
+
+// Sets the proc ranks of the owned and shared FE triangles, i.e. of the MPAS vertices with dynamic ice
+void computeDynamicTrianglesOwnership(std::vector<int>& triangleOwners, const std::vector<int>& fCellsProcIds) {
+  // the ownership of a triangle does not depend on the ice mask, so it is computed only once
+  if (triangleOwnerCandidates.empty())
+    computeTrianglesOwnership(triangleOwnerCandidates, fCellsProcIds);
+
+  triangleOwners.assign(nVertices_F, NotAnId);
+  for (int i(0); i < nVertices_F; i++) {
+    if ((verticesMask_F[i] & dynamic_ice_bit_value) && (triangleOwnerCandidates[i] != NotAnId))
+      triangleOwners[i] = triangleOwnerCandidates[i];
+  }
+}
+
+// Moves FE triangles from overloaded procs to less loaded neighboring procs.
+// A triangle can only be given to a proc owning one of its nodes (MPAS cells), so that the new owner has it
+// in its halo and the reversed exchange lists can be built as usual. All the procs sharing a triangle take the
+// same decision, because it only depends on the procs owning its nodes, on the global loads and on its global ID.
+// Sweeps are repeated until the imbalance is below rebalanceTolerance, or no triangle can be moved anymore.
+// Since triangles only move among the procs owning their nodes, procs that do not own nor neighbor any
+// MPAS cell with dynamic ice cannot receive triangles, and the final imbalance may stay above the tolerance.
+void rebalanceTrianglesOwnership(std::vector<int>& triangleOwners, const std::vector<int>& fCellsProcIds) {
+  int numProcs, me;
+  MPI_Comm_size(comm, &numProcs);
+  MPI_Comm_rank(comm, &me);
+  std::vector<int> loads(numProcs);
+
+  int sweep = 0;
+  for (; sweep < maxRebalanceSweeps; sweep++) {
+    int nLocalTriangles = std::count(triangleOwners.begin(), triangleOwners.end(), me);
+    MPI_Allgather(&nLocalTriangles, 1, MPI_INT, &loads[0], 1, MPI_INT, comm);
+
+    // all procs see the same loads, so they all agree on when to stop
+    double imbalance = computeLoadImbalance(loads);
+    if ((sweep == 0) && (me == 0))
+      std::cout << "FE triangles load imbalance before rebalancing: " << imbalance << std::endl;
+    if (imbalance <= rebalanceTolerance)
+      break;
+
+    std::vector<int> newOwners(triangleOwners);
+    int nLocalMoved = 0;
+    for (int i(0); i < nVertices_F; i++) {
+      int owner = triangleOwners[i];
+      if (owner == NotAnId)
+        continue;
+
+      // find the least loaded proc among the ones owning a node of the triangle
+      int target = owner;
+      for (int j = 0; j < 3; j++) {
+        int proc = fCellsProcIds[cellsOnVertex_F[3 * i + j] - 1];
+        if ((loads[proc] < loads[target]) || ((loads[proc] == loads[target]) && (proc < target)))
+          target = proc;
+      }
+      if (loads[owner] - loads[target] < 2)
+        continue;
+
+      // only move a fraction of the triangles, selected with a hash of the global ID,
+      // so that the loads of the two procs meet halfway
+      double fraction = 0.5 * (loads[owner] - loads[target]) / loads[owner];
+      unsigned int hash = static_cast<unsigned int>(indexToVertexID_F[i]) * 2654435761u;
+      if ((hash % 1000) < fraction * 1000) {
+        newOwners[i] = target;
+        nLocalMoved += (owner == me);
+      }
+    }
+    triangleOwners.swap(newOwners);
+
+    int nMoved;
+    MPI_Allreduce(&nLocalMoved, &nMoved, 1, MPI_INT, MPI_SUM, comm);
+    if (nMoved == 0)
+      break;
+  }
+  if (me == 0)
+    std::cout << "FE triangles rebalanced in " << sweep << " sweeps" << std::endl;
+}
+
+// Ratio between the max load and the mean load over all procs, including the ones with no load
+double computeLoadImbalance(const std::vector<int>& loads) {
+  int maxLoad = 0, sumLoads = 0;
+  for (int load : loads) {
+    maxLoad = std::max(maxLoad, load);
+    sumLoads += load;
+  }
+  return (sumLoads > 0) ? double(maxLoad) * loads.size() / sumLoads : 1.0;
+}
+
+double computeLoadImbalance(int nLocalEntities) {
+  int numProcs;
+  MPI_Comm_size(comm, &numProcs);
+  std::vector<int> loads(numProcs);
+  MPI_Allgather(&nLocalEntities, 1, MPI_INT, &loads[0], 1, MPI_INT, comm);
+  return computeLoadImbalance(loads);
+}
+
+void computeIceMarginAndDirichletNodes() {
+  iceMarginEdgesLIds.clear();
+  iceMarginEdgesLIds.reserve(numBoundaryEdges);
+  for (int index = 0; index < numBoundaryEdges; index++) {
+    int fEdge = edgeToFEdge[index];
+    int fCell0 = cellsOnEdge_F[2 * fEdge] - 1;
+    int fCell1 = cellsOnEdge_F[2 * fEdge + 1] - 1;
+    assert((fCell0<nCells_F) && (fCell1<nCells_F));
+    bool isCell0OnMargin = !(cellsMask_F[fCell0] & dynamic_ice_bit_value) &&
+        (dirichletCellsMask_F[(nLayers+1)*fCell0] == 0);
+    bool isCell1OnMargin = !(cellsMask_F[fCell1] & dynamic_ice_bit_value) &&
+        (dirichletCellsMask_F[(nLayers+1)*fCell1] == 0);
+    if(isCell0OnMargin || isCell1OnMargin)
+      iceMarginEdgesLIds.push_back(index);
+  }
+
+  int vertexColumnShift = (Ordering == 1) ? 1 : globalVertexStride;
+  int vertexLayerShift = (Ordering == 0) ? 1 : nLayers + 1;
+  dirichletNodesIDs.clear();
+  dirichletNodesIDs.reserve(nVertices); //need to improve storage efficiency
+  for (int index = 0; index < nVertices; index++) {
+    int fCell = vertexToFCell[index];
+    for(int il=0; il< nLayers+1; ++il)
+    {
+      int imask_F = il+(nLayers+1)*fCell;
+      if(dirichletCellsMask_F[imask_F]!=0)
+        dirichletNodesIDs.push_back((nLayers-il)*vertexColumnShift+indexToVertexID[index]*vertexLayerShift);
+    }
+  }
+
+}
+
 void createReducedMPI(int nLocalEntities, MPI_Comm& reduced_comm_id) {
   int numProcs, me;
-  if (reduced_comm_id != MPI_COMM_NULL)
-    MPI_Comm_free(&reduced_comm_id);
   MPI_Group world_group_id, reduced_group_id;
   MPI_Comm_size(comm, &numProcs);
   MPI_Comm_rank(comm, &me);
   std::vector<int> haveElements(numProcs);
   int nonEmpty = int(nLocalEntities > 0);
   MPI_Allgather(&nonEmpty, 1, MPI_INT, &haveElements[0], 1, MPI_INT, comm);
+
+  // all procs see the same haveElements, so they all agree on reusing the reduced communicator
+  if (haveElements == prevHaveElements)
+    return;
+  prevHaveElements = haveElements;
+
+  if (reduced_comm_id != MPI_COMM_NULL)
+    MPI_Comm_free(&reduced_comm_id);
   std::vector<int> ranks;
   reduced_ranks.assign(numProcs,-1);
   for (int i = 0; i < numProcs; i++) {
@@ -76,7 +76,7 @@ void velocity_solver_set_parameters(double const* gravity_F, double const* ice_d
                         double const* clausius_clapeyron_coeff,
                         double const* thermal_thickness_limit_F,
                         int const* li_mask_ValueDynamicIce, int const* li_mask_ValueIce,
-                        bool const* use_GLP_F);
+                        bool const* use_GLP_F, bool const* rebalance_fem_triangles_F);
 
 void velocity_solver_init_l1l2(double const* levelsRatio);
 
@@ -205,6 +205,18 @@ double signedTriangleArea(const double* x, const double* y, const double* z);
 
 void createReducedMPI(int nLocalEntities, MPI_Comm& reduced_comm_id);
 
+void computeTrianglesOwnership(std::vector<int>& triangleOwners, const std::vector<int>& fCellsProcIds);
+
+void computeDynamicTrianglesOwnership(std::vector<int>& triangleOwners, const std::vector<int>& fCellsProcIds);
+
+void rebalanceTrianglesOwnership(std::vector<int>& triangleOwners, const std::vector<int>& fCellsProcIds);
+
+double computeLoadImbalance(const std::vector<int>& loads);
+
+double computeLoadImbalance(int nLocalEntities);
+
+void computeIceMarginAndDirichletNodes();
+
 void importFields(std::vector<std::pair<int, int> >& marineBdyExtensionMap,
                 double const* bedTopography_F, double const* lowerSurface_F, double const* thickness_F,
     double const* beta_F = 0, double const* stiffnessFactor_F = 0, double const* effecPress_F = 0, double const* muFriction_F = 0, double const* temperature_F = 0, double const* smb_F = 0, double eps = 0);